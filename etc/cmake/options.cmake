@@ -46,6 +46,16 @@ if(OT_COAP)
     list(APPEND OT_PRIVATE_DEFINES "OPENTHREAD_CONFIG_COAP_API_ENABLE=1")
 endif()
 
+option(OT_COAP_BLOCK "enable coap block-wise transfer support")
+if(OT_COAP_BLOCK)
+    list(APPEND OT_PRIVATE_DEFINES "OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE=1")
+endif()
+
+option(OT_COAP_OBSERVE "enable coap observe (RFC7641) support")
+if(OT_COAP_OBSERVE)
+    list(APPEND OT_PRIVATE_DEFINES "OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE=1")
+endif()
+
 option(OT_COAPS "enable secure coap api support")
 if(OT_COAPS)
     list(APPEND OT_PRIVATE_DEFINES "OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE=1")
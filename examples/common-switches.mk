@@ -33,6 +33,8 @@ BORDER_AGENT        ?= 0
 BORDER_ROUTER       ?= 0
 COAP                ?= 0
 COAPS               ?= 0
+COAP_BLOCK          ?= 0
+COAP_OBSERVE        ?= 0
 COMMISSIONER        ?= 0
 COVERAGE            ?= 0
 CHANNEL_MANAGER     ?= 0
@@ -85,6 +87,14 @@ ifeq ($(COAP),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_API_ENABLE=1
 endif
 
+ifeq ($(COAP_BLOCK),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE=1
+endif
+
+ifeq ($(COAP_OBSERVE),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE=1
+endif
+
 ifeq ($(COAPS),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE=1
 endif
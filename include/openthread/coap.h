@@ -90,12 +90,13 @@ typedef enum otCoapCode
     OT_COAP_CODE_PUT    = OT_COAP_CODE(0, 3), ///< Put
     OT_COAP_CODE_DELETE = OT_COAP_CODE(0, 4), ///< Delete
 
-    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0), ///< 2.00
-    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1), ///< Created
-    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2), ///< Deleted
-    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3), ///< Valid
-    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4), ///< Changed
-    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5), ///< Content
+    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0),  ///< 2.00
+    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1),  ///< Created
+    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2),  ///< Deleted
+    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3),  ///< Valid
+    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4),  ///< Changed
+    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5),  ///< Content
+    OT_COAP_CODE_CONTINUE     = OT_COAP_CODE(2, 31), ///< Continue (RFC 7959)
 
     OT_COAP_CODE_BAD_REQUEST         = OT_COAP_CODE(4, 0),  ///< Bad Request
     OT_COAP_CODE_UNAUTHORIZED        = OT_COAP_CODE(4, 1),  ///< Unauthorized
@@ -134,6 +135,9 @@ typedef enum otCoapOptionType
     OT_COAP_OPTION_URI_QUERY      = 15, ///< Uri-Query
     OT_COAP_OPTION_ACCEPT         = 17, ///< Accept
     OT_COAP_OPTION_LOCATION_QUERY = 20, ///< Location-Query
+    OT_COAP_OPTION_BLOCK2         = 23, ///< Block2 (RFC 7959)
+    OT_COAP_OPTION_BLOCK1         = 27, ///< Block1 (RFC 7959)
+    OT_COAP_OPTION_SIZE2          = 28, ///< Size2 (RFC 7959)
     OT_COAP_OPTION_PROXY_URI      = 35, ///< Proxy-Uri
     OT_COAP_OPTION_PROXY_SCHEME   = 39, ///< Proxy-Scheme
     OT_COAP_OPTION_SIZE1          = 60, ///< Size1
@@ -343,6 +347,79 @@ typedef struct otCoapResource
     struct otCoapResource *mNext;    ///< The next CoAP resource in the list
 } otCoapResource;
 
+/**
+ * CoAP block sizes (RFC 7959), encoded as the SZX field of the Block1 and Block2 options.
+ *
+ */
+typedef enum otCoapBlockSize
+{
+    OT_COAP_BLOCK_SIZE_16   = 0, ///< 16 bytes
+    OT_COAP_BLOCK_SIZE_32   = 1, ///< 32 bytes
+    OT_COAP_BLOCK_SIZE_64   = 2, ///< 64 bytes
+    OT_COAP_BLOCK_SIZE_128  = 3, ///< 128 bytes
+    OT_COAP_BLOCK_SIZE_256  = 4, ///< 256 bytes
+    OT_COAP_BLOCK_SIZE_512  = 5, ///< 512 bytes
+    OT_COAP_BLOCK_SIZE_1024 = 6, ///< 1024 bytes
+} otCoapBlockSize;
+
+/**
+ * This function pointer is called to hand over one received block of a block-wise transfer.
+ *
+ * The block is not copied: it is the payload of @p aMessage, starting at `otMessageGetOffset(aMessage)`.
+ *
+ * @param[in]  aContext      A pointer to application-specific context.
+ * @param[in]  aMessage      A pointer to the message carrying the block.
+ * @param[in]  aPosition     The byte position of the block within the whole payload.
+ * @param[in]  aBlockLength  The length of the block in bytes.
+ * @param[in]  aMore         TRUE if more blocks follow, FALSE if this is the last block.
+ *
+ * @retval OT_ERROR_NONE     The block was accepted.
+ * @retval OT_ERROR_NO_BUFS  The block was rejected because the payload is too large, which aborts the transfer.
+ * @retval ...               Any other error rejects the block and aborts the transfer.
+ *
+ */
+typedef otError (*otCoapBlockwiseReceiveHook)(void *           aContext,
+                                              const otMessage *aMessage,
+                                              uint32_t         aPosition,
+                                              uint16_t         aBlockLength,
+                                              bool             aMore);
+
+/**
+ * This function pointer is called to get one block of a block-wise transfer to send.
+ *
+ * The hook appends at most @p aBlockLength bytes, starting at @p aPosition of the whole payload, to @p aMessage with
+ * `otMessageAppend()`.
+ *
+ * @param[in]   aContext      A pointer to application-specific context.
+ * @param[in]   aMessage      A pointer to the message to append the block to.
+ * @param[in]   aPosition     The byte position of the block within the whole payload.
+ * @param[in]   aBlockLength  The maximum length of the block in bytes.
+ * @param[out]  aMore         Set to TRUE if more blocks follow, FALSE if this is the last block.
+ *
+ * @retval OT_ERROR_NONE  The block was appended.
+ * @retval ...            Any other error aborts the transfer.
+ *
+ */
+typedef otError (*otCoapBlockwiseTransmitHook)(void *     aContext,
+                                               otMessage *aMessage,
+                                               uint32_t   aPosition,
+                                               uint16_t   aBlockLength,
+                                               bool *     aMore);
+
+/**
+ * This structure represents a CoAP resource with block-wise transfer.
+ *
+ */
+typedef struct otCoapBlockwiseResource
+{
+    const char *                    mUriPath;      ///< The URI Path string
+    otCoapRequestHandler            mHandler;      ///< The callback for handling a received request
+    otCoapBlockwiseReceiveHook      mReceiveHook;  ///< The callback for the blocks of a Block1 request
+    otCoapBlockwiseTransmitHook     mTransmitHook; ///< The callback for the blocks of a Block2 response
+    void *                          mContext;      ///< Application-specific context
+    struct otCoapBlockwiseResource *mNext;         ///< The next CoAP block-wise resource in the list
+} otCoapBlockwiseResource;
+
 /**
  * This function initializes the CoAP header.
  *
@@ -455,6 +532,36 @@ otError otCoapMessageAppendUintOption(otMessage *aMessage, uint16_t aNumber, uin
  */
 otError otCoapMessageAppendObserveOption(otMessage *aMessage, uint32_t aObserve);
 
+/**
+ * This function appends a Block1 option.
+ *
+ * @param[inout]  aMessage  A pointer to the CoAP message.
+ * @param[in]     aNumber   The block number.
+ * @param[in]     aMore     TRUE if more blocks follow.
+ * @param[in]     aSize     The block size.
+ *
+ * @retval OT_ERROR_NONE          Successfully appended the option.
+ * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type.
+ * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+ *
+ */
+otError otCoapMessageAppendBlock1Option(otMessage *aMessage, uint32_t aNumber, bool aMore, otCoapBlockSize aSize);
+
+/**
+ * This function appends a Block2 option.
+ *
+ * @param[inout]  aMessage  A pointer to the CoAP message.
+ * @param[in]     aNumber   The block number.
+ * @param[in]     aMore     TRUE if more blocks follow.
+ * @param[in]     aSize     The block size.
+ *
+ * @retval OT_ERROR_NONE          Successfully appended the option.
+ * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type.
+ * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+ *
+ */
+otError otCoapMessageAppendBlock2Option(otMessage *aMessage, uint32_t aNumber, bool aMore, otCoapBlockSize aSize);
+
 /**
  * This function appends a Uri-Path option.
  *
@@ -641,6 +748,11 @@ otMessage *otCoapNewMessage(otInstance *aInstance, const otMessageSettings *aSet
  * If a response for a request is expected, respective function and context information should be provided.
  * If no response is expected, these arguments should be NULL pointers.
  *
+ * A GET request carrying an Observe option of value 0 registers an observation (RFC 7641): @p aHandler is then called
+ * for the response and every following notification, until a response without an Observe option is received or a GET
+ * request with the same token and an Observe option of value 1 is sent to cancel the observation. On cancellation,
+ * @p aHandler of the registration is called with OT_ERROR_ABORT.
+ *
  * @param[in]  aInstance     A pointer to an OpenThread instance.
  * @param[in]  aMessage      A pointer to the message to send.
  * @param[in]  aMessageInfo  A pointer to the message info associated with @p aMessage.
@@ -657,6 +769,41 @@ otError otCoapSendRequest(otInstance *          aInstance,
                           otCoapResponseHandler aHandler,
                           void *                aContext);
 
+/**
+ * This function sends a CoAP request using block-wise transfer.
+ *
+ * @p aMessage holds the request header and options only. When @p aTransmitHook is set, the request payload is pulled
+ * from it one block at a time and sent with Block1 options. When @p aReceiveHook is set, a response sent with Block2
+ * options is handed to it one block at a time and the following blocks are requested automatically. @p aHandler is
+ * called once with the final response (or error) of the whole transfer.
+ *
+ * Only one block is held in the message pool at any time, and a lost block is retransmitted on its own. The Block1
+ * or Block2 option is inserted among the options of @p aMessage in order of option numbers.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the message to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aHandler       A function pointer that shall be called on response reception or timeout.
+ * @param[in]  aContext       A pointer to arbitrary context information, passed to the handler and the hooks.
+ * @param[in]  aBlockSize     The block size to use.
+ * @param[in]  aTransmitHook  A function pointer providing the request payload blocks, or NULL if none.
+ * @param[in]  aReceiveHook   A function pointer consuming the response payload blocks, or NULL if not used.
+ *
+ * @retval OT_ERROR_NONE          Successfully sent the first block of the request.
+ * @retval OT_ERROR_INVALID_ARGS  @p aMessage is not a request or has a payload, or @p aTransmitHook is set for a
+ *                                non-confirmable one.
+ * @retval OT_ERROR_NO_BUFS       Failed to allocate the block or the retransmission data.
+ *
+ */
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext,
+                                   otCoapBlockSize             aBlockSize,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook);
+
 /**
  * This function starts the CoAP server.
  *
@@ -699,6 +846,31 @@ otError otCoapAddResource(otInstance *aInstance, otCoapResource *aResource);
  */
 void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource);
 
+/**
+ * This function adds a block-wise resource to the CoAP server.
+ *
+ * The blocks of a Block1 request are handed to the resource's receive hook, and the stack answers each of them but
+ * the last with 2.31 (Continue). The last block is then passed to the resource's handler. Requests for the blocks
+ * following the first one of a Block2 response are answered from the resource's transmit hook.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the block-wise resource.
+ *
+ * @retval OT_ERROR_NONE     Successfully added @p aResource.
+ * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+ *
+ */
+otError otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource);
+
+/**
+ * This function removes a block-wise resource from the CoAP server.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the block-wise resource.
+ *
+ */
+void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource);
+
 /**
  * This function sets the default handler for unhandled CoAP requests.
  *
@@ -722,6 +894,71 @@ void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandle
  */
 otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This function indicates whether a request registered its sender as an observer of the requested resource.
+ *
+ * A resource handler calls this function to find out if a GET request carrying an Observe option of value 0 was
+ * accepted. In that case the response includes an Observe option (with value 0), added with
+ * `otCoapMessageAppendObserveOption()`.
+ *
+ * @param[in]  aInstance     A pointer to an OpenThread instance.
+ * @param[in]  aRequest      A pointer to the request.
+ * @param[in]  aMessageInfo  A pointer to the message info associated with @p aRequest.
+ *
+ * @retval TRUE   The sender of @p aRequest observes the resource using the token of @p aRequest.
+ * @retval FALSE  The sender of @p aRequest does not observe the resource.
+ *
+ */
+bool otCoapIsObserverRegistered(otInstance *aInstance, const otMessage *aRequest, const otMessageInfo *aMessageInfo);
+
+/**
+ * This function sends a notification to all observers of a resource (RFC 7641).
+ *
+ * @p aMessage is built like the response to the registration: it holds the notification header (type and code), an
+ * Observe option as its first option, the other options and the payload. Each observer gets a copy of it carrying
+ * the observer's token and the next Observe sequence number. An observer rejecting a notification with a reset
+ * message, or not acknowledging a confirmable notification, is removed; OpenThread observers reset unexpected
+ * confirmable notifications. When sending to an observer fails, the other observers are still notified and the first
+ * error is returned.
+ *
+ * The caller keeps the ownership of @p aMessage.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the observed resource.
+ * @param[in]  aMessage   A pointer to the notification.
+ *
+ * @retval OT_ERROR_NONE          Successfully sent the notification to all observers.
+ * @retval OT_ERROR_INVALID_ARGS  The first option of @p aMessage is not an Observe option.
+ * @retval OT_ERROR_NO_BUFS       Insufficient buffers available to send the notification to some observers.
+ *
+ */
+otError otCoapNotifyObservers(otInstance *aInstance, const otCoapResource *aResource, const otMessage *aMessage);
+
+/**
+ * This function sends the first block of a CoAP response using block-wise transfer.
+ *
+ * @p aMessage holds the response header and options only. Its payload is pulled from @p aTransmitHook and sent with a
+ * Block2 option. The following blocks are requested by the client and served by the transmit hook of the block-wise
+ * resource the request was addressed to.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the CoAP response to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+ * @param[in]  aBlockSize     The block size to use.
+ * @param[in]  aTransmitHook  A function pointer providing the response payload blocks.
+ *
+ * @retval OT_ERROR_NONE     Successfully enqueued the CoAP response message.
+ * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the CoAP response.
+ *
+ */
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    const otMessageInfo *       aMessageInfo,
+                                    void *                      aContext,
+                                    otCoapBlockSize             aBlockSize,
+                                    otCoapBlockwiseTransmitHook aTransmitHook);
+
 /**
  * @}
  *
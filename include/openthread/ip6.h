@@ -214,6 +214,16 @@ otError otIp6RemoveUnicastAddress(otInstance *aInstance, const otIp6Address *aAd
  */
 const otNetifAddress *otIp6GetUnicastAddresses(otInstance *aInstance);
 
+/**
+ * Get the number of IPv6 addresses assigned to the Thread interface.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @returns The number of IPv6 addresses assigned to the Thread interface.
+ *
+ */
+uint16_t otIp6GetUnicastAddressCount(otInstance *aInstance);
+
 /**
  * Subscribe the Thread interface to a Network Interface Multicast Address.
  *
@@ -255,6 +265,16 @@ otError otIp6UnsubscribeMulticastAddress(otInstance *aInstance, const otIp6Addre
  */
 const otNetifMulticastAddress *otIp6GetMulticastAddresses(otInstance *aInstance);
 
+/**
+ * Get the number of IPv6 multicast addresses subscribed to the Thread interface.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @returns The number of IPv6 multicast addresses subscribed to the Thread interface.
+ *
+ */
+uint16_t otIp6GetMulticastAddressCount(otInstance *aInstance);
+
 /**
  * Check if multicast promiscuous mode is enabled on the Thread interface.
  *
@@ -90,6 +90,17 @@ typedef struct otEidCacheEntry
     bool           mValid : 1; ///< Indicates whether or not the cache entry is valid
 } otEidCacheEntry;
 
+/**
+ * This structure represents the EID cache counters.
+ *
+ */
+typedef struct otEidCacheCounters
+{
+    uint32_t mHits;      ///< Number of lookups resolved from a cached entry
+    uint32_t mMisses;    ///< Number of lookups without a cached entry (Address Query sent or pending)
+    uint32_t mEvictions; ///< Number of entries evicted to make room for a new entry
+} otEidCacheCounters;
+
 /**
  * Get the maximum number of children currently allowed.
  *
@@ -519,6 +530,24 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetEidCacheEntry(otInstance *aInstance, uint8_t aIndex, otEidCacheEntry *aEntry);
 
+/**
+ * This function gets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID cache counters.
+ *
+ */
+const otEidCacheCounters *otThreadGetEidCacheCounters(otInstance *aInstance);
+
+/**
+ * This function resets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetEidCacheCounters(otInstance *aInstance);
+
 /**
  * Get the Thread PSKc
  *
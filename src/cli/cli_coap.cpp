@@ -48,12 +48,20 @@ const struct Coap::Command Coap::sCommands[] = {
     {"help", &Coap::ProcessHelp},    {"delete", &Coap::ProcessRequest}, {"get", &Coap::ProcessRequest},
     {"post", &Coap::ProcessRequest}, {"put", &Coap::ProcessRequest},    {"resource", &Coap::ProcessResource},
     {"start", &Coap::ProcessStart},  {"stop", &Coap::ProcessStop},
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    {"cancel", &Coap::ProcessCancel}, {"observe", &Coap::ProcessObserve}, {"set", &Coap::ProcessSet},
+#endif
 };
 
 Coap::Coap(Interpreter &aInterpreter)
     : mInterpreter(aInterpreter)
 {
     memset(&mResource, 0, sizeof(mResource));
+    strcpy(mResourceContent, "0");
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    memset(mObserveUri, 0, sizeof(mObserveUri));
+    mObserveTokenLength = 0;
+#endif
 }
 
 void Coap::PrintPayload(otMessage *aMessage) const
@@ -250,6 +258,121 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+otError Coap::ProcessObserve(int argc, char *argv[])
+{
+    otError    error    = OT_ERROR_NONE;
+    otCoapType coapType = OT_COAP_TYPE_NON_CONFIRMABLE;
+
+    VerifyOrExit(argc > 2, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(strlen(argv[2]) < kMaxUriLength, error = OT_ERROR_INVALID_ARGS);
+
+    SuccessOrExit(error = otIp6AddressFromString(argv[1], &mObserveAddress));
+    strncpy(mObserveUri, argv[2], sizeof(mObserveUri) - 1);
+
+    if (argc > 3 && strcmp(argv[3], "con") == 0)
+    {
+        coapType = OT_COAP_TYPE_CONFIRMABLE;
+    }
+
+    mObserveTokenLength = 0;
+    error               = SendObserveRequest(coapType, 0);
+
+exit:
+    return error;
+}
+
+otError Coap::ProcessCancel(int argc, char *argv[])
+{
+    otError error = OT_ERROR_NONE;
+
+    OT_UNUSED_VARIABLE(argc);
+    OT_UNUSED_VARIABLE(argv);
+
+    VerifyOrExit(mObserveTokenLength != 0, error = OT_ERROR_INVALID_STATE);
+
+    SuccessOrExit(error = SendObserveRequest(OT_COAP_TYPE_NON_CONFIRMABLE, 1));
+    mObserveTokenLength = 0;
+
+exit:
+    return error;
+}
+
+otError Coap::ProcessSet(int argc, char *argv[])
+{
+    otError    error   = OT_ERROR_NONE;
+    otMessage *message = NULL;
+
+    VerifyOrExit(argc > 1, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(strlen(argv[1]) < kMaxContentLength, error = OT_ERROR_INVALID_ARGS);
+
+    strncpy(mResourceContent, argv[1], sizeof(mResourceContent) - 1);
+
+    VerifyOrExit(mResource.mUriPath != NULL);
+
+    message = otCoapNewMessage(mInterpreter.mInstance, NULL);
+    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
+    otCoapMessageInit(message, OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_CONTENT);
+    SuccessOrExit(error = otCoapMessageAppendObserveOption(message, 0));
+    SuccessOrExit(error = otCoapMessageSetPayloadMarker(message));
+    SuccessOrExit(error = otMessageAppend(message, mResourceContent, static_cast<uint16_t>(strlen(mResourceContent))));
+
+    error = otCoapNotifyObservers(mInterpreter.mInstance, &mResource, message);
+
+exit:
+
+    if (message != NULL)
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+otError Coap::SendObserveRequest(otCoapType aType, uint32_t aObserve)
+{
+    otError       error   = OT_ERROR_NONE;
+    otMessage *   message = NULL;
+    otMessageInfo messageInfo;
+
+    message = otCoapNewMessage(mInterpreter.mInstance, NULL);
+    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
+    otCoapMessageInit(message, aType, OT_COAP_CODE_GET);
+
+    if (mObserveTokenLength == 0)
+    {
+        otCoapMessageGenerateToken(message, ot::Coap::Message::kDefaultTokenLength);
+        mObserveTokenLength = otCoapMessageGetTokenLength(message);
+        memcpy(mObserveToken, otCoapMessageGetToken(message), mObserveTokenLength);
+    }
+    else
+    {
+        SuccessOrExit(error = otCoapMessageSetToken(message, mObserveToken, mObserveTokenLength));
+    }
+
+    // Observe (6) precedes Uri-Path (11) in option number order.
+    SuccessOrExit(error = otCoapMessageAppendObserveOption(message, aObserve));
+    SuccessOrExit(error = otCoapMessageAppendUriPathOptions(message, mObserveUri));
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = mObserveAddress;
+    messageInfo.mPeerPort = OT_DEFAULT_COAP_PORT;
+
+    error = otCoapSendRequest(mInterpreter.mInstance, message, &messageInfo, &Coap::HandleResponse, this);
+
+exit:
+
+    if ((error != OT_ERROR_NONE) && (message != NULL))
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+
 otError Coap::Process(int argc, char *argv[])
 {
     otError error = OT_ERROR_PARSE;
@@ -284,7 +407,6 @@ void Coap::HandleRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo)
     otError    error           = OT_ERROR_NONE;
     otMessage *responseMessage = NULL;
     otCoapCode responseCode    = OT_COAP_CODE_EMPTY;
-    char       responseContent = '0';
 
     mInterpreter.mServer->OutputFormat("coap request from ");
     mInterpreter.OutputIp6Address(aMessageInfo->mPeerAddr);
@@ -335,8 +457,15 @@ void Coap::HandleRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo)
 
         if (otCoapMessageGetCode(aMessage) == OT_COAP_CODE_GET)
         {
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+            if (otCoapIsObserverRegistered(mInterpreter.mInstance, aMessage, aMessageInfo))
+            {
+                SuccessOrExit(error = otCoapMessageAppendObserveOption(responseMessage, 0));
+            }
+#endif
             SuccessOrExit(error = otCoapMessageSetPayloadMarker(responseMessage));
-            SuccessOrExit(error = otMessageAppend(responseMessage, &responseContent, sizeof(responseContent)));
+            SuccessOrExit(error = otMessageAppend(responseMessage, mResourceContent,
+                                                  static_cast<uint16_t>(strlen(mResourceContent))));
         }
 
         SuccessOrExit(error = otCoapSendResponse(mInterpreter.mInstance, responseMessage, aMessageInfo));
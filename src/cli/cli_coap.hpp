@@ -72,8 +72,9 @@ public:
 private:
     enum
     {
-        kMaxUriLength  = 32,
-        kMaxBufferSize = 16
+        kMaxUriLength     = 32,
+        kMaxBufferSize    = 16,
+        kMaxContentLength = 32
     };
 
     struct Command
@@ -89,6 +90,13 @@ private:
     otError ProcessResource(int argc, char *argv[]);
     otError ProcessStart(int argc, char *argv[]);
     otError ProcessStop(int argc, char *argv[]);
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    otError ProcessCancel(int argc, char *argv[]);
+    otError ProcessObserve(int argc, char *argv[]);
+    otError ProcessSet(int argc, char *argv[]);
+
+    otError SendObserveRequest(otCoapType aType, uint32_t aObserve);
+#endif
 
     static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo);
@@ -101,6 +109,14 @@ private:
 
     otCoapResource mResource;
     char           mUriPath[kMaxUriLength];
+    char           mResourceContent[kMaxContentLength];
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    otIp6Address mObserveAddress;
+    char         mObserveUri[kMaxUriLength];
+    uint8_t      mObserveToken[OT_COAP_MAX_TOKEN_LENGTH];
+    uint8_t      mObserveTokenLength;
+#endif
 };
 
 } // namespace Cli
@@ -105,6 +105,16 @@ otError otCoapMessageAppendObserveOption(otMessage *aMessage, uint32_t aObserve)
     return static_cast<Coap::Message *>(aMessage)->AppendObserveOption(aObserve);
 }
 
+otError otCoapMessageAppendBlock1Option(otMessage *aMessage, uint32_t aNumber, bool aMore, otCoapBlockSize aSize)
+{
+    return static_cast<Coap::Message *>(aMessage)->AppendBlockOption(OT_COAP_OPTION_BLOCK1, aNumber, aMore, aSize);
+}
+
+otError otCoapMessageAppendBlock2Option(otMessage *aMessage, uint32_t aNumber, bool aMore, otCoapBlockSize aSize)
+{
+    return static_cast<Coap::Message *>(aMessage)->AppendBlockOption(OT_COAP_OPTION_BLOCK2, aNumber, aMore, aSize);
+}
+
 otError otCoapMessageAppendUriPathOptions(otMessage *aMessage, const char *aUriPath)
 {
     return static_cast<Coap::Message *>(aMessage)->AppendUriPathOptions(aUriPath);
@@ -193,6 +203,24 @@ otError otCoapSendRequest(otInstance *          aInstance,
                                                      aContext);
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext,
+                                   otCoapBlockSize             aBlockSize,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendMessageBlockWise(
+        *static_cast<Coap::Message *>(aMessage), *static_cast<const Ip6::MessageInfo *>(aMessageInfo), aHandler,
+        aContext, aBlockSize, aTransmitHook, aReceiveHook);
+}
+#endif
+
 otError otCoapStart(otInstance *aInstance, uint16_t aPort)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -221,6 +249,22 @@ void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource)
     instance.GetApplicationCoap().RemoveResource(*static_cast<Coap::Resource *>(aResource));
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().AddBlockWiseResource(*static_cast<Coap::BlockwiseResource *>(aResource));
+}
+
+void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetApplicationCoap().RemoveBlockWiseResource(*static_cast<Coap::BlockwiseResource *>(aResource));
+}
+#endif
+
 void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandler, void *aContext)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -236,4 +280,38 @@ otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otM
                                                      *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
 }
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+bool otCoapIsObserverRegistered(otInstance *aInstance, const otMessage *aRequest, const otMessageInfo *aMessageInfo)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().IsObserverRegistered(*static_cast<const Coap::Message *>(aRequest),
+                                                              *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
+}
+
+otError otCoapNotifyObservers(otInstance *aInstance, const otCoapResource *aResource, const otMessage *aMessage)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().NotifyObservers(*static_cast<const Coap::Resource *>(aResource),
+                                                         *static_cast<const Coap::Message *>(aMessage));
+}
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    const otMessageInfo *       aMessageInfo,
+                                    void *                      aContext,
+                                    otCoapBlockSize             aBlockSize,
+                                    otCoapBlockwiseTransmitHook aTransmitHook)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendResponseBlockWise(*static_cast<Coap::Message *>(aMessage),
+                                                               *static_cast<const Ip6::MessageInfo *>(aMessageInfo),
+                                                               aContext, aBlockSize, aTransmitHook);
+}
+#endif
+
 #endif // OPENTHREAD_CONFIG_COAP_API_ENABLE
@@ -82,6 +82,13 @@ const otNetifAddress *otIp6GetUnicastAddresses(otInstance *aInstance)
     return instance.Get<ThreadNetif>().GetUnicastAddresses();
 }
 
+uint16_t otIp6GetUnicastAddressCount(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<ThreadNetif>().GetUnicastAddressCount();
+}
+
 otError otIp6AddUnicastAddress(otInstance *aInstance, const otNetifAddress *aAddress)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -104,6 +111,13 @@ const otNetifMulticastAddress *otIp6GetMulticastAddresses(otInstance *aInstance)
     return instance.Get<ThreadNetif>().GetMulticastAddresses();
 }
 
+uint16_t otIp6GetMulticastAddressCount(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<ThreadNetif>().GetMulticastAddressCount();
+}
+
 otError otIp6SubscribeMulticastAddress(otInstance *aInstance, const otIp6Address *aAddress)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -174,6 +174,11 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mFreeBuffers = instance.Get<MessagePool>().GetFreeBufferCount();
 
     instance.Get<MeshForwarder>().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages, aBufferInfo->m6loSendBuffers);
+#if OPENTHREAD_FTD
+    instance.Get<MeshForwarder>().GetIndirectSendQueue().GetInfo(messages, buffers);
+    aBufferInfo->m6loSendMessages += messages;
+    aBufferInfo->m6loSendBuffers += buffers;
+#endif
 
     instance.Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aBufferInfo->m6loReassemblyMessages,
                                                                aBufferInfo->m6loReassemblyBuffers);
@@ -308,6 +308,20 @@ otError otThreadGetEidCacheEntry(otInstance *aInstance, uint8_t aIndex, otEidCac
     return instance.Get<AddressResolver>().GetEntry(aIndex, *aEntry);
 }
 
+const otEidCacheCounters *otThreadGetEidCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<AddressResolver>().GetCounters();
+}
+
+void otThreadResetEidCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<AddressResolver>().ResetCounters();
+}
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
 void otThreadSetSteeringData(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
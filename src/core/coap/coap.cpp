@@ -37,6 +37,7 @@
 #include "net/ip6.hpp"
 #include "net/udp6.hpp"
 #include "thread/thread_netif.hpp"
+#include "thread/thread_uri_paths.hpp"
 
 /**
  * @file
@@ -46,6 +47,42 @@
 namespace ot {
 namespace Coap {
 
+// Sorted by `strcmp()` so that request dispatching can binary search it.
+const char *const CoapBase::sWellKnownUriPaths[] = {
+    OT_URI_PATH_ADDRESS_ERROR,           // "a/ae"
+    OT_URI_PATH_ADDRESS_NOTIFY,          // "a/an"
+    OT_URI_PATH_ADDRESS_QUERY,           // "a/aq"
+    OT_URI_PATH_ADDRESS_RELEASE,         // "a/ar"
+    OT_URI_PATH_ADDRESS_SOLICIT,         // "a/as"
+    OT_URI_PATH_SERVER_DATA,             // "a/sd"
+    OT_URI_PATH_ANNOUNCE_BEGIN,          // "c/ab"
+    OT_URI_PATH_ACTIVE_GET,              // "c/ag"
+    OT_URI_PATH_ACTIVE_SET,              // "c/as"
+    OT_URI_PATH_COMMISSIONER_KEEP_ALIVE, // "c/ca"
+    OT_URI_PATH_COMMISSIONER_GET,        // "c/cg"
+    OT_URI_PATH_COMMISSIONER_PETITION,   // "c/cp"
+    OT_URI_PATH_COMMISSIONER_SET,        // "c/cs"
+    OT_URI_PATH_DATASET_CHANGED,         // "c/dc"
+    OT_URI_PATH_ENERGY_REPORT,           // "c/er"
+    OT_URI_PATH_ENERGY_SCAN,             // "c/es"
+    OT_URI_PATH_JOINER_ENTRUST,          // "c/je"
+    OT_URI_PATH_JOINER_FINALIZE,         // "c/jf"
+    OT_URI_PATH_LEADER_KEEP_ALIVE,       // "c/la"
+    OT_URI_PATH_LEADER_PETITION,         // "c/lp"
+    OT_URI_PATH_PANID_CONFLICT,          // "c/pc"
+    OT_URI_PATH_PENDING_GET,             // "c/pg"
+    OT_URI_PATH_PANID_QUERY,             // "c/pq"
+    OT_URI_PATH_PENDING_SET,             // "c/ps"
+    OT_URI_PATH_RELAY_RX,                // "c/rx"
+    OT_URI_PATH_RELAY_TX,                // "c/tx"
+    OT_URI_PATH_PROXY_RX,                // "c/ur"
+    OT_URI_PATH_PROXY_TX,                // "c/ut"
+    OT_URI_PATH_DIAGNOSTIC_GET_ANSWER,   // "d/da"
+    OT_URI_PATH_DIAGNOSTIC_GET_REQUEST,  // "d/dg"
+    OT_URI_PATH_DIAGNOSTIC_GET_QUERY,    // "d/dq"
+    OT_URI_PATH_DIAGNOSTIC_RESET,        // "d/dr"
+};
+
 CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
     , mRetransmissionTimer(aInstance, &Coap::HandleRetransmissionTimer, this)
@@ -57,39 +94,196 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     , mDefaultHandlerContext(NULL)
     , mSender(aSender)
 {
+    OT_STATIC_ASSERT(OT_ARRAY_LENGTH(sWellKnownUriPaths) == kNumWellKnownUriPaths,
+                     "kNumWellKnownUriPaths does not match sWellKnownUriPaths");
+
+    // `FindWellKnownUriPath()` and `ProcessReceivedRequest()` rely on binary searches.
+    for (uint8_t i = 1; i < kNumWellKnownUriPaths; i++)
+    {
+        assert(strcmp(sWellKnownUriPaths[i - 1], sWellKnownUriPaths[i]) < 0);
+    }
+
     mMessageId = Random::NonCrypto::GetUint16();
+    memset(mWellKnownResources, 0, sizeof(mWellKnownResources));
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    memset(mObservers, 0, sizeof(mObservers));
+#endif
 }
 
 void CoapBase::ClearRequestsAndResponses(void)
 {
-    Message *    message = static_cast<Message *>(mPendingRequests.GetHead());
-    Message *    messageToRemove;
+    Message *    message;
     CoapMetadata coapMetadata;
 
     // Remove all pending messages.
-    while (message != NULL)
+    while ((message = static_cast<Message *>(mPendingRequests.GetHead())) != NULL)
     {
-        messageToRemove = message;
-        message         = static_cast<Message *>(message->GetNext());
-
-        coapMetadata.ReadFrom(*messageToRemove);
-        FinalizeCoapTransaction(*messageToRemove, coapMetadata, NULL, NULL, OT_ERROR_ABORT);
+        coapMetadata.ReadFrom(*message);
+        FinalizeCoapTransaction(*message, coapMetadata, NULL, NULL, OT_ERROR_ABORT);
     }
 
     mResponsesQueue.DequeueAllResponses();
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    memset(mObservers, 0, sizeof(mObservers));
+#endif
 }
 
 otError CoapBase::AddResource(Resource &aResource)
 {
-    return mResources.Add(aResource);
+    otError error = OT_ERROR_NONE;
+    uint8_t index = FindWellKnownUriPath(aResource.mUriPath);
+
+    VerifyOrExit(!mResources.Contains(aResource), error = OT_ERROR_ALREADY);
+
+    if (index == kNotWellKnownUriPath)
+    {
+        mResources.Push(aResource);
+        ExitNow();
+    }
+
+    VerifyOrExit(mWellKnownResources[index] != &aResource, error = OT_ERROR_ALREADY);
+
+    // The latest resource added for a path handles its requests, the one it replaces waits in the list.
+    if (mWellKnownResources[index] != NULL)
+    {
+        mResources.Push(*mWellKnownResources[index]);
+    }
+
+    mWellKnownResources[index] = &aResource;
+
+exit:
+    return error;
 }
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    mResources.Remove(aResource);
+    uint8_t index = FindWellKnownUriPath(aResource.mUriPath);
+
+    if (index != kNotWellKnownUriPath && mWellKnownResources[index] == &aResource)
+    {
+        mWellKnownResources[index] = NULL;
+
+        // Hand the path back to the latest resource which was added for it before `aResource`.
+        for (Resource *cur = mResources.GetHead(); cur != NULL; cur = cur->GetNext())
+        {
+            if (strcmp(cur->mUriPath, aResource.mUriPath) == 0)
+            {
+                mResources.Remove(*cur);
+                mWellKnownResources[index] = cur;
+                break;
+            }
+        }
+    }
+    else
+    {
+        mResources.Remove(aResource);
+    }
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    RemoveObservers(aResource);
+#endif
+
     aResource.SetNext(NULL);
 }
 
+uint8_t CoapBase::FindWellKnownUriPath(const char *aUriPath)
+{
+    uint8_t low  = 0;
+    uint8_t high = kNumWellKnownUriPaths;
+    uint8_t index;
+    int     compare;
+
+    while (low < high)
+    {
+        index   = (low + high) / 2;
+        compare = strcmp(sWellKnownUriPaths[index], aUriPath);
+
+        if (compare == 0)
+        {
+            ExitNow();
+        }
+
+        if (compare < 0)
+        {
+            low = index + 1;
+        }
+        else
+        {
+            high = index;
+        }
+    }
+
+    index = kNotWellKnownUriPath;
+
+exit:
+    return index;
+}
+
+int CoapBase::CompareUriPathSegment(const char *aUriPath, const char *aSegment, uint16_t aLength)
+{
+    int compare = 0;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        // A path ending before the segment sorts first, even against a zero byte in the segment.
+        VerifyOrExit(aUriPath[i] != '\0', compare = -1);
+
+        compare = static_cast<uint8_t>(aUriPath[i]) - static_cast<uint8_t>(aSegment[i]);
+        VerifyOrExit(compare == 0);
+    }
+
+exit:
+    return compare;
+}
+
+void CoapBase::NarrowWellKnownUriPaths(uint8_t &   aLow,
+                                       uint8_t &   aHigh,
+                                       uint16_t    aOffset,
+                                       const char *aSegment,
+                                       uint16_t    aLength)
+{
+    // The paths in [aLow, aHigh) share their first `aOffset` characters, so they are also sorted by the characters
+    // following them. Binary search for the sub-range continuing with `aSegment`.
+    uint8_t low  = aLow;
+    uint8_t high = aHigh;
+    uint8_t middle;
+
+    while (low < high)
+    {
+        middle = (low + high) / 2;
+
+        if (CompareUriPathSegment(sWellKnownUriPaths[middle] + aOffset, aSegment, aLength) < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    aLow = low;
+    high = aHigh;
+
+    while (low < high)
+    {
+        middle = (low + high) / 2;
+
+        if (CompareUriPathSegment(sWellKnownUriPaths[middle] + aOffset, aSegment, aLength) <= 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    aHigh = low;
+}
+
 void CoapBase::SetDefaultHandler(otCoapRequestHandler aHandler, void *aContext)
 {
     mDefaultHandler        = aHandler;
@@ -111,11 +305,29 @@ otError CoapBase::SendMessage(Message &               aMessage,
                               const Ip6::MessageInfo &aMessageInfo,
                               otCoapResponseHandler   aHandler,
                               void *                  aContext)
+{
+    CoapMetadata coapMetadata;
+
+    coapMetadata.mResponseHandler = aHandler;
+    coapMetadata.mResponseContext = aContext;
+
+    return SendMessage(aMessage, aMessageInfo, coapMetadata);
+}
+
+otError CoapBase::SendMessage(Message &               aMessage,
+                              const Ip6::MessageInfo &aMessageInfo,
+                              const CoapMetadata &    aCoapMetadata)
 {
     otError      error;
     CoapMetadata coapMetadata;
     Message *    storedCopy = NULL;
     uint16_t     copyLength = 0;
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    Message *    observation;
+    CoapMetadata observationMetadata;
+    uint32_t     observe = 0;
+    bool         hasObserve;
+#endif
 
     switch (aMessage.GetType())
     {
@@ -132,20 +344,51 @@ otError CoapBase::SendMessage(Message &               aMessage,
 
     aMessage.Finish();
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    hasObserve = (aMessage.GetCode() == OT_COAP_CODE_GET) &&
+                 (aMessage.ReadUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NONE);
+
+    if (hasObserve && observe == 1)
+    {
+        // Deregistering ends the observation using the same token (RFC 7641, section 3.6).
+        observation = FindRelatedRequest(aMessage, aMessageInfo, observationMetadata);
+
+        if (observation != NULL && observationMetadata.mObserve)
+        {
+            FinalizeCoapTransaction(*observation, observationMetadata, NULL, NULL, OT_ERROR_ABORT);
+        }
+    }
+#endif
+
     if (aMessage.IsConfirmable())
     {
         // Create a copy of entire message and enqueue it.
         copyLength = aMessage.GetLength();
     }
-    else if (aMessage.IsNonConfirmable() && (aHandler != NULL))
+    else if (aMessage.IsNonConfirmable() && (aCoapMetadata.mResponseHandler != NULL))
     {
         // As we do not retransmit non confirmable messages, create a copy of header only, for token information.
         copyLength = aMessage.GetOptionStart();
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        if (aCoapMetadata.IsBlockwise())
+        {
+            // The following blocks are built from the request options.
+            copyLength = aMessage.GetLength();
+        }
+#endif
     }
 
     if (copyLength > 0)
     {
-        coapMetadata = CoapMetadata(aMessage.IsConfirmable(), aMessageInfo, aHandler, aContext);
+        coapMetadata = CoapMetadata(aMessage.IsConfirmable(), aMessageInfo, aCoapMetadata.mResponseHandler,
+                                    aCoapMetadata.mResponseContext);
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        coapMetadata.CopyBlockwiseStateFrom(aCoapMetadata);
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        coapMetadata.mObserve = hasObserve && (observe == 0);
+#endif
         VerifyOrExit((storedCopy = CopyAndEnqueueMessage(aMessage, copyLength, coapMetadata)) != NULL,
                      error = OT_ERROR_NO_BUFS);
     }
@@ -232,43 +475,43 @@ void CoapBase::HandleRetransmissionTimer(Timer &aTimer)
 
 void CoapBase::HandleRetransmissionTimer(void)
 {
-    TimeMilli        now      = TimerMilli::GetNow();
-    TimeMilli        nextTime = now.GetDistantFuture();
-    CoapMetadata     coapMetadata;
-    Message *        message;
-    Message *        nextMessage;
-    Ip6::MessageInfo messageInfo;
+    TimeMilli    now      = TimerMilli::GetNow();
+    TimeMilli    nextTime = now.GetDistantFuture();
+    CoapMetadata coapMetadata;
+    Message *    message;
+    Message *    nextMessage;
+
+    if (!mPendingRequestIndex.HasUnindexed())
+    {
+        // The index keeps the timer shots, only the metadata of expired requests is read.
+        while ((message = mPendingRequestIndex.FindExpired(now)) != NULL)
+        {
+            coapMetadata.ReadFrom(*message);
+            HandleRetransmissionTimeout(*message, coapMetadata, now);
+        }
+
+        nextTime = mPendingRequestIndex.GetNextTimerShot(nextTime);
+        ExitNow();
+    }
 
+    // Requests sent while the index was full are only found in the queue.
     for (message = static_cast<Message *>(mPendingRequests.GetHead()); message != NULL; message = nextMessage)
     {
         nextMessage = static_cast<Message *>(message->GetNext());
 
         coapMetadata.ReadFrom(*message);
 
-        if (now >= coapMetadata.mNextTimerShot)
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        if (coapMetadata.mObserving)
         {
-            if (!coapMetadata.mConfirmable || (coapMetadata.mRetransmissionCount >= kMaxRetransmit))
-            {
-                // No expected response or acknowledgment.
-                FinalizeCoapTransaction(*message, coapMetadata, NULL, NULL, OT_ERROR_RESPONSE_TIMEOUT);
-                continue;
-            }
-
-            // Increment retransmission counter and timer.
-            coapMetadata.mRetransmissionCount++;
-            coapMetadata.mRetransmissionTimeout *= 2;
-            coapMetadata.mNextTimerShot = now + coapMetadata.mRetransmissionTimeout;
-            coapMetadata.UpdateIn(*message);
-
-            // Retransmit
-            if (!coapMetadata.mAcknowledged)
-            {
-                messageInfo.SetPeerAddr(coapMetadata.mDestinationAddress);
-                messageInfo.SetPeerPort(coapMetadata.mDestinationPort);
-                messageInfo.SetSockAddr(coapMetadata.mSourceAddress);
+            // An established observation lasts until it is cancelled.
+            continue;
+        }
+#endif
 
-                SendCopy(*message, messageInfo);
-            }
+        if (now >= coapMetadata.mNextTimerShot)
+        {
+            HandleRetransmissionTimeout(*message, coapMetadata, now);
         }
 
         if (nextTime > coapMetadata.mNextTimerShot)
@@ -277,10 +520,54 @@ void CoapBase::HandleRetransmissionTimer(void)
         }
     }
 
+exit:
     if (nextTime < now.GetDistantFuture())
     {
-        mRetransmissionTimer.FireAt(nextTime);
+        // A response handler may have already scheduled the timer for a new request.
+        mRetransmissionTimer.FireAtIfEarlier(nextTime);
+    }
+}
+
+void CoapBase::HandleRetransmissionTimeout(Message &aMessage, CoapMetadata &aCoapMetadata, TimeMilli aNow)
+{
+    Ip6::MessageInfo messageInfo;
+
+    if (!aCoapMetadata.mConfirmable || (aCoapMetadata.mRetransmissionCount >= kMaxRetransmit))
+    {
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        if (aCoapMetadata.mConfirmable && aMessage.IsResponse())
+        {
+            // An observer not acknowledging a notification is removed (RFC 7641, section 4.5).
+            messageInfo.SetPeerAddr(aCoapMetadata.mDestinationAddress);
+            messageInfo.SetPeerPort(aCoapMetadata.mDestinationPort);
+            RemoveObserver(aMessage.GetMessageId(), messageInfo);
+        }
+#endif
+
+        // No expected response or acknowledgment.
+        FinalizeCoapTransaction(aMessage, aCoapMetadata, NULL, NULL, OT_ERROR_RESPONSE_TIMEOUT);
+        ExitNow();
+    }
+
+    // Increment retransmission counter and timer.
+    aCoapMetadata.mRetransmissionCount++;
+    aCoapMetadata.mRetransmissionTimeout *= 2;
+    aCoapMetadata.mNextTimerShot = aNow + aCoapMetadata.mRetransmissionTimeout;
+    aCoapMetadata.UpdateIn(aMessage);
+    mPendingRequestIndex.Update(aMessage, aCoapMetadata);
+
+    // Retransmit
+    if (!aCoapMetadata.mAcknowledged)
+    {
+        messageInfo.SetPeerAddr(aCoapMetadata.mDestinationAddress);
+        messageInfo.SetPeerPort(aCoapMetadata.mDestinationPort);
+        messageInfo.SetSockAddr(aCoapMetadata.mSourceAddress);
+
+        SendCopy(aMessage, messageInfo);
     }
+
+exit:
+    return;
 }
 
 void CoapBase::FinalizeCoapTransaction(Message &               aRequest,
@@ -304,6 +591,19 @@ otError CoapBase::AbortTransaction(otCoapResponseHandler aHandler, void *aContex
     Message *    nextMessage;
     CoapMetadata coapMetadata;
 
+    if (!mPendingRequestIndex.HasUnindexed())
+    {
+        while ((message = mPendingRequestIndex.FindByHandler(aHandler, aContext)) != NULL)
+        {
+            coapMetadata.ReadFrom(*message);
+            FinalizeCoapTransaction(*message, coapMetadata, NULL, NULL, OT_ERROR_ABORT);
+            error = OT_ERROR_NONE;
+        }
+
+        ExitNow();
+    }
+
+    // Requests sent while the index was full are only found in the queue.
     for (message = static_cast<Message *>(mPendingRequests.GetHead()); message != NULL; message = nextMessage)
     {
         nextMessage = static_cast<Message *>(message->GetNext());
@@ -316,6 +616,7 @@ otError CoapBase::AbortTransaction(otCoapResponseHandler aHandler, void *aContex
         }
     }
 
+exit:
     return error;
 }
 
@@ -334,8 +635,9 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
 
     mRetransmissionTimer.FireAtIfEarlier(aCoapMetadata.mNextTimerShot);
 
-    // Enqueue the message.
+    // Enqueue the message. When the index is full, responses are matched by walking the queue instead.
     mPendingRequests.Enqueue(*messageCopy);
+    mPendingRequestIndex.Add(*messageCopy, aCoapMetadata);
 
 exit:
 
@@ -350,6 +652,7 @@ exit:
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
+    mPendingRequestIndex.Remove(aMessage);
     mPendingRequests.Dequeue(aMessage);
 
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == NULL))
@@ -365,6 +668,30 @@ void CoapBase::DequeueMessage(Message &aMessage)
     // the timer would just shoot earlier and then it'd be setup again.
 }
 
+Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
+                                      const Ip6::MessageInfo &aMessageInfo,
+                                      CoapMetadata &          aCoapMetadata)
+{
+    Message *message = mPendingRequestIndex.FindRelated(aResponse, aMessageInfo, aCoapMetadata);
+
+    VerifyOrExit(message == NULL && mPendingRequestIndex.HasUnindexed());
+
+    // Requests sent while the index was full are only found in the queue.
+    for (message = static_cast<Message *>(mPendingRequests.GetHead()); message != NULL;
+         message = static_cast<Message *>(message->GetNext()))
+    {
+        aCoapMetadata.ReadFrom(*message);
+
+        if (PendingRequestIndex::IsRelated(*message, aCoapMetadata, aResponse, aMessageInfo))
+        {
+            break;
+        }
+    }
+
+exit:
+    return message;
+}
+
 otError CoapBase::SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     otError  error;
@@ -387,50 +714,6 @@ exit:
     return error;
 }
 
-Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
-                                      const Ip6::MessageInfo &aMessageInfo,
-                                      CoapMetadata &          aCoapMetadata)
-{
-    Message *message = static_cast<Message *>(mPendingRequests.GetHead());
-
-    while (message != NULL)
-    {
-        aCoapMetadata.ReadFrom(*message);
-
-        if (((aCoapMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
-             aCoapMetadata.mDestinationAddress.IsMulticast() ||
-             aCoapMetadata.mDestinationAddress.IsAnycastRoutingLocator()) &&
-            (aCoapMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
-        {
-            switch (aResponse.GetType())
-            {
-            case OT_COAP_TYPE_RESET:
-            case OT_COAP_TYPE_ACKNOWLEDGMENT:
-                if (aResponse.GetMessageId() == message->GetMessageId())
-                {
-                    ExitNow();
-                }
-
-                break;
-
-            case OT_COAP_TYPE_CONFIRMABLE:
-            case OT_COAP_TYPE_NON_CONFIRMABLE:
-                if (aResponse.IsTokenEqual(*message))
-                {
-                    ExitNow();
-                }
-
-                break;
-            }
-        }
-
-        message = static_cast<Message *>(message->GetNext());
-    }
-
-exit:
-    return message;
-}
-
 void CoapBase::Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Message &message = static_cast<Message &>(aMessage);
@@ -451,9 +734,17 @@ void CoapBase::Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
 void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    CoapMetadata coapMetadata;
     Message *    request = NULL;
-    otError      error   = OT_ERROR_NONE;
+    CoapMetadata coapMetadata;
+    otError      error = OT_ERROR_NONE;
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    if (aMessage.GetType() == OT_COAP_TYPE_RESET)
+    {
+        // An observer rejecting a notification is removed (RFC 7641, section 3.6).
+        RemoveObserver(aMessage.GetMessageId(), aMessageInfo);
+    }
+#endif
 
     request = FindRelatedRequest(aMessage, aMessageInfo, coapMetadata);
 
@@ -492,7 +783,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
         else if (aMessage.IsResponse() && aMessage.IsTokenEqual(*request))
         {
             // Piggybacked response.
-            FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+            ProcessResponseTo(*request, coapMetadata, aMessage, aMessageInfo);
         }
 
         // Silently ignore acknowledgments carrying requests (RFC 7252, p. 4.2)
@@ -502,7 +793,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
     case OT_COAP_TYPE_CONFIRMABLE:
         // Send empty ACK if it is a CON message.
         SendAck(aMessage, aMessageInfo);
-        FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+        ProcessResponseTo(*request, coapMetadata, aMessage, aMessageInfo);
         break;
 
     case OT_COAP_TYPE_NON_CONFIRMABLE:
@@ -515,7 +806,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
         }
         else
         {
-            FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+            ProcessResponseTo(*request, coapMetadata, aMessage, aMessageInfo);
         }
 
         break;
@@ -533,13 +824,49 @@ exit:
     }
 }
 
+void CoapBase::ProcessResponseTo(Message &               aRequest,
+                                 CoapMetadata &          aCoapMetadata,
+                                 Message &               aResponse,
+                                 const Ip6::MessageInfo &aMessageInfo)
+{
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    uint32_t observe;
+
+    if (aCoapMetadata.mObserve && aResponse.GetCode() >= OT_COAP_CODE_RESPONSE_MIN &&
+        aResponse.GetCode() < OT_COAP_CODE_BAD_REQUEST &&
+        aResponse.ReadUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NONE)
+    {
+        // A successful response with an Observe option keeps the observation going.
+        ProcessNotification(aRequest, aCoapMetadata, aResponse, aMessageInfo, observe);
+    }
+    else
+#endif
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    if (aCoapMetadata.IsBlockwise())
+    {
+        ProcessBlockwiseResponse(aRequest, aCoapMetadata, aResponse, aMessageInfo);
+    }
+    else
+#endif
+    {
+        FinalizeCoapTransaction(aRequest, aCoapMetadata, &aResponse, &aMessageInfo, OT_ERROR_NONE);
+    }
+}
+
 void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    char           uriPath[Resource::kMaxReceivedUriPath];
-    char *         curUriPath     = uriPath;
-    Message *      cachedResponse = NULL;
-    otError        error          = OT_ERROR_NOT_FOUND;
-    OptionIterator iterator;
+    char            uriPath[Resource::kMaxReceivedUriPath];
+    char *          curUriPath     = uriPath;
+    char            segment[Resource::kMaxReceivedUriPath];
+    bool            buildUriPath   = (mResources.GetHead() != NULL);
+    uint8_t         low            = 0;
+    uint8_t         high           = kNumWellKnownUriPaths;
+    uint16_t        offset         = 0;
+    const Resource *resource       = NULL;
+    Message *       cachedResponse = NULL;
+    otError         error          = OT_ERROR_NOT_FOUND;
+    OptionIterator  iterator;
+    Message::Cursor cursor;
 
     if (mInterceptor != NULL)
     {
@@ -562,21 +889,46 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
         break;
     }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    buildUriPath = buildUriPath || (mBlockwiseResources.GetHead() != NULL);
+#endif
+
     SuccessOrExit(error = iterator.Init(&aMessage));
-    for (const otCoapOption *option = iterator.GetFirstOption(); option != NULL; option = iterator.GetNextOption())
+    for (const otCoapOption *option = iterator.GetFirstOption(cursor); option != NULL;
+         option                     = iterator.GetNextOption(cursor))
     {
         switch (option->mNumber)
         {
         case OT_COAP_OPTION_URI_PATH:
-            if (curUriPath != uriPath)
+            VerifyOrExit(option->mLength < sizeof(segment));
+            iterator.GetOptionValue(cursor, segment);
+
+            // Match the well-known paths one segment at a time.
+            if (low < high)
             {
-                *curUriPath++ = '/';
+                if (offset != 0)
+                {
+                    NarrowWellKnownUriPaths(low, high, offset++, "/", 1);
+                }
+
+                NarrowWellKnownUriPaths(low, high, offset, segment, option->mLength);
+                offset += option->mLength;
             }
 
-            VerifyOrExit(option->mLength < sizeof(uriPath) - static_cast<size_t>(curUriPath + 1 - uriPath));
+            // The full path is only needed to match the resources in the list.
+            if (buildUriPath)
+            {
+                if (curUriPath != uriPath)
+                {
+                    *curUriPath++ = '/';
+                }
+
+                VerifyOrExit(option->mLength < sizeof(uriPath) - static_cast<size_t>(curUriPath + 1 - uriPath));
+
+                memcpy(curUriPath, segment, option->mLength);
+                curUriPath += option->mLength;
+            }
 
-            iterator.GetOptionValue(curUriPath);
-            curUriPath += option->mLength;
             break;
 
         default:
@@ -586,15 +938,40 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
 
     curUriPath[0] = '\0';
 
-    for (const Resource *resource = mResources.GetHead(); resource; resource = resource->GetNext())
+    if (low < high && sWellKnownUriPaths[low][offset] == '\0')
+    {
+        resource = mWellKnownResources[low];
+    }
+
+    for (const Resource *cur = mResources.GetHead(); resource == NULL && cur != NULL; cur = cur->GetNext())
+    {
+        if (strcmp(cur->mUriPath, uriPath) == 0)
+        {
+            resource = cur;
+        }
+    }
+
+    if (resource != NULL)
+    {
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        ProcessObserveRequest(*resource, aMessage, aMessageInfo);
+#endif
+        resource->HandleRequest(aMessage, aMessageInfo);
+        error = OT_ERROR_NONE;
+        ExitNow();
+    }
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    for (const BlockwiseResource *cur = mBlockwiseResources.GetHead(); cur != NULL; cur = cur->GetNext())
     {
-        if (strcmp(resource->mUriPath, uriPath) == 0)
+        if (strcmp(cur->mUriPath, uriPath) == 0)
         {
-            resource->HandleRequest(aMessage, aMessageInfo);
+            ProcessBlockwiseRequest(*cur, aMessage, aMessageInfo);
             error = OT_ERROR_NONE;
             ExitNow();
         }
     }
+#endif
 
     if (mDefaultHandler)
     {
@@ -620,17 +997,493 @@ exit:
     }
 }
 
-CoapMetadata::CoapMetadata(bool                    aConfirmable,
-                           const Ip6::MessageInfo &aMessageInfo,
-                           otCoapResponseHandler   aHandler,
-                           void *                  aContext)
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError CoapBase::SendMessageBlockWise(Message &                   aMessage,
+                                       const Ip6::MessageInfo &    aMessageInfo,
+                                       otCoapResponseHandler       aHandler,
+                                       void *                      aContext,
+                                       otCoapBlockSize             aBlockSize,
+                                       otCoapBlockwiseTransmitHook aTransmitHook,
+                                       otCoapBlockwiseReceiveHook  aReceiveHook)
 {
-    mSourceAddress         = aMessageInfo.GetSockAddr();
-    mDestinationPort       = aMessageInfo.GetPeerPort();
-    mDestinationAddress    = aMessageInfo.GetPeerAddr();
-    mResponseHandler       = aHandler;
-    mResponseContext       = aContext;
-    mRetransmissionCount   = 0;
+    otError      error = OT_ERROR_NONE;
+    CoapMetadata coapMetadata;
+
+    VerifyOrExit(aMessage.IsRequest(), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aTransmitHook == NULL || aMessage.IsConfirmable(), error = OT_ERROR_INVALID_ARGS);
+
+    coapMetadata.mResponseHandler = aHandler;
+    coapMetadata.mResponseContext = aContext;
+    coapMetadata.mTransmitHook    = aTransmitHook;
+    coapMetadata.mReceiveHook     = aReceiveHook;
+
+    if (aTransmitHook != NULL)
+    {
+        SuccessOrExit(error = AppendBlock(aMessage, OT_COAP_OPTION_BLOCK1, 0, aBlockSize, aTransmitHook, aContext,
+                                          &coapMetadata.mBlockHeaderLength));
+    }
+    else
+    {
+        if (aReceiveHook != NULL)
+        {
+            // Suggest the block size of the response (RFC 7959, section 2.4).
+            SuccessOrExit(error = aMessage.SetBlockOption(OT_COAP_OPTION_BLOCK2, 0, false, aBlockSize));
+        }
+
+        coapMetadata.mBlockHeaderLength = aMessage.GetLength();
+    }
+
+    error = SendMessage(aMessage, aMessageInfo, coapMetadata);
+
+exit:
+    return error;
+}
+
+otError CoapBase::AppendBlock(Message &                   aMessage,
+                              uint16_t                    aOption,
+                              uint32_t                    aNumber,
+                              otCoapBlockSize             aSize,
+                              otCoapBlockwiseTransmitHook aTransmitHook,
+                              void *                      aContext,
+                              uint16_t *                  aHeaderLength)
+{
+    otError      error       = OT_ERROR_NONE;
+    uint16_t     blockLength = Message::GetBlockLength(aSize);
+    bool         more        = false;
+    ot::Message *block       = NULL;
+
+    VerifyOrExit((block = Get<MessagePool>().New(ot::Message::kTypeIp6, 0)) != NULL, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = aTransmitHook(aContext, block, aNumber * blockLength, blockLength, &more));
+
+    // All blocks but the last one must be full (RFC 7959, section 2.2).
+    VerifyOrExit(block->GetLength() == blockLength || (!more && block->GetLength() < blockLength),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    SuccessOrExit(error = aMessage.SetBlockOption(aOption, aNumber, more, aSize));
+
+    if (aHeaderLength != NULL)
+    {
+        *aHeaderLength = aMessage.GetLength();
+    }
+
+    if (block->GetLength() > 0)
+    {
+        SuccessOrExit(error = aMessage.SetPayloadMarker());
+        SuccessOrExit(error = aMessage.AppendFrom(*block, 0, block->GetLength()));
+    }
+
+exit:
+
+    if (block != NULL)
+    {
+        block->Free();
+    }
+
+    return error;
+}
+
+void CoapBase::ProcessBlockwiseRequest(const BlockwiseResource &aResource,
+                                       Message &                aMessage,
+                                       const Ip6::MessageInfo & aMessageInfo)
+{
+    otError         error    = OT_ERROR_NONE;
+    Message *       response = NULL;
+    uint32_t        number;
+    bool            more;
+    otCoapBlockSize size;
+
+    if (aResource.mReceiveHook != NULL &&
+        aMessage.ReadBlockOption(OT_COAP_OPTION_BLOCK1, number, more, size) == OT_ERROR_NONE)
+    {
+        error = aResource.mReceiveHook(aResource.mContext, &aMessage, number * Message::GetBlockLength(size),
+                                       aMessage.GetLength() - aMessage.GetOffset(), more);
+
+        if (error != OT_ERROR_NONE)
+        {
+            SendHeaderResponse(error == OT_ERROR_NO_BUFS ? OT_COAP_CODE_REQUEST_TOO_LARGE : OT_COAP_CODE_BAD_REQUEST,
+                               aMessage, aMessageInfo);
+            error = OT_ERROR_NONE;
+            ExitNow();
+        }
+
+        // The handler is only called with the last block of the request.
+        if (more)
+        {
+            VerifyOrExit((response = NewBlockResponse(OT_COAP_CODE_CONTINUE, aMessage)) != NULL,
+                         error = OT_ERROR_NO_BUFS);
+            SuccessOrExit(error = response->AppendBlockOption(OT_COAP_OPTION_BLOCK1, number, more, size));
+            SuccessOrExit(error = SendMessage(*response, aMessageInfo));
+            ExitNow();
+        }
+    }
+    else if (aResource.mTransmitHook != NULL &&
+             aMessage.ReadBlockOption(OT_COAP_OPTION_BLOCK2, number, more, size) == OT_ERROR_NONE && number > 0)
+    {
+        // The first block was sent with the response to the request, serve the following ones.
+        VerifyOrExit((response = NewBlockResponse(OT_COAP_CODE_CONTENT, aMessage)) != NULL, error = OT_ERROR_NO_BUFS);
+        SuccessOrExit(error = AppendBlock(*response, OT_COAP_OPTION_BLOCK2, number, size, aResource.mTransmitHook,
+                                          aResource.mContext, NULL));
+        SuccessOrExit(error = SendMessage(*response, aMessageInfo));
+        ExitNow();
+    }
+
+    aResource.mHandler(aResource.mContext, &aMessage, &aMessageInfo);
+
+exit:
+
+    if (error != OT_ERROR_NONE && response != NULL)
+    {
+        response->Free();
+    }
+}
+
+Message *CoapBase::NewBlockResponse(Message::Code aCode, const Message &aRequest)
+{
+    Message *message = NewMessage();
+
+    VerifyOrExit(message != NULL);
+
+    message->Init(aRequest.IsConfirmable() ? OT_COAP_TYPE_ACKNOWLEDGMENT : OT_COAP_TYPE_NON_CONFIRMABLE, aCode);
+    message->SetMessageId(aRequest.GetMessageId());
+
+    if (message->SetToken(aRequest.GetToken(), aRequest.GetTokenLength()) != OT_ERROR_NONE)
+    {
+        message->Free();
+        message = NULL;
+    }
+
+exit:
+    return message;
+}
+
+void CoapBase::ProcessBlockwiseResponse(Message &               aRequest,
+                                        CoapMetadata &          aCoapMetadata,
+                                        Message &               aResponse,
+                                        const Ip6::MessageInfo &aMessageInfo)
+{
+    otError         error = OT_ERROR_NONE;
+    uint32_t        number;
+    uint32_t        position;
+    uint16_t        length;
+    bool            more;
+    otCoapBlockSize size;
+    uint32_t        peerNumber;
+    otCoapBlockSize peerSize;
+
+    if (aCoapMetadata.mTransmitHook != NULL && aResponse.GetCode() == OT_COAP_CODE_CONTINUE)
+    {
+        SuccessOrExit(error = aRequest.ReadBlockOption(OT_COAP_OPTION_BLOCK1, number, more, size));
+        SuccessOrExit(error = aResponse.ReadBlockOption(OT_COAP_OPTION_BLOCK1, peerNumber, more, peerSize));
+        VerifyOrExit(more, error = OT_ERROR_PARSE);
+
+        // Ignore a late response to a previous block.
+        position = number * Message::GetBlockLength(size);
+        VerifyOrExit(peerNumber * Message::GetBlockLength(peerSize) == position);
+
+        // The server may ask for smaller blocks (RFC 7959, section 2.5).
+        position += Message::GetBlockLength(size);
+        size = (peerSize < size) ? peerSize : size;
+
+        SendNextBlock(aRequest, aCoapMetadata, OT_COAP_OPTION_BLOCK1, position / Message::GetBlockLength(size), size);
+        ExitNow();
+    }
+
+    if (aCoapMetadata.mReceiveHook != NULL &&
+        aResponse.ReadBlockOption(OT_COAP_OPTION_BLOCK2, number, more, size) == OT_ERROR_NONE)
+    {
+        position = number * Message::GetBlockLength(size);
+        length   = aResponse.GetLength() - aResponse.GetOffset();
+
+        // Ignore a late response to a previous block.
+        VerifyOrExit(position == aCoapMetadata.mBlock2Position);
+        VerifyOrExit(!more || length == Message::GetBlockLength(size), error = OT_ERROR_PARSE);
+
+        SuccessOrExit(error = aCoapMetadata.mReceiveHook(aCoapMetadata.mResponseContext, &aResponse, position,
+                                                        length, more));
+
+        if (more)
+        {
+            aCoapMetadata.mBlock2Position = position + length;
+            SendNextBlock(aRequest, aCoapMetadata, OT_COAP_OPTION_BLOCK2, number + 1, size);
+            ExitNow();
+        }
+    }
+
+    FinalizeCoapTransaction(aRequest, aCoapMetadata, &aResponse, &aMessageInfo, OT_ERROR_NONE);
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        FinalizeCoapTransaction(aRequest, aCoapMetadata, NULL, NULL, error);
+    }
+}
+
+void CoapBase::SendNextBlock(Message &           aRequest,
+                             const CoapMetadata &aCoapMetadata,
+                             uint16_t            aOption,
+                             uint32_t            aNumber,
+                             otCoapBlockSize     aSize)
+{
+    otError          error        = OT_ERROR_NONE;
+    Message *        message      = NULL;
+    CoapMetadata     coapMetadata = aCoapMetadata;
+    Ip6::MessageInfo messageInfo;
+
+    // The header and options of the previous block request are repeated, with an updated block option.
+    VerifyOrExit((message = aRequest.Clone(aCoapMetadata.mBlockHeaderLength)) != NULL, error = OT_ERROR_NO_BUFS);
+
+    // The previous block is done with, the next one takes over the transaction.
+    DequeueMessage(aRequest);
+
+    message->SetOffset(0);
+    SuccessOrExit(error = message->ParseHeader());
+
+    if (aOption == OT_COAP_OPTION_BLOCK1)
+    {
+        SuccessOrExit(error = AppendBlock(*message, aOption, aNumber, aSize, aCoapMetadata.mTransmitHook,
+                                          aCoapMetadata.mResponseContext, &coapMetadata.mBlockHeaderLength));
+    }
+    else
+    {
+        SuccessOrExit(error = message->SetBlockOption(aOption, aNumber, false, aSize));
+        coapMetadata.mBlockHeaderLength = message->GetLength();
+    }
+
+    messageInfo.SetPeerAddr(aCoapMetadata.mDestinationAddress);
+    messageInfo.SetPeerPort(aCoapMetadata.mDestinationPort);
+    messageInfo.SetSockAddr(aCoapMetadata.mSourceAddress);
+
+    error = SendMessage(*message, messageInfo, coapMetadata);
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        if (message == NULL)
+        {
+            FinalizeCoapTransaction(aRequest, aCoapMetadata, NULL, NULL, error);
+        }
+        else
+        {
+            message->Free();
+
+            if (aCoapMetadata.mResponseHandler != NULL)
+            {
+                aCoapMetadata.mResponseHandler(aCoapMetadata.mResponseContext, NULL, NULL, error);
+            }
+        }
+    }
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+otError CoapBase::NotifyObservers(const Resource &aResource, const Message &aMessage)
+{
+    otError             error = OT_ERROR_NONE;
+    otError             notifyError;
+    OptionIterator      iterator;
+    const otCoapOption *option;
+    uint16_t            offset;
+
+    // The Observe option of the template is replaced, the following options are copied as they are.
+    SuccessOrExit(error = iterator.Init(&aMessage));
+    option = iterator.GetFirstOption();
+    VerifyOrExit(option != NULL && option->mNumber == OT_COAP_OPTION_OBSERVE, error = OT_ERROR_INVALID_ARGS);
+    offset = iterator.mNextOptionOffset;
+
+    for (Observer *observer = &mObservers[0]; observer < OT_ARRAY_END(mObservers); observer++)
+    {
+        if (observer->mResource != &aResource)
+        {
+            continue;
+        }
+
+        // Failing to notify one observer does not keep the others from being notified.
+        notifyError = SendNotification(*observer, aMessage, offset);
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = notifyError;
+        }
+    }
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendNotification(Observer &aObserver, const Message &aMessage, uint16_t aOffset)
+{
+    otError          error;
+    Message *        notification = NULL;
+    uint32_t         sequence     = (aObserver.mSequence + 1) & 0xffffff;
+    uint16_t         messageId    = mMessageId;
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrExit((notification = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    notification->Init(aMessage.GetType(), aMessage.GetCode());
+    SuccessOrExit(error = notification->SetToken(aObserver.mToken, aObserver.mTokenLength));
+    SuccessOrExit(error = notification->AppendObserveOption(sequence));
+    SuccessOrExit(error = notification->AppendFrom(aMessage, aOffset, aMessage.GetLength() - aOffset));
+
+    messageInfo.SetPeerAddr(aObserver.mPeerAddress);
+    messageInfo.SetPeerPort(aObserver.mPeerPort);
+    messageInfo.SetSockAddr(aObserver.mSockAddress);
+
+    SuccessOrExit(error = SendMessage(*notification, messageInfo));
+
+    // Remember the Message ID the notification is sent with, to match a reset or a timeout.
+    aObserver.mSequence  = sequence;
+    aObserver.mMessageId = messageId;
+
+exit:
+
+    if (error != OT_ERROR_NONE && notification != NULL)
+    {
+        notification->Free();
+    }
+
+    return error;
+}
+
+const Observer *CoapBase::FindObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+{
+    const Observer *observer;
+
+    for (observer = &mObservers[0]; observer < OT_ARRAY_END(mObservers); observer++)
+    {
+        if (observer->IsInUse() && observer->Matches(aRequest, aMessageInfo))
+        {
+            ExitNow();
+        }
+    }
+
+    observer = NULL;
+
+exit:
+    return observer;
+}
+
+void CoapBase::ProcessObserveRequest(const Resource &        aResource,
+                                     const Message &         aMessage,
+                                     const Ip6::MessageInfo &aMessageInfo)
+{
+    Observer *observer = FindObserver(aMessage, aMessageInfo);
+    uint32_t  observe;
+
+    VerifyOrExit(aMessage.GetCode() == OT_COAP_CODE_GET);
+
+    if (aMessage.ReadUintOption(OT_COAP_OPTION_OBSERVE, observe) != OT_ERROR_NONE || observe != 0)
+    {
+        // Any other GET using the token of an observation deregisters it (RFC 7641, section 3.6).
+        if (observer != NULL)
+        {
+            observer->mResource = NULL;
+        }
+
+        ExitNow();
+    }
+
+    for (Observer *cur = &mObservers[0]; observer == NULL && cur < OT_ARRAY_END(mObservers); cur++)
+    {
+        if (!cur->IsInUse())
+        {
+            observer = cur;
+        }
+    }
+
+    // When the table is full, the request is served without registering an observer.
+    VerifyOrExit(observer != NULL);
+
+    observer->mResource    = &aResource;
+    observer->mPeerAddress = aMessageInfo.GetPeerAddr();
+    observer->mSockAddress = aMessageInfo.GetSockAddr();
+    observer->mPeerPort    = aMessageInfo.GetPeerPort();
+    observer->mMessageId   = aMessage.GetMessageId();
+    observer->mSequence    = 0;
+    observer->mTokenLength = aMessage.GetTokenLength();
+    memcpy(observer->mToken, aMessage.GetToken(), observer->mTokenLength);
+
+exit:
+    return;
+}
+
+void CoapBase::RemoveObserver(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    // Only the last notification sent to an observer counts.
+    for (Observer *observer = &mObservers[0]; observer < OT_ARRAY_END(mObservers); observer++)
+    {
+        if (observer->IsInUse() && observer->mMessageId == aMessageId &&
+            observer->mPeerAddress == aMessageInfo.GetPeerAddr() && observer->mPeerPort == aMessageInfo.GetPeerPort())
+        {
+            observer->mResource = NULL;
+        }
+    }
+}
+
+void CoapBase::ProcessNotification(Message &               aRequest,
+                                   CoapMetadata &          aCoapMetadata,
+                                   Message &               aResponse,
+                                   const Ip6::MessageInfo &aMessageInfo,
+                                   uint32_t                aSequence)
+{
+    TimeMilli now  = TimerMilli::GetNow();
+    uint32_t  last = aCoapMetadata.mObserveSequence;
+
+    if (aCoapMetadata.mObserving)
+    {
+        // Drop notifications older than the last one received (RFC 7641, section 3.4).
+        VerifyOrExit((last < aSequence && aSequence - last < (1UL << 23)) ||
+                     (last > aSequence && last - aSequence > (1UL << 23)) ||
+                     (now - aCoapMetadata.mObserveTime >= Time::SecToMsec(kObserveFreshness)));
+    }
+
+    aCoapMetadata.mObserving       = true;
+    aCoapMetadata.mAcknowledged    = true;
+    aCoapMetadata.mObserveSequence = aSequence;
+    aCoapMetadata.mObserveTime     = now;
+    aCoapMetadata.UpdateIn(aRequest);
+    mPendingRequestIndex.Update(aRequest, aCoapMetadata);
+
+    if (aCoapMetadata.mResponseHandler != NULL)
+    {
+        aCoapMetadata.mResponseHandler(aCoapMetadata.mResponseContext, &aResponse, &aMessageInfo, OT_ERROR_NONE);
+    }
+
+exit:
+    return;
+}
+
+void CoapBase::RemoveObservers(const Resource &aResource)
+{
+    for (Observer *observer = &mObservers[0]; observer < OT_ARRAY_END(mObservers); observer++)
+    {
+        if (observer->mResource == &aResource)
+        {
+            observer->mResource = NULL;
+        }
+    }
+}
+
+bool Observer::Matches(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+{
+    return mPeerAddress == aMessageInfo.GetPeerAddr() && mPeerPort == aMessageInfo.GetPeerPort() &&
+           mTokenLength == aRequest.GetTokenLength() && memcmp(mToken, aRequest.GetToken(), mTokenLength) == 0;
+}
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+
+CoapMetadata::CoapMetadata(bool                    aConfirmable,
+                           const Ip6::MessageInfo &aMessageInfo,
+                           otCoapResponseHandler   aHandler,
+                           void *                  aContext)
+{
+    mSourceAddress         = aMessageInfo.GetSockAddr();
+    mDestinationPort       = aMessageInfo.GetPeerPort();
+    mDestinationAddress    = aMessageInfo.GetPeerAddr();
+    mResponseHandler       = aHandler;
+    mResponseContext       = aContext;
+    mRetransmissionCount   = 0;
     mRetransmissionTimeout = Time::SecToMsec(kAckTimeout);
     mRetransmissionTimeout += Random::NonCrypto::GetUint32InRange(
         0, Time::SecToMsec(kAckTimeout) * kAckRandomFactorNumerator / kAckRandomFactorDenominator -
@@ -649,6 +1502,331 @@ CoapMetadata::CoapMetadata(bool                    aConfirmable,
 
     mAcknowledged = false;
     mConfirmable  = aConfirmable;
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    mTransmitHook      = NULL;
+    mReceiveHook       = NULL;
+    mBlockHeaderLength = 0;
+    mBlock2Position    = 0;
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    mObserveSequence = 0;
+    mObserveTime     = TimeMilli(0);
+    mObserve         = false;
+    mObserving       = false;
+#endif
+}
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+void CoapMetadata::CopyBlockwiseStateFrom(const CoapMetadata &aCoapMetadata)
+{
+    mTransmitHook      = aCoapMetadata.mTransmitHook;
+    mReceiveHook       = aCoapMetadata.mReceiveHook;
+    mBlockHeaderLength = aCoapMetadata.mBlockHeaderLength;
+    mBlock2Position    = aCoapMetadata.mBlock2Position;
+}
+#endif
+
+bool CoapMetadata::MatchesPeer(const Ip6::MessageInfo &aMessageInfo) const
+{
+    return ((mDestinationAddress == aMessageInfo.GetPeerAddr()) || mDestinationAddress.IsMulticast() ||
+            mDestinationAddress.IsAnycastRoutingLocator()) &&
+           (mDestinationPort == aMessageInfo.GetPeerPort());
+}
+
+PendingRequestIndex::PendingRequestIndex(void)
+    : mFreeHead(0)
+    , mNumUnindexed(0)
+{
+    OT_STATIC_ASSERT(kNumEntries > 0 && kNumEntries < kInvalidIndex,
+                     "OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE must be between 1 and 254");
+
+    for (uint8_t index = 0; index < kNumEntries; index++)
+    {
+        mEntries[index].mRequest         = NULL;
+        mEntries[index].mNextByMessageId = index + 1;
+        mEntries[index].mNextByToken     = kInvalidIndex;
+    }
+
+    mEntries[kNumEntries - 1].mNextByMessageId = kInvalidIndex;
+
+    memset(mMessageIdHeads, kInvalidIndex, sizeof(mMessageIdHeads));
+    memset(mTokenHeads, kInvalidIndex, sizeof(mTokenHeads));
+}
+
+otError PendingRequestIndex::Add(Message &aRequest, const CoapMetadata &aCoapMetadata)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t index = mFreeHead;
+    Entry * entry;
+
+    if (index == kInvalidIndex)
+    {
+        mNumUnindexed++;
+        ExitNow(error = OT_ERROR_NO_BUFS);
+    }
+
+    // Free entries are chained through `mNextByMessageId`.
+    entry     = &mEntries[index];
+    mFreeHead = entry->mNextByMessageId;
+
+    entry->mRequest         = &aRequest;
+    entry->mResponseHandler = aCoapMetadata.mResponseHandler;
+    entry->mResponseContext = aCoapMetadata.mResponseContext;
+    entry->mNextTimerShot   = aCoapMetadata.mNextTimerShot;
+    entry->mMessageId       = aRequest.GetMessageId();
+    entry->mTokenHash       = HashToken(aRequest);
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    entry->mObserving = aCoapMetadata.mObserving;
+#endif
+
+    Link(&mMessageIdHeads[entry->mMessageId % kNumHashBuckets], &Entry::mNextByMessageId, index);
+    Link(&mTokenHeads[entry->mTokenHash % kNumHashBuckets], &Entry::mNextByToken, index);
+
+exit:
+    return error;
+}
+
+void PendingRequestIndex::Update(const Message &aRequest, const CoapMetadata &aCoapMetadata)
+{
+    uint8_t index = Find(aRequest);
+
+    VerifyOrExit(index != kInvalidIndex);
+
+    mEntries[index].mNextTimerShot = aCoapMetadata.mNextTimerShot;
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    mEntries[index].mObserving = aCoapMetadata.mObserving;
+#endif
+
+exit:
+    return;
+}
+
+void PendingRequestIndex::Remove(const Message &aRequest)
+{
+    uint8_t index = Find(aRequest);
+
+    if (index == kInvalidIndex)
+    {
+        assert(mNumUnindexed > 0);
+        mNumUnindexed--;
+        ExitNow();
+    }
+
+    Unlink(&mMessageIdHeads[mEntries[index].mMessageId % kNumHashBuckets], &Entry::mNextByMessageId, index);
+    Unlink(&mTokenHeads[mEntries[index].mTokenHash % kNumHashBuckets], &Entry::mNextByToken, index);
+
+    mEntries[index].mRequest         = NULL;
+    mEntries[index].mNextByMessageId = mFreeHead;
+    mFreeHead                        = index;
+
+exit:
+    return;
+}
+
+Message *PendingRequestIndex::FindRelated(const Message &         aResponse,
+                                          const Ip6::MessageInfo &aMessageInfo,
+                                          CoapMetadata &          aCoapMetadata)
+{
+    Message *request = NULL;
+    uint16_t hash;
+
+    switch (aResponse.GetType())
+    {
+    case OT_COAP_TYPE_RESET:
+    case OT_COAP_TYPE_ACKNOWLEDGMENT:
+        for (uint8_t index = mMessageIdHeads[aResponse.GetMessageId() % kNumHashBuckets]; index != kInvalidIndex;
+             index         = mEntries[index].mNextByMessageId)
+        {
+            if (mEntries[index].mMessageId != aResponse.GetMessageId())
+            {
+                continue;
+            }
+
+            aCoapMetadata.ReadFrom(*mEntries[index].mRequest);
+
+            if (aCoapMetadata.MatchesPeer(aMessageInfo))
+            {
+                ExitNow(request = mEntries[index].mRequest);
+            }
+        }
+
+        break;
+
+    case OT_COAP_TYPE_CONFIRMABLE:
+    case OT_COAP_TYPE_NON_CONFIRMABLE:
+        hash = HashToken(aResponse);
+
+        for (uint8_t index = mTokenHeads[hash % kNumHashBuckets]; index != kInvalidIndex;
+             index         = mEntries[index].mNextByToken)
+        {
+            if (mEntries[index].mTokenHash != hash || !aResponse.IsTokenEqual(*mEntries[index].mRequest))
+            {
+                continue;
+            }
+
+            aCoapMetadata.ReadFrom(*mEntries[index].mRequest);
+
+            if (aCoapMetadata.MatchesPeer(aMessageInfo))
+            {
+                ExitNow(request = mEntries[index].mRequest);
+            }
+        }
+
+        break;
+    }
+
+exit:
+    return request;
+}
+
+Message *PendingRequestIndex::FindExpired(TimeMilli aNow) const
+{
+    Message *request = NULL;
+
+    for (uint8_t index = 0; index < kNumEntries; index++)
+    {
+        const Entry &entry = mEntries[index];
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        if (entry.mObserving)
+        {
+            continue;
+        }
+#endif
+
+        if (entry.mRequest != NULL && aNow >= entry.mNextTimerShot)
+        {
+            ExitNow(request = entry.mRequest);
+        }
+    }
+
+exit:
+    return request;
+}
+
+TimeMilli PendingRequestIndex::GetNextTimerShot(TimeMilli aDefault) const
+{
+    TimeMilli nextTime = aDefault;
+
+    for (uint8_t index = 0; index < kNumEntries; index++)
+    {
+        const Entry &entry = mEntries[index];
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        if (entry.mObserving)
+        {
+            continue;
+        }
+#endif
+
+        if (entry.mRequest != NULL && nextTime > entry.mNextTimerShot)
+        {
+            nextTime = entry.mNextTimerShot;
+        }
+    }
+
+    return nextTime;
+}
+
+Message *PendingRequestIndex::FindByHandler(otCoapResponseHandler aHandler, const void *aContext) const
+{
+    Message *request = NULL;
+
+    for (uint8_t index = 0; index < kNumEntries; index++)
+    {
+        const Entry &entry = mEntries[index];
+
+        if (entry.mRequest != NULL && entry.mResponseHandler == aHandler && entry.mResponseContext == aContext)
+        {
+            ExitNow(request = entry.mRequest);
+        }
+    }
+
+exit:
+    return request;
+}
+
+bool PendingRequestIndex::IsRelated(const Message &         aRequest,
+                                    const CoapMetadata &    aCoapMetadata,
+                                    const Message &         aResponse,
+                                    const Ip6::MessageInfo &aMessageInfo)
+{
+    bool isRelated = false;
+
+    VerifyOrExit(aCoapMetadata.MatchesPeer(aMessageInfo));
+
+    switch (aResponse.GetType())
+    {
+    case OT_COAP_TYPE_RESET:
+    case OT_COAP_TYPE_ACKNOWLEDGMENT:
+        isRelated = (aResponse.GetMessageId() == aRequest.GetMessageId());
+        break;
+
+    case OT_COAP_TYPE_CONFIRMABLE:
+    case OT_COAP_TYPE_NON_CONFIRMABLE:
+        isRelated = aResponse.IsTokenEqual(aRequest);
+        break;
+    }
+
+exit:
+    return isRelated;
+}
+
+uint8_t PendingRequestIndex::Find(const Message &aRequest) const
+{
+    uint8_t index;
+
+    for (index = mMessageIdHeads[aRequest.GetMessageId() % kNumHashBuckets]; index != kInvalidIndex;
+         index = mEntries[index].mNextByMessageId)
+    {
+        if (mEntries[index].mRequest == &aRequest)
+        {
+            break;
+        }
+    }
+
+    return index;
+}
+
+void PendingRequestIndex::Link(uint8_t *aHead, uint8_t Entry::*aNext, uint8_t aIndex)
+{
+    uint8_t *next = aHead;
+
+    // Append at the tail so that older requests are matched first.
+    while (*next != kInvalidIndex)
+    {
+        next = &(mEntries[*next].*aNext);
+    }
+
+    *next                   = aIndex;
+    mEntries[aIndex].*aNext = kInvalidIndex;
+}
+
+void PendingRequestIndex::Unlink(uint8_t *aHead, uint8_t Entry::*aNext, uint8_t aIndex)
+{
+    for (uint8_t *next = aHead; *next != kInvalidIndex; next = &(mEntries[*next].*aNext))
+    {
+        if (*next == aIndex)
+        {
+            *next = mEntries[aIndex].*aNext;
+            break;
+        }
+    }
+}
+
+uint16_t PendingRequestIndex::HashToken(const Message &aMessage)
+{
+    const uint8_t *token = aMessage.GetToken();
+    uint16_t       hash  = 0;
+
+    for (uint8_t i = 0; i < aMessage.GetTokenLength(); i++)
+    {
+        hash = static_cast<uint16_t>((hash << 5) - hash + token[i]);
+    }
+
+    return hash;
 }
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
@@ -92,6 +92,7 @@ enum
 class CoapMetadata
 {
     friend class CoapBase;
+    friend class PendingRequestIndex;
 
 public:
     /**
@@ -106,7 +107,21 @@ public:
         , mRetransmissionTimeout(0)
         , mRetransmissionCount(0)
         , mAcknowledged(false)
-        , mConfirmable(false){};
+        , mConfirmable(false)
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        , mTransmitHook(NULL)
+        , mReceiveHook(NULL)
+        , mBlockHeaderLength(0)
+        , mBlock2Position(0)
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        , mObserveSequence(0)
+        , mObserveTime(0)
+        , mObserve(false)
+        , mObserving(false)
+#endif
+    {
+    }
 
     /**
      * This constructor initializes the object with specific values.
@@ -160,6 +175,13 @@ public:
     }
 
 private:
+    bool MatchesPeer(const Ip6::MessageInfo &aMessageInfo) const;
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    bool IsBlockwise(void) const { return mTransmitHook != NULL || mReceiveHook != NULL; }
+    void CopyBlockwiseStateFrom(const CoapMetadata &aCoapMetadata);
+#endif
+
     Ip6::Address          mSourceAddress;         ///< IPv6 address of the message source.
     Ip6::Address          mDestinationAddress;    ///< IPv6 address of the message destination.
     uint16_t              mDestinationPort;       ///< UDP port of the message destination.
@@ -170,8 +192,64 @@ private:
     uint8_t               mRetransmissionCount;   ///< Number of retransmissions.
     bool                  mAcknowledged : 1;      ///< Information that request was acknowledged.
     bool                  mConfirmable : 1;       ///< Information that message is confirmable.
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    otCoapBlockwiseTransmitHook mTransmitHook;      ///< Provides the request payload block by block (Block1).
+    otCoapBlockwiseReceiveHook  mReceiveHook;       ///< Consumes the response payload block by block (Block2).
+    uint16_t                    mBlockHeaderLength; ///< Length of the header and options of the block request.
+    uint32_t                    mBlock2Position;    ///< Offset of the next response block expected.
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    uint32_t  mObserveSequence; ///< Observe sequence number of the last notification.
+    TimeMilli mObserveTime;     ///< Time the last notification was received.
+    bool      mObserve : 1;     ///< Information that the request registers an observation.
+    bool      mObserving : 1;   ///< Information that a notification was received for the observation.
+#endif
 };
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+/**
+ * This class implements CoAP resources transferring payloads block-wise (RFC 7959).
+ *
+ */
+class BlockwiseResource : public otCoapBlockwiseResource, public LinkedListEntry<BlockwiseResource>
+{
+    friend class CoapBase;
+
+public:
+    /**
+     * This constructor initializes the resource.
+     *
+     * @param[in]  aUriPath       A pointer to a NULL-terminated string for the Uri-Path.
+     * @param[in]  aHandler       A function pointer that is called once a request for @p aUriPath is complete.
+     * @param[in]  aReceiveHook   A function pointer that is called for each received request block.
+     * @param[in]  aTransmitHook  A function pointer that is called to fill each response block.
+     * @param[in]  aContext       A pointer to arbitrary context information.
+     *
+     */
+    BlockwiseResource(const char *                aUriPath,
+                      otCoapRequestHandler        aHandler,
+                      otCoapBlockwiseReceiveHook  aReceiveHook,
+                      otCoapBlockwiseTransmitHook aTransmitHook,
+                      void *                      aContext)
+    {
+        mUriPath      = aUriPath;
+        mHandler      = aHandler;
+        mReceiveHook  = aReceiveHook;
+        mTransmitHook = aTransmitHook;
+        mContext      = aContext;
+        mNext         = NULL;
+    }
+
+    /**
+     * This method returns a pointer to the Uri-Path.
+     *
+     * @returns A pointer to the Uri-Path.
+     *
+     */
+    const char *GetUriPath(void) const { return mUriPath; }
+};
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
 /**
  * This class implements CoAP resource handling.
  *
@@ -216,6 +294,30 @@ private:
     }
 };
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+/**
+ * This class represents an observer of a CoAP resource (RFC 7641).
+ *
+ */
+class Observer
+{
+    friend class CoapBase;
+
+private:
+    bool IsInUse(void) const { return mResource != NULL; }
+    bool Matches(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+
+    const Resource *mResource;
+    Ip6::Address    mPeerAddress;
+    Ip6::Address    mSockAddress;
+    uint16_t        mPeerPort;
+    uint16_t        mMessageId;
+    uint32_t        mSequence;
+    uint8_t         mToken[OT_COAP_MAX_TOKEN_LENGTH];
+    uint8_t         mTokenLength;
+};
+#endif
+
 /**
  * This class implements metadata required for caching CoAP responses.
  *
@@ -385,6 +487,164 @@ private:
     TimerMilliContext mTimer;
 };
 
+/**
+ * This class indexes the stored copies of pending CoAP requests.
+ *
+ * The requests are kept in the pending request queue with their metadata appended. The index locates a request by
+ * Message ID or by token, so that a received response is matched without reading every stored request. Requests
+ * added while the index is full are not indexed, and are only found by walking the queue.
+ *
+ */
+class PendingRequestIndex
+{
+public:
+    /**
+     * This constructor initializes the index.
+     *
+     */
+    PendingRequestIndex(void);
+
+    /**
+     * This method adds a request to the index.
+     *
+     * @param[in]  aRequest       A reference to the stored copy of the request.
+     * @param[in]  aCoapMetadata  A reference to the metadata of @p aRequest.
+     *
+     * @retval OT_ERROR_NONE     Successfully indexed the request.
+     * @retval OT_ERROR_NO_BUFS  The index is full, the request is not indexed.
+     *
+     */
+    otError Add(Message &aRequest, const CoapMetadata &aCoapMetadata);
+
+    /**
+     * This method updates the retransmission state the index keeps for a request.
+     *
+     * It must be called whenever the timer shot or the observation state in the metadata of @p aRequest changes.
+     *
+     * @param[in]  aRequest       A reference to the stored copy of the request.
+     * @param[in]  aCoapMetadata  A reference to the metadata of @p aRequest.
+     *
+     */
+    void Update(const Message &aRequest, const CoapMetadata &aCoapMetadata);
+
+    /**
+     * This method removes a request from the index.
+     *
+     * @param[in]  aRequest  A reference to the stored copy of the request.
+     *
+     */
+    void Remove(const Message &aRequest);
+
+    /**
+     * This method finds the indexed request a given response relates to.
+     *
+     * Acknowledgments and resets are matched by Message ID, other messages by token. The peer must either be the
+     * destination of the request or the request must have been sent to a multicast or anycast RLOC destination.
+     *
+     * @param[in]   aResponse      A reference to the received response.
+     * @param[in]   aMessageInfo   A reference to the message info of @p aResponse.
+     * @param[out]  aCoapMetadata  A reference to the metadata of the matching request.
+     *
+     * @returns A pointer to the matching request, or NULL if none is found in the index.
+     *
+     */
+    Message *FindRelated(const Message &aResponse, const Ip6::MessageInfo &aMessageInfo, CoapMetadata &aCoapMetadata);
+
+    /**
+     * This method indicates whether requests were added while the index was full and are still pending.
+     *
+     * @retval TRUE   If at least one pending request is not indexed.
+     * @retval FALSE  If all pending requests are indexed.
+     *
+     */
+    bool HasUnindexed(void) const { return mNumUnindexed != 0; }
+
+    /**
+     * This method finds an indexed request whose retransmission timer has expired.
+     *
+     * Established observations are skipped, they last until they are cancelled.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     * @returns A pointer to an expired request, or NULL if none is found in the index.
+     *
+     */
+    Message *FindExpired(TimeMilli aNow) const;
+
+    /**
+     * This method returns the earliest timer shot of the indexed requests.
+     *
+     * @param[in]  aDefault  The time to return if no indexed request awaits a timer shot.
+     *
+     * @returns The earliest timer shot of the indexed requests, or @p aDefault if it is earlier.
+     *
+     */
+    TimeMilli GetNextTimerShot(TimeMilli aDefault) const;
+
+    /**
+     * This method finds an indexed request with a given response handler and context.
+     *
+     * @param[in]  aHandler  The response handler of the request.
+     * @param[in]  aContext  The response context of the request.
+     *
+     * @returns A pointer to a matching request, or NULL if none is found in the index.
+     *
+     */
+    Message *FindByHandler(otCoapResponseHandler aHandler, const void *aContext) const;
+
+    /**
+     * This method checks whether a request relates to a given response.
+     *
+     * @param[in]  aRequest       A reference to the stored copy of the request.
+     * @param[in]  aCoapMetadata  A reference to the metadata of @p aRequest.
+     * @param[in]  aResponse      A reference to the received response.
+     * @param[in]  aMessageInfo   A reference to the message info of @p aResponse.
+     *
+     * @retval TRUE   If @p aResponse relates to @p aRequest.
+     * @retval FALSE  If @p aResponse does not relate to @p aRequest.
+     *
+     */
+    static bool IsRelated(const Message &         aRequest,
+                          const CoapMetadata &    aCoapMetadata,
+                          const Message &         aResponse,
+                          const Ip6::MessageInfo &aMessageInfo);
+
+private:
+    enum
+    {
+        kNumEntries     = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE,
+        kNumHashBuckets = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE,
+        kInvalidIndex   = 0xff,
+    };
+
+    struct Entry
+    {
+        Message *             mRequest;
+        otCoapResponseHandler mResponseHandler;
+        void *                mResponseContext;
+        TimeMilli             mNextTimerShot;
+        uint16_t              mMessageId;
+        uint16_t              mTokenHash;
+        uint8_t               mNextByMessageId;
+        uint8_t               mNextByToken;
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        bool mObserving;
+#endif
+    };
+
+    uint8_t Find(const Message &aRequest) const;
+    void    Link(uint8_t *aHead, uint8_t Entry::*aNext, uint8_t aIndex);
+    void    Unlink(uint8_t *aHead, uint8_t Entry::*aNext, uint8_t aIndex);
+
+    static uint16_t HashToken(const Message &aMessage);
+
+    Entry    mEntries[kNumEntries];
+    uint8_t  mMessageIdHeads[kNumHashBuckets];
+    uint8_t  mTokenHeads[kNumHashBuckets];
+    uint8_t  mFreeHead;
+    uint16_t mNumUnindexed;
+};
+
 /**
  * This class implements the CoAP client and server.
  *
@@ -431,6 +691,9 @@ public:
     /**
      * This method adds a resource to the CoAP server.
      *
+     * Resources for the well-known Thread URI paths are dispatched through a sorted table, other resources are kept
+     * in a list. When several resources are added for the same URI path, the latest one handles its requests.
+     *
      * @param[in]  aResource  A reference to the resource.
      *
      * @retval OT_ERROR_NONE     Successfully added @p aResource.
@@ -447,6 +710,31 @@ public:
      */
     void RemoveResource(Resource &aResource);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method adds a block-wise resource to the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the resource.
+     *
+     * @retval OT_ERROR_NONE     Successfully added @p aResource.
+     * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+     *
+     */
+    otError AddBlockWiseResource(BlockwiseResource &aResource) { return mBlockwiseResources.Add(aResource); }
+
+    /**
+     * This method removes a block-wise resource from the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the resource.
+     *
+     */
+    void RemoveBlockWiseResource(BlockwiseResource &aResource)
+    {
+        mBlockwiseResources.Remove(aResource);
+        aResource.SetNext(NULL);
+    }
+#endif
+
     /* This method sets the default handler for unhandled CoAP requests.
      *
      * @param[in]  aHandler   A function pointer that shall be called when an unhandled request arrives.
@@ -455,6 +743,40 @@ public:
      */
     void SetDefaultHandler(otCoapRequestHandler aHandler, void *aContext);
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    /**
+     * This method indicates whether a request registered its sender as an observer.
+     *
+     * @param[in]  aRequest      A reference to the request.
+     * @param[in]  aMessageInfo  A reference to the message info associated with @p aRequest.
+     *
+     * @retval TRUE   The sender of @p aRequest observes a resource using the token of @p aRequest.
+     * @retval FALSE  The sender of @p aRequest does not observe a resource.
+     *
+     */
+    bool IsObserverRegistered(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+    {
+        return FindObserver(aRequest, aMessageInfo) != NULL;
+    }
+
+    /**
+     * This method sends a notification to all observers of a resource.
+     *
+     * Each observer gets a copy of @p aMessage with its token and the next Observe sequence number. The first option of
+     * @p aMessage must be an Observe option, its value is replaced. When sending to an observer fails, the other
+     * observers are still notified and the first error is returned.
+     *
+     * @param[in]  aResource  A reference to the observed resource.
+     * @param[in]  aMessage   A reference to the notification.
+     *
+     * @retval OT_ERROR_NONE          Successfully sent the notification to all observers.
+     * @retval OT_ERROR_INVALID_ARGS  The first option of @p aMessage is not an Observe option.
+     * @retval OT_ERROR_NO_BUFS       Insufficient buffers available to send the notification to some observers.
+     *
+     */
+    otError NotifyObservers(const Resource &aResource, const Message &aMessage);
+#endif
+
     /**
      * This method creates a new message with a CoAP header.
      *
@@ -489,6 +811,65 @@ public:
                         otCoapResponseHandler   aHandler = NULL,
                         void *                  aContext = NULL);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method sends a CoAP request using block-wise transfer.
+     *
+     * @p aMessage holds the request header and options only, the Block1 or Block2 option is inserted among them in
+     * order of option numbers. The request payload is pulled from @p aTransmitHook one Block1 block at a time, and a
+     * response sent with Block2 options is pushed to @p aReceiveHook one block at a time. @p aHandler is called once
+     * the whole transfer ends.
+     *
+     * @param[in]  aMessage       A reference to the message to send.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aHandler       A function pointer that shall be called on response reception or time-out.
+     * @param[in]  aContext       A pointer to arbitrary context information, also passed to the hooks.
+     * @param[in]  aBlockSize     The block size to use.
+     * @param[in]  aTransmitHook  A function pointer providing the request payload, or NULL if there is none.
+     * @param[in]  aReceiveHook   A function pointer consuming the response payload, or NULL if not used.
+     *
+     * @retval OT_ERROR_NONE          Successfully sent the first block of the request.
+     * @retval OT_ERROR_INVALID_ARGS  @p aMessage is not a request, has a payload, or is not confirmable while
+     *                                @p aTransmitHook is set.
+     * @retval OT_ERROR_NO_BUFS       Failed to allocate the block or the retransmission data.
+     *
+     */
+    otError SendMessageBlockWise(Message &                   aMessage,
+                                 const Ip6::MessageInfo &    aMessageInfo,
+                                 otCoapResponseHandler       aHandler,
+                                 void *                      aContext,
+                                 otCoapBlockSize             aBlockSize,
+                                 otCoapBlockwiseTransmitHook aTransmitHook,
+                                 otCoapBlockwiseReceiveHook  aReceiveHook);
+
+    /**
+     * This method sends the first block of a CoAP response using block-wise transfer.
+     *
+     * @p aMessage holds the response header and options only. The following blocks are served by the transmit hook of
+     * the block-wise resource the client requests them from.
+     *
+     * @param[in]  aMessage       A reference to the response to send.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+     * @param[in]  aBlockSize     The block size to use.
+     * @param[in]  aTransmitHook  A function pointer providing the response payload.
+     *
+     * @retval OT_ERROR_NONE     Successfully sent the first block of the response.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the response.
+     *
+     */
+    otError SendResponseBlockWise(Message &                   aMessage,
+                                  const Ip6::MessageInfo &    aMessageInfo,
+                                  void *                      aContext,
+                                  otCoapBlockSize             aBlockSize,
+                                  otCoapBlockwiseTransmitHook aTransmitHook)
+    {
+        otError error = AppendBlock(aMessage, OT_COAP_OPTION_BLOCK2, 0, aBlockSize, aTransmitHook, aContext, NULL);
+
+        return (error == OT_ERROR_NONE) ? SendMessage(aMessage, aMessageInfo) : error;
+    }
+#endif
+
     /**
      * This method sends a CoAP reset message.
      *
@@ -632,8 +1013,27 @@ protected:
     void Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
+    enum
+    {
+        kNumWellKnownUriPaths = 32, ///< Number of well-known Thread URI paths.
+        kNotWellKnownUriPath  = 0xff,
+        kMaxObservers         = OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS,
+        kObserveFreshness     = 128, ///< Seconds after which a notification is always fresh (RFC 7641).
+    };
+
+    static const char *const sWellKnownUriPaths[];
+
+    static uint8_t FindWellKnownUriPath(const char *aUriPath);
+    static int     CompareUriPathSegment(const char *aUriPath, const char *aSegment, uint16_t aLength);
+    static void    NarrowWellKnownUriPaths(uint8_t &   aLow,
+                                           uint8_t &   aHigh,
+                                           uint16_t    aOffset,
+                                           const char *aSegment,
+                                           uint16_t    aLength);
+
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
+    void        HandleRetransmissionTimeout(Message &aMessage, CoapMetadata &aCoapMetadata, TimeMilli aNow);
 
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const CoapMetadata &aCoapMetadata);
     void     DequeueMessage(Message &aMessage);
@@ -648,6 +1048,54 @@ private:
 
     void ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void ProcessResponseTo(Message &               aRequest,
+                           CoapMetadata &          aCoapMetadata,
+                           Message &               aResponse,
+                           const Ip6::MessageInfo &aMessageInfo);
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    otError  AppendBlock(Message &                   aMessage,
+                         uint16_t                    aOption,
+                         uint32_t                    aNumber,
+                         otCoapBlockSize             aSize,
+                         otCoapBlockwiseTransmitHook aTransmitHook,
+                         void *                      aContext,
+                         uint16_t *                  aHeaderLength);
+    Message *NewBlockResponse(Message::Code aCode, const Message &aRequest);
+    void     ProcessBlockwiseRequest(const BlockwiseResource &aResource,
+                                     Message &                aMessage,
+                                     const Ip6::MessageInfo & aMessageInfo);
+    void     ProcessBlockwiseResponse(Message &               aRequest,
+                                      CoapMetadata &          aCoapMetadata,
+                                      Message &               aResponse,
+                                      const Ip6::MessageInfo &aMessageInfo);
+    void     SendNextBlock(Message &           aRequest,
+                           const CoapMetadata &aCoapMetadata,
+                           uint16_t            aOption,
+                           uint32_t            aNumber,
+                           otCoapBlockSize     aSize);
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    const Observer *FindObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+    Observer *      FindObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+    {
+        return const_cast<Observer *>(static_cast<const CoapBase *>(this)->FindObserver(aRequest, aMessageInfo));
+    }
+    void ProcessObserveRequest(const Resource &        aResource,
+                               const Message &         aMessage,
+                               const Ip6::MessageInfo &aMessageInfo);
+    otError SendNotification(Observer &aObserver, const Message &aMessage, uint16_t aOffset);
+    void    RemoveObserver(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+    void ProcessNotification(Message &               aRequest,
+                             CoapMetadata &          aCoapMetadata,
+                             Message &               aResponse,
+                             const Ip6::MessageInfo &aMessageInfo,
+                             uint32_t                aSequence);
+    void RemoveObservers(const Resource &aResource);
+#endif
+
+    otError SendMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo, const CoapMetadata &aCoapMetadata);
 
     otError SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError SendEmptyMessage(Message::Type aType, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
@@ -667,11 +1115,21 @@ private:
         return mSender(*this, aMessage, aMessageInfo);
     }
 
-    MessageQueue      mPendingRequests;
-    uint16_t          mMessageId;
-    TimerMilliContext mRetransmissionTimer;
+    MessageQueue        mPendingRequests;
+    PendingRequestIndex mPendingRequestIndex;
+    uint16_t            mMessageId;
+    TimerMilliContext   mRetransmissionTimer;
 
     LinkedList<Resource> mResources;
+    Resource *           mWellKnownResources[kNumWellKnownUriPaths];
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    LinkedList<BlockwiseResource> mBlockwiseResources;
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    Observer mObservers[kMaxObservers];
+#endif
 
     void *         mContext;
     Interceptor    mInterceptor;
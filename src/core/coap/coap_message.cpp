@@ -78,6 +78,19 @@ void Message::Finish(void)
 }
 
 otError Message::AppendOption(uint16_t aNumber, uint16_t aLength, const void *aValue)
+{
+    otError error;
+
+    SuccessOrExit(error = AppendOptionHeader(aNumber, aLength));
+    SuccessOrExit(error = Append(aValue, aLength));
+
+    GetHelpData().mHeaderLength = GetLength();
+
+exit:
+    return error;
+}
+
+otError Message::AppendOptionHeader(uint16_t aNumber, uint16_t aLength)
 {
     otError  error       = OT_ERROR_NONE;
     uint16_t optionDelta = aNumber - GetHelpData().mOptionLast;
@@ -131,13 +144,80 @@ otError Message::AppendOption(uint16_t aNumber, uint16_t aLength, const void *aV
     }
 
     SuccessOrExit(error = Append(buf, static_cast<uint16_t>(cur - buf)));
-    SuccessOrExit(error = Append(aValue, aLength));
 
     GetHelpData().mOptionLast = aNumber;
 
+exit:
+    return error;
+}
+
+otError Message::SetOption(uint16_t aNumber, uint16_t aLength, const void *aValue)
+{
+    otError             error      = OT_ERROR_NONE;
+    uint16_t            optionLast = GetHelpData().mOptionLast;
+    uint16_t            previous   = 0;
+    uint16_t            start      = GetHelpData().mHeaderOffset + GetOptionStart();
+    uint16_t            nextNumber = 0;
+    uint16_t            nextLength = 0;
+    uint16_t            nextOffset = 0;
+    OptionIterator      iterator;
+    Message::Cursor     cursor;
+    const otCoapOption *option;
+    Message *           options = NULL;
+
+    // The options must not be followed by a payload.
+    VerifyOrExit(GetLength() == GetHelpData().mHeaderLength, error = OT_ERROR_INVALID_ARGS);
+
+    VerifyOrExit(aNumber <= optionLast, error = AppendOption(aNumber, aLength, aValue));
+    VerifyOrExit(GetLength() + kMaxOptionHeaderSize + aLength < kMaxHeaderLength, error = OT_ERROR_NO_BUFS);
+
+    // Find the options before and after the new one, any option with the same number is replaced.
+    SuccessOrExit(error = iterator.Init(this));
+
+    for (option = iterator.GetFirstOption(cursor); option != NULL; option = iterator.GetNextOption(cursor))
+    {
+        if (option->mNumber < aNumber)
+        {
+            previous = option->mNumber;
+            start    = iterator.mNextOptionOffset;
+        }
+        else if (option->mNumber > aNumber && nextOffset == 0)
+        {
+            nextNumber = option->mNumber;
+            nextLength = option->mLength;
+            nextOffset = iterator.mNextOptionOffset - option->mLength;
+        }
+    }
+
+    // A payload marker may have been set without a payload.
+    VerifyOrExit(iterator.mNextOptionOffset == GetLength(), error = OT_ERROR_INVALID_ARGS);
+
+    if (nextOffset != 0)
+    {
+        VerifyOrExit((options = Clone()) != NULL, error = OT_ERROR_NO_BUFS);
+    }
+
+    SuccessOrExit(error = SetLength(start));
+    GetHelpData().mOptionLast = previous;
+    SuccessOrExit(error = AppendOption(aNumber, aLength, aValue));
+
+    if (nextOffset != 0)
+    {
+        // Only the delta of the following option changes, the remaining options are copied as they are.
+        SuccessOrExit(error = AppendOptionHeader(nextNumber, nextLength));
+        SuccessOrExit(error = AppendFrom(*options, nextOffset, options->GetLength() - nextOffset));
+        GetHelpData().mOptionLast = optionLast;
+    }
+
     GetHelpData().mHeaderLength = GetLength();
 
 exit:
+
+    if (options != NULL)
+    {
+        options->Free();
+    }
+
     return error;
 }
 
@@ -169,6 +249,79 @@ otError Message::AppendObserveOption(uint32_t aObserve)
     return AppendUintOption(OT_COAP_OPTION_OBSERVE, aObserve & 0xFFFFFF);
 }
 
+otError Message::AppendBlockOption(uint16_t aNumber, uint32_t aBlockNumber, bool aMore, otCoapBlockSize aSize)
+{
+    return AppendUintOption(aNumber, (aBlockNumber << kBlockNumberOffset) | (aMore ? kBlockMoreFlag : 0) | aSize);
+}
+
+otError Message::SetBlockOption(uint16_t aNumber, uint32_t aBlockNumber, bool aMore, otCoapBlockSize aSize)
+{
+    uint8_t value[sizeof(uint32_t)];
+    uint8_t length = sizeof(value);
+
+    Encoding::BigEndian::WriteUint32((aBlockNumber << kBlockNumberOffset) | (aMore ? kBlockMoreFlag : 0) | aSize,
+                                     value);
+
+    // Skip preceding zeros, as with any unsigned integer option.
+    while (length > 0 && value[sizeof(value) - length] == 0)
+    {
+        length--;
+    }
+
+    return SetOption(aNumber, length, &value[sizeof(value) - length]);
+}
+
+otError Message::ReadUintOption(uint16_t aNumber, uint32_t &aValue) const
+{
+    otError             error = OT_ERROR_NOT_FOUND;
+    OptionIterator      iterator;
+    const otCoapOption *option;
+    uint8_t             buf[sizeof(uint32_t)];
+
+    SuccessOrExit(error = iterator.Init(this));
+
+    for (option = iterator.GetFirstOption(); option != NULL; option = iterator.GetNextOption())
+    {
+        if (option->mNumber == aNumber)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(option != NULL, error = (iterator.mNextOptionOffset > 0) ? OT_ERROR_NOT_FOUND : OT_ERROR_PARSE);
+    VerifyOrExit(option->mLength <= sizeof(buf), error = OT_ERROR_PARSE);
+    SuccessOrExit(error = iterator.GetOptionValue(buf));
+
+    aValue = 0;
+
+    for (uint16_t i = 0; i < option->mLength; i++)
+    {
+        aValue = (aValue << 8) | buf[i];
+    }
+
+exit:
+    return error;
+}
+
+otError Message::ReadBlockOption(uint16_t aNumber, uint32_t &aBlockNumber, bool &aMore, otCoapBlockSize &aSize) const
+{
+    otError  error;
+    uint32_t value;
+
+    SuccessOrExit(error = ReadUintOption(aNumber, value));
+
+    // The block number is at most 20 bits and the size exponent 7 is reserved (RFC 7959, section 2.2).
+    VerifyOrExit(value <= kBlockMaxValue && (value & kBlockSizeMask) <= OT_COAP_BLOCK_SIZE_1024,
+                 error = OT_ERROR_PARSE);
+
+    aBlockNumber = value >> kBlockNumberOffset;
+    aMore        = (value & kBlockMoreFlag) != 0;
+    aSize        = static_cast<otCoapBlockSize>(value & kBlockSizeMask);
+
+exit:
+    return error;
+}
+
 otError Message::AppendUriPathOptions(const char *aUriPath)
 {
     otError     error = OT_ERROR_NONE;
@@ -225,8 +378,9 @@ exit:
 
 otError Message::ParseHeader(void)
 {
-    otError        error = OT_ERROR_NONE;
-    OptionIterator iterator;
+    otError         error = OT_ERROR_NONE;
+    OptionIterator  iterator;
+    Message::Cursor cursor;
 
     assert(mBuffer.mHead.mInfo.mReserved >=
            sizeof(GetHelpData()) +
@@ -238,8 +392,11 @@ otError Message::ParseHeader(void)
     Read(GetHelpData().mHeaderOffset, sizeof(GetHelpData().mHeader), &GetHelpData().mHeader);
 
     SuccessOrExit(error = iterator.Init(this));
-    for (const otCoapOption *option = iterator.GetFirstOption(); option != NULL; option = iterator.GetNextOption())
+    for (const otCoapOption *option = iterator.GetFirstOption(cursor); option != NULL;
+         option                     = iterator.GetNextOption(cursor))
     {
+        // Keep track of the last option so that options may still be appended in order.
+        GetHelpData().mOptionLast = option->mNumber;
     }
 
     VerifyOrExit(iterator.mNextOptionOffset > 0, error = OT_ERROR_PARSE);
@@ -344,6 +501,9 @@ const char *Message::CodeToString(void) const
     case OT_COAP_CODE_CHANGED:
         codeString = "Changed";
         break;
+    case OT_COAP_CODE_CONTINUE:
+        codeString = "Continue";
+        break;
     case OT_COAP_CODE_BAD_REQUEST:
         codeString = "BadRequest";
         break;
@@ -413,6 +573,13 @@ exit:
 }
 
 const otCoapOption *OptionIterator::GetFirstOption(void)
+{
+    Message::Cursor cursor;
+
+    return GetFirstOption(cursor);
+}
+
+const otCoapOption *OptionIterator::GetFirstOption(Message::Cursor &aCursor)
 {
     const otCoapOption *option  = NULL;
     const Message &     message = GetMessage();
@@ -423,13 +590,21 @@ const otCoapOption *OptionIterator::GetFirstOption(void)
 
     if (mNextOptionOffset < message.GetLength())
     {
-        option = GetNextOption();
+        aCursor.Init(message, mNextOptionOffset);
+        option = GetNextOption(aCursor);
     }
 
     return option;
 }
 
 const otCoapOption *OptionIterator::GetNextOption(void)
+{
+    Message::Cursor cursor(GetMessage(), mNextOptionOffset);
+
+    return GetNextOption(cursor);
+}
+
+const otCoapOption *OptionIterator::GetNextOption(Message::Cursor &aCursor)
 {
     otError        error = OT_ERROR_NONE;
     uint16_t       optionDelta;
@@ -441,10 +616,14 @@ const otCoapOption *OptionIterator::GetNextOption(void)
 
     VerifyOrExit(mNextOptionOffset < message.GetLength(), error = OT_ERROR_NOT_FOUND);
 
-    message.Read(mNextOptionOffset, sizeof(buf), buf);
+    aCursor.Seek(mNextOptionOffset);
+    aCursor.Read(buf, sizeof(uint8_t));
 
     optionDelta  = buf[0] >> 4;
     optionLength = buf[0] & 0xf;
+
+    // Read only the extended delta/length bytes so the cursor ends up at the start of the option value.
+    aCursor.Read(cur, GetExtensionSize(optionDelta) + GetExtensionSize(optionLength));
     mNextOptionOffset += sizeof(uint8_t);
 
     if (optionDelta < Message::kOption1ByteExtension)
@@ -525,5 +704,18 @@ exit:
     return error;
 }
 
+otError OptionIterator::GetOptionValue(Message::Cursor &aCursor, void *aValue) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mNextOptionOffset > 0, error = OT_ERROR_NOT_FOUND);
+
+    SuccessOrExit(error = aCursor.Seek(mNextOptionOffset - mOption.mLength));
+    VerifyOrExit(aCursor.Read(aValue, mOption.mLength) == mOption.mLength, error = OT_ERROR_PARSE);
+
+exit:
+    return error;
+}
+
 } // namespace Coap
 } // namespace ot
@@ -285,6 +285,23 @@ public:
      */
     otError AppendOption(uint16_t aNumber, uint16_t aLength, const void *aValue);
 
+    /**
+     * This method sets a CoAP option which is not repeatable.
+     *
+     * Unlike `AppendOption()`, the option is inserted in order of option numbers even after options with a higher
+     * number, and it replaces an existing option with the same number. The message must not have a payload yet.
+     *
+     * @param[in]  aNumber  The CoAP Option number.
+     * @param[in]  aLength  The CoAP Option length.
+     * @param[in]  aValue   A pointer to the CoAP Option value.
+     *
+     * @retval OT_ERROR_NONE          Successfully set the option.
+     * @retval OT_ERROR_INVALID_ARGS  The message already has a payload.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     *
+     */
+    otError SetOption(uint16_t aNumber, uint16_t aLength, const void *aValue);
+
     /**
      * This method appends an unsigned integer CoAP option as specified in
      * https://tools.ietf.org/html/rfc7252#section-3.2
@@ -323,6 +340,74 @@ public:
      */
     otError AppendObserveOption(uint32_t aObserve);
 
+    /**
+     * This method appends a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]  aNumber       The option number, either `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aBlockNumber  The block number.
+     * @param[in]  aMore         TRUE if more blocks follow, FALSE otherwise.
+     * @param[in]  aSize         The block size.
+     *
+     * @retval OT_ERROR_NONE          Successfully appended the option.
+     * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     *
+     */
+    otError AppendBlockOption(uint16_t aNumber, uint32_t aBlockNumber, bool aMore, otCoapBlockSize aSize);
+
+    /**
+     * This method sets a Block1 or Block2 option (RFC 7959), in order of option numbers (see `SetOption()`).
+     *
+     * @param[in]  aNumber       The option number, either `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aBlockNumber  The block number.
+     * @param[in]  aMore         TRUE if more blocks follow, FALSE otherwise.
+     * @param[in]  aSize         The block size.
+     *
+     * @retval OT_ERROR_NONE          Successfully set the option.
+     * @retval OT_ERROR_INVALID_ARGS  The message already has a payload.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     *
+     */
+    otError SetBlockOption(uint16_t aNumber, uint32_t aBlockNumber, bool aMore, otCoapBlockSize aSize);
+
+    /**
+     * This method reads the value of an unsigned integer CoAP option.
+     *
+     * @param[in]   aNumber  The CoAP Option number.
+     * @param[out]  aValue   A reference to output the option value.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option value.
+     * @retval OT_ERROR_NOT_FOUND  The message has no such option.
+     * @retval OT_ERROR_PARSE      The option is longer than four bytes or the header could not be parsed.
+     *
+     */
+    otError ReadUintOption(uint16_t aNumber, uint32_t &aValue) const;
+
+    /**
+     * This method reads a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]   aNumber       The option number, either `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[out]  aBlockNumber  A reference to output the block number.
+     * @param[out]  aMore         A reference to output whether more blocks follow.
+     * @param[out]  aSize         A reference to output the block size.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option.
+     * @retval OT_ERROR_NOT_FOUND  The message has no such option.
+     * @retval OT_ERROR_PARSE      The option is malformed.
+     *
+     */
+    otError ReadBlockOption(uint16_t aNumber, uint32_t &aBlockNumber, bool &aMore, otCoapBlockSize &aSize) const;
+
+    /**
+     * This static method returns the number of bytes in a block of a given size.
+     *
+     * @param[in]  aSize  The block size.
+     *
+     * @returns The number of bytes in a block of size @p aSize.
+     *
+     */
+    static uint16_t GetBlockLength(otCoapBlockSize aSize) { return static_cast<uint16_t>(16 << aSize); }
+
     /**
      * This method appends a Uri-Path option.
      *
@@ -544,6 +629,11 @@ private:
         kOption1ByteExtensionOffset = 13,  ///< Delta/Length offset as specified (RFC 7252).
         kOption2ByteExtensionOffset = 269, ///< Delta/Length offset as specified (RFC 7252).
 
+        kBlockSizeMask     = 0x07,     ///< Block SZX mask as specified (RFC 7959).
+        kBlockMoreFlag     = 0x08,     ///< Block M flag as specified (RFC 7959).
+        kBlockNumberOffset = 4,        ///< Block NUM offset as specified (RFC 7959).
+        kBlockMaxValue     = 0xffffff, ///< Maximum Block option value (RFC 7959).
+
         kHelpDataAlignment = sizeof(uint16_t), ///< Alignment of help data.
     };
 
@@ -583,6 +673,8 @@ private:
     }
 
     HelpData &GetHelpData(void) { return const_cast<HelpData &>(static_cast<const Message *>(this)->GetHelpData()); }
+
+    otError AppendOptionHeader(uint16_t aNumber, uint16_t aLength);
 };
 
 class OptionIterator : public ::otCoapOptionIterator
@@ -604,6 +696,18 @@ public:
      */
     const otCoapOption *GetFirstOption(void);
 
+    /**
+     * This method returns a pointer to the first option and initializes a message cursor for use with subsequent
+     * calls to `GetNextOption(Message::Cursor &)` and `GetOptionValue(Message::Cursor &, void *)`.
+     *
+     * Iterating with a cursor avoids walking the message buffer chain from the head for every option.
+     *
+     * @param[out]  aCursor  A reference to a message cursor.
+     *
+     * @returns A pointer to the first option. If no option is present NULL pointer is returned.
+     */
+    const otCoapOption *GetFirstOption(Message::Cursor &aCursor);
+
     /**
      * This method returns a pointer to the next option.
      *
@@ -611,6 +715,15 @@ public:
      */
     const otCoapOption *GetNextOption(void);
 
+    /**
+     * This method returns a pointer to the next option, continuing from a message cursor.
+     *
+     * @param[inout]  aCursor  A reference to a message cursor initialized by `GetFirstOption(Message::Cursor &)`.
+     *
+     * @returns A pointer to the next option. If no more options are present NULL pointer is returned.
+     */
+    const otCoapOption *GetNextOption(Message::Cursor &aCursor);
+
     /**
      * This function fills current option value into @p aValue.
      *
@@ -620,7 +733,26 @@ public:
      */
     otError GetOptionValue(void *aValue) const;
 
+    /**
+     * This function fills current option value into @p aValue, reading through a message cursor.
+     *
+     * @param[inout]  aCursor  A reference to a message cursor initialized by `GetFirstOption(Message::Cursor &)`.
+     * @param[out]    aValue   A pointer to a buffer to output the option value.
+     *
+     * @retval  OT_ERROR_NONE       Successfully filled value.
+     * @retval  OT_ERROR_NOT_FOUND  No more options, mNextOptionOffset is set to offset of payload.
+     *
+     */
+    otError GetOptionValue(Message::Cursor &aCursor, void *aValue) const;
+
 private:
+    static uint8_t GetExtensionSize(uint16_t aNibble)
+    {
+        return (aNibble == Message::kOption1ByteExtension)
+                   ? sizeof(uint8_t)
+                   : ((aNibble == Message::kOption2ByteExtension) ? sizeof(uint16_t) : 0);
+    }
+
     void           ClearOption(void) { memset(&mOption, 0, sizeof(mOption)); }
     const Message &GetMessage(void) const { return *static_cast<const Message *>(mMessage); }
 };
@@ -226,6 +226,7 @@ otError Message::ResizeMessage(uint16_t aLength)
     lastBuffer = curBuffer;
     curBuffer  = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(NULL);
+    SetTailBuffer(lastBuffer);
 
     GetMessagePool()->FreeBuffers(curBuffer);
 
@@ -267,20 +268,16 @@ otError Message::SetLength(uint16_t aLength)
     otError  error              = OT_ERROR_NONE;
     uint16_t totalLengthRequest = GetReserved() + aLength;
     uint16_t totalLengthCurrent = GetReserved() + GetLength();
-    int      bufs               = 0;
+    int      bufs;
 
     VerifyOrExit(totalLengthRequest >= GetReserved(), error = OT_ERROR_INVALID_ARGS);
 
-    if (totalLengthRequest > kHeadBufferDataSize)
+    if (aLength > GetLength())
     {
-        bufs = (((totalLengthRequest - kHeadBufferDataSize) - 1) / kBufferDataSize) + 1;
-    }
-
-    if (totalLengthCurrent > kHeadBufferDataSize)
-    {
-        bufs -= (((totalLengthCurrent - kHeadBufferDataSize) - 1) / kBufferDataSize) + 1;
+        ExitNow(error = Extend(aLength - GetLength()));
     }
 
+    bufs = GetBufferCountFor(totalLengthRequest) - GetBufferCountFor(totalLengthCurrent);
     SuccessOrExit(error = GetMessagePool()->ReclaimBuffers(bufs, GetPriority()));
 
     SuccessOrExit(error = ResizeMessage(totalLengthRequest));
@@ -386,16 +383,76 @@ exit:
     return error;
 }
 
+otError Message::Extend(uint16_t aLength)
+{
+    otError  error       = OT_ERROR_NONE;
+    uint32_t totalLength = static_cast<uint32_t>(GetReserved()) + GetLength() + aLength;
+    Buffer * lastBuffer  = GetTailBuffer();
+    Buffer * curBuffer   = lastBuffer;
+    int      bufs;
+
+    VerifyOrExit(totalLength <= UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
+
+    bufs = GetBufferCountFor(static_cast<uint16_t>(totalLength)) - GetBufferCountFor(GetReserved() + GetLength());
+    SuccessOrExit(error = GetMessagePool()->ReclaimBuffers(bufs, GetPriority()));
+
+    for (; bufs > 0; bufs--)
+    {
+        Buffer *newBuffer = GetMessagePool()->NewBuffer(GetPriority());
+
+        if (newBuffer == NULL)
+        {
+            GetMessagePool()->FreeBuffers(lastBuffer->GetNextBuffer());
+            lastBuffer->SetNextBuffer(NULL);
+            ExitNow(error = OT_ERROR_NO_BUFS);
+        }
+
+        curBuffer->SetNextBuffer(newBuffer);
+        curBuffer = newBuffer;
+    }
+
+    SetTailBuffer(curBuffer);
+    mBuffer.mHead.mInfo.mLength += aLength;
+
+exit:
+    return error;
+}
+
 otError Message::Append(const void *aBuf, uint16_t aLength)
 {
-    otError  error     = OT_ERROR_NONE;
-    uint16_t oldLength = GetLength();
-    int      bytesWritten;
+    otError        error = OT_ERROR_NONE;
+    WritableCursor cursor;
+    uint16_t       bytesWritten;
+
+    cursor.InitAtEnd(*this);
+    SuccessOrExit(error = Extend(aLength));
+    bytesWritten = cursor.Write(aBuf, aLength);
+
+    assert(bytesWritten == aLength);
+    OT_UNUSED_VARIABLE(bytesWritten);
+
+exit:
+    return error;
+}
+
+otError Message::AppendFrom(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    otError        error = OT_ERROR_NONE;
+    Cursor         source;
+    WritableCursor destination;
+    uint16_t       bytesWritten;
+
+    VerifyOrExit(aOffset <= aMessage.GetLength() && aLength <= aMessage.GetLength() - aOffset,
+                 error = OT_ERROR_INVALID_ARGS);
+
+    destination.InitAtEnd(*this);
+    SuccessOrExit(error = Extend(aLength));
 
-    SuccessOrExit(error = SetLength(GetLength() + aLength));
-    bytesWritten = Write(oldLength, aLength, aBuf);
+    // Initialize the source after growing, in case it is this message.
+    source.Init(aMessage, aOffset);
+    bytesWritten = destination.WriteFrom(source, aLength);
 
-    assert(bytesWritten == (int)aLength);
+    assert(bytesWritten == aLength);
     OT_UNUSED_VARIABLE(bytesWritten);
 
 exit:
@@ -414,6 +471,11 @@ otError Message::Prepend(const void *aBuf, uint16_t aLength)
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
 
+        if (GetTailBuffer() == this)
+        {
+            SetTailBuffer(newBuffer);
+        }
+
         if (GetReserved() < sizeof(mBuffer.mHead.mData))
         {
             // Copy payload from the first buffer.
@@ -454,173 +516,285 @@ void Message::RemoveHeader(uint16_t aLength)
     }
 }
 
-uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+template <typename MessageType, typename BufferType, typename DataType>
+Message::CursorBase<MessageType, BufferType, DataType>::CursorBase(void)
+    : mMessage(NULL)
+    , mBuffer(NULL)
+    , mStart(NULL)
+    , mData(NULL)
+    , mEnd(NULL)
+    , mOffset(0)
 {
-    Buffer * curBuffer;
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
+}
 
-    if (aOffset >= GetLength())
-    {
-        ExitNow();
-    }
+template <typename MessageType, typename BufferType, typename DataType>
+void Message::CursorBase<MessageType, BufferType, DataType>::Init(MessageType &aMessage, uint16_t aOffset)
+{
+    mMessage = &aMessage;
+    Rewind();
+    Skip(aOffset);
+}
 
-    if (aOffset + aLength >= GetLength())
-    {
-        aLength = GetLength() - aOffset;
-    }
+void Message::WritableCursor::InitAtEnd(Message &aMessage)
+{
+    uint16_t totalLength = aMessage.GetReserved() + aMessage.GetLength();
 
-    aOffset += GetReserved();
+    mMessage = &aMessage;
+    mBuffer  = aMessage.GetTailBuffer();
+    mOffset  = aMessage.GetLength();
 
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    // The buffer chain holds exactly the buffers needed for the reserved header and the message bytes, so the fill
+    // level of the tail buffer follows from the total length.
+    if (mBuffer == &aMessage)
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
+        mStart = mBuffer->GetFirstData();
+        mEnd   = mStart + kHeadBufferDataSize;
+        mData  = mStart + totalLength;
+    }
+    else
+    {
+        mStart = mBuffer->GetData();
+        mEnd   = mStart + kBufferDataSize;
+        mData  = mStart + ((totalLength - kHeadBufferDataSize - 1) % kBufferDataSize) + 1;
+    }
+}
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
+template <typename MessageType, typename BufferType, typename DataType>
+uint16_t Message::CursorBase<MessageType, BufferType, DataType>::GetBytesRemaining(void) const
+{
+    return (mMessage != NULL && mOffset < mMessage->GetLength()) ? mMessage->GetLength() - mOffset : 0;
+}
 
-        memcpy(aBuf, GetFirstData() + aOffset, bytesToCopy);
+template <typename MessageType, typename BufferType, typename DataType>
+otError Message::CursorBase<MessageType, BufferType, DataType>::Seek(uint16_t aOffset)
+{
+    otError error = OT_ERROR_NONE;
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
+    VerifyOrExit(mMessage != NULL && aOffset <= mMessage->GetLength(), error = OT_ERROR_INVALID_ARGS);
 
-        aOffset = 0;
+    if (aOffset >= mOffset)
+    {
+        Advance(aOffset - mOffset);
+    }
+    else if (mOffset - aOffset <= mData - mStart)
+    {
+        // Target is still within the current buffer.
+        mData -= mOffset - aOffset;
     }
     else
     {
-        aOffset -= kHeadBufferDataSize;
+        Rewind();
+        Advance(aOffset);
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    mOffset = aOffset;
 
-    while (aOffset >= kBufferDataSize)
+exit:
+    return error;
+}
+
+template <typename MessageType, typename BufferType, typename DataType>
+uint16_t Message::CursorBase<MessageType, BufferType, DataType>::Skip(uint16_t aLength)
+{
+    uint16_t bytesRemaining = GetBytesRemaining();
+
+    if (aLength > bytesRemaining)
     {
-        assert(curBuffer != NULL);
+        aLength = bytesRemaining;
+    }
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
+    Advance(aLength);
+    mOffset += aLength;
+
+    return aLength;
+}
+
+template <typename MessageType, typename BufferType, typename DataType>
+uint16_t Message::CursorBase<MessageType, BufferType, DataType>::Read(void *aBuf, uint16_t aLength)
+{
+    uint16_t bytesCopied    = 0;
+    uint16_t bytesRemaining = GetBytesRemaining();
+    uint16_t bytesToCopy;
+
+    if (aLength > bytesRemaining)
+    {
+        aLength = bytesRemaining;
     }
 
-    // begin copy
     while (aLength > 0)
     {
-        assert(curBuffer != NULL);
+        bytesToCopy = GetContiguousLength(aLength);
+        assert(bytesToCopy > 0);
 
-        bytesToCopy = kBufferDataSize - aOffset;
+        memcpy(static_cast<uint8_t *>(aBuf) + bytesCopied, mData, bytesToCopy);
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
+        mData += bytesToCopy;
+        aLength -= bytesToCopy;
+        bytesCopied += bytesToCopy;
+    }
+
+    mOffset += bytesCopied;
 
-        memcpy(aBuf, curBuffer->GetData() + aOffset, bytesToCopy);
+    return bytesCopied;
+}
 
+uint16_t Message::WritableCursor::Write(const void *aBuf, uint16_t aLength)
+{
+    uint16_t bytesCopied    = 0;
+    uint16_t bytesRemaining = GetBytesRemaining();
+    uint16_t bytesToCopy;
+
+    if (aLength > bytesRemaining)
+    {
+        aLength = bytesRemaining;
+    }
+
+    while (aLength > 0)
+    {
+        bytesToCopy = GetContiguousLength(aLength);
+        assert(bytesToCopy > 0);
+
+        memcpy(mData, static_cast<const uint8_t *>(aBuf) + bytesCopied, bytesToCopy);
+
+        mData += bytesToCopy;
         aLength -= bytesToCopy;
         bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
     }
 
-exit:
+    mOffset += bytesCopied;
+
     return bytesCopied;
 }
 
-int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+uint16_t Message::WritableCursor::WriteFrom(Cursor &aSource, uint16_t aLength)
 {
-    Buffer * curBuffer;
     uint16_t bytesCopied = 0;
     uint16_t bytesToCopy;
 
-    assert(aOffset + aLength <= GetLength());
-
-    if (aOffset + aLength >= GetLength())
+    if (aLength > GetBytesRemaining())
     {
-        aLength = GetLength() - aOffset;
+        aLength = GetBytesRemaining();
     }
 
-    aOffset += GetReserved();
-
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    if (aLength > aSource.GetBytesRemaining())
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
+        aLength = aSource.GetBytesRemaining();
+    }
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
+    while (aLength > 0)
+    {
+        bytesToCopy = aSource.GetContiguousLength(GetContiguousLength(aLength));
+        assert(bytesToCopy > 0);
 
-        memcpy(GetFirstData() + aOffset, aBuf, bytesToCopy);
+        memcpy(mData, aSource.mData, bytesToCopy);
 
+        mData += bytesToCopy;
+        aSource.mData += bytesToCopy;
         aLength -= bytesToCopy;
         bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
-
-        aOffset = 0;
     }
-    else
+
+    mOffset += bytesCopied;
+    aSource.mOffset += bytesCopied;
+
+    return bytesCopied;
+}
+
+template <typename MessageType, typename BufferType, typename DataType>
+void Message::CursorBase<MessageType, BufferType, DataType>::Rewind(void)
+{
+    mBuffer = mMessage;
+    mStart  = mBuffer->GetFirstData();
+    mData   = mStart;
+    mEnd    = mStart + kHeadBufferDataSize;
+    mOffset = 0;
+
+    Advance(mMessage->GetReserved());
+}
+
+template <typename MessageType, typename BufferType, typename DataType>
+void Message::CursorBase<MessageType, BufferType, DataType>::Advance(uint16_t aLength)
+{
+    uint16_t bytesToMove;
+
+    while (aLength > 0)
     {
-        aOffset -= kHeadBufferDataSize;
+        bytesToMove = GetContiguousLength(aLength);
+        VerifyOrExit(bytesToMove > 0);
+
+        mData += bytesToMove;
+        aLength -= bytesToMove;
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+exit:
+    return;
+}
 
-    while (aOffset >= kBufferDataSize)
+template <typename MessageType, typename BufferType, typename DataType>
+uint16_t Message::CursorBase<MessageType, BufferType, DataType>::GetContiguousLength(uint16_t aLength)
+{
+    if (mData == mEnd)
     {
-        assert(curBuffer != NULL);
+        BufferType *next = mBuffer->GetNextBuffer();
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
+        VerifyOrExit(next != NULL, aLength = 0);
+
+        mBuffer = next;
+        mStart  = next->GetData();
+        mData   = mStart;
+        mEnd    = mStart + kBufferDataSize;
     }
 
-    // begin copy
-    while (aLength > 0)
+    if (aLength > mEnd - mData)
     {
-        assert(curBuffer != NULL);
+        aLength = static_cast<uint16_t>(mEnd - mData);
+    }
 
-        bytesToCopy = kBufferDataSize - aOffset;
+exit:
+    return aLength;
+}
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
+template class Message::CursorBase<const Message, const Buffer, const uint8_t>;
+template class Message::CursorBase<Message, Buffer, uint8_t>;
 
-        memcpy(curBuffer->GetData() + aOffset, aBuf, bytesToCopy);
+uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+{
+    uint16_t bytesCopied = 0;
+    Cursor   cursor;
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
+    VerifyOrExit(aOffset < GetLength());
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
-    }
+    cursor.Init(*this, aOffset);
+    bytesCopied = cursor.Read(aBuf, aLength);
 
+exit:
     return bytesCopied;
 }
 
+int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+{
+    WritableCursor cursor(*this, aOffset);
+
+    assert(aOffset + aLength <= GetLength());
+
+    return cursor.Write(aBuf, aLength);
+}
+
 int Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
 {
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
-    uint8_t  buf[16];
+    uint16_t       bytesCopied = 0;
+    uint16_t       bytesToCopy;
+    uint8_t        buf[16];
+    Cursor         source(*this, aSourceOffset);
+    WritableCursor destination(aMessage, aDestinationOffset);
 
     while (aLength > 0)
     {
         bytesToCopy = (aLength < sizeof(buf)) ? aLength : sizeof(buf);
 
-        Read(aSourceOffset, bytesToCopy, buf);
-        aMessage.Write(aDestinationOffset, bytesToCopy, buf);
+        source.Read(buf, bytesToCopy);
+        destination.Write(buf, bytesToCopy);
 
-        aSourceOffset += bytesToCopy;
-        aDestinationOffset += bytesToCopy;
         aLength -= bytesToCopy;
         bytesCopied += bytesToCopy;
     }
@@ -703,13 +877,48 @@ uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aValue)
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength)
 {
     const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aBuf);
+    uint64_t       sum   = 0;
+    uint32_t       word;
+    uint16_t       halfWord;
 
-    for (int i = 0; i < aLength; i++)
+    // The one's complement sum is independent of byte order (RFC 1071), so accumulate 32-bit words in host
+    // byte order and convert the folded result once. A 64-bit accumulator cannot overflow for a 16-bit length.
+    for (; aLength >= 4 * sizeof(word); aLength -= 4 * sizeof(word), bytes += 4 * sizeof(word))
     {
-        aChecksum = UpdateChecksum(aChecksum, (i & 1) ? bytes[i] : static_cast<uint16_t>(bytes[i] << 8));
+        uint32_t words[4];
+
+        memcpy(words, bytes, sizeof(words));
+        sum += static_cast<uint64_t>(words[0]) + words[1] + words[2] + words[3];
     }
 
-    return aChecksum;
+    for (; aLength >= sizeof(word); aLength -= sizeof(word), bytes += sizeof(word))
+    {
+        memcpy(&word, bytes, sizeof(word));
+        sum += word;
+    }
+
+    if (aLength >= sizeof(halfWord))
+    {
+        memcpy(&halfWord, bytes, sizeof(halfWord));
+        sum += halfWord;
+        aLength -= sizeof(halfWord);
+        bytes += sizeof(halfWord);
+    }
+
+    if (aLength > 0)
+    {
+        // A trailing odd byte is padded with a zero byte.
+        halfWord = 0;
+        memcpy(&halfWord, bytes, 1);
+        sum += halfWord;
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return UpdateChecksum(aChecksum, Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum)));
 }
 
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
@@ -717,6 +926,7 @@ uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t
     Buffer * curBuffer;
     uint16_t bytesCovered = 0;
     uint16_t bytesToCover;
+    uint16_t checksum;
 
     assert(aOffset + aLength <= GetLength());
 
@@ -767,7 +977,15 @@ uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t
             bytesToCover = aLength;
         }
 
-        aChecksum = Message::UpdateChecksum(aChecksum, curBuffer->GetData() + aOffset, bytesToCover);
+        checksum = Message::UpdateChecksum(0, curBuffer->GetData() + aOffset, bytesToCover);
+
+        // A buffer starting at an odd position of the covered range contributes its bytes byte-swapped.
+        if (bytesCovered & 1)
+        {
+            checksum = Encoding::Swap16(checksum);
+        }
+
+        aChecksum = Message::UpdateChecksum(aChecksum, checksum);
 
         aLength -= bytesToCover;
         bytesCovered += bytesToCover;
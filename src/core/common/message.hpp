@@ -66,6 +66,7 @@ enum
     kChildMaskBytes = BitVectorBytes(OPENTHREAD_CONFIG_MLE_MAX_CHILDREN),
 };
 
+class Buffer;
 class Message;
 class MessagePool;
 class MessageQueue;
@@ -80,6 +81,7 @@ struct MessageInfo
     Message *    mNext;        ///< A pointer to the next Message in a doubly linked list.
     Message *    mPrev;        ///< A pointer to the previous Message in a doubly linked list.
     MessagePool *mMessagePool; ///< Identifies the message pool for this message.
+    Buffer *     mTailBuffer;  ///< The last buffer of the message, where appended bytes go.
     union
     {
         MessageQueue * mMessage;  ///< Identifies the message queue (if any) where this message is queued.
@@ -233,6 +235,173 @@ public:
         kNumPriorities = 4, ///< Number of priority levels.
     };
 
+    /**
+     * This class template implements a cursor for sequential access to the bytes of a message.
+     *
+     * A cursor remembers the buffer and the position within that buffer corresponding to its current offset, so
+     * consecutive reads, writes, and skips continue from where the previous one stopped instead of walking the buffer
+     * chain from the head of the message again.
+     *
+     * A cursor stays valid while the message grows, but must be re-initialized (`Init()`) after any operation that
+     * frees buffers or changes the reserved header space of the message (e.g., `SetLength()` shrinking the message,
+     * `Prepend()`, or `RemoveHeader()`).
+     *
+     * The template is used through the read-only `Cursor` and the `WritableCursor`.
+     *
+     * @tparam MessageType  The message type (`const Message` for a read-only cursor).
+     * @tparam BufferType   The buffer type (`const Buffer` for a read-only cursor).
+     * @tparam DataType     The type of the message bytes (`const uint8_t` for a read-only cursor).
+     *
+     */
+    template <typename MessageType, typename BufferType, typename DataType> class CursorBase
+    {
+    public:
+        /**
+         * This method (re-)initializes the cursor to point to a given offset within a message.
+         *
+         * @param[in]  aMessage  The message to traverse.
+         * @param[in]  aOffset   The byte offset within @p aMessage.
+         *
+         */
+        void Init(MessageType &aMessage, uint16_t aOffset);
+
+        /**
+         * This method returns the current byte offset of the cursor within the message.
+         *
+         * @returns The current byte offset.
+         *
+         */
+        uint16_t GetOffset(void) const { return mOffset; }
+
+        /**
+         * This method returns the number of bytes between the cursor and the end of the message.
+         *
+         * @returns The number of bytes remaining in the message.
+         *
+         */
+        uint16_t GetBytesRemaining(void) const;
+
+        /**
+         * This method moves the cursor to a given byte offset within the message.
+         *
+         * Moving forward continues from the current buffer. Moving backward stays within the current buffer when
+         * possible and otherwise restarts from the head of the message.
+         *
+         * @param[in]  aOffset  The byte offset within the message.
+         *
+         * @retval OT_ERROR_NONE          Successfully moved the cursor.
+         * @retval OT_ERROR_INVALID_ARGS  @p aOffset is beyond the end of the message.
+         *
+         */
+        otError Seek(uint16_t aOffset);
+
+        /**
+         * This method moves the cursor forward by a given number of bytes.
+         *
+         * The cursor does not move past the end of the message.
+         *
+         * @param[in]  aLength  The number of bytes to skip.
+         *
+         * @returns The number of bytes skipped.
+         *
+         */
+        uint16_t Skip(uint16_t aLength);
+
+        /**
+         * This method reads bytes from the message and advances the cursor past them.
+         *
+         * @param[out]  aBuf     A pointer to a data buffer.
+         * @param[in]   aLength  Number of bytes to read.
+         *
+         * @returns The number of bytes read.
+         *
+         */
+        uint16_t Read(void *aBuf, uint16_t aLength);
+
+    protected:
+        CursorBase(void);
+
+        void     Rewind(void);
+        void     Advance(uint16_t aLength);
+        uint16_t GetContiguousLength(uint16_t aLength);
+
+        MessageType *mMessage;
+        BufferType * mBuffer;
+        DataType *   mStart;
+        DataType *   mData;
+        DataType *   mEnd;
+        uint16_t     mOffset;
+    };
+
+    class WritableCursor;
+
+    /**
+     * This class implements a read-only cursor over the bytes of a message.
+     *
+     */
+    class Cursor : public CursorBase<const Message, const Buffer, const uint8_t>
+    {
+        friend class WritableCursor;
+
+    public:
+        /**
+         * This constructor initializes an empty cursor which is not associated with any message.
+         *
+         */
+        Cursor(void) {}
+
+        /**
+         * This constructor initializes the cursor to point to a given offset within a message.
+         *
+         * @param[in]  aMessage  The message to traverse.
+         * @param[in]  aOffset   The byte offset within @p aMessage.
+         *
+         */
+        Cursor(const Message &aMessage, uint16_t aOffset) { Init(aMessage, aOffset); }
+    };
+
+    /**
+     * This class implements a cursor which can also write the bytes of a message.
+     *
+     */
+    class WritableCursor : public CursorBase<Message, Buffer, uint8_t>
+    {
+        friend class Message;
+
+    public:
+        /**
+         * This constructor initializes an empty cursor which is not associated with any message.
+         *
+         */
+        WritableCursor(void) {}
+
+        /**
+         * This constructor initializes the cursor to point to a given offset within a message.
+         *
+         * @param[in]  aMessage  The message to traverse.
+         * @param[in]  aOffset   The byte offset within @p aMessage.
+         *
+         */
+        WritableCursor(Message &aMessage, uint16_t aOffset) { Init(aMessage, aOffset); }
+
+        /**
+         * This method writes bytes to the message and advances the cursor past them.
+         *
+         * The message length is not changed, i.e., bytes beyond the end of the message are not written.
+         *
+         * @param[in]  aBuf     A pointer to a data buffer.
+         * @param[in]  aLength  Number of bytes to write.
+         *
+         * @returns The number of bytes written.
+         *
+         */
+        uint16_t Write(const void *aBuf, uint16_t aLength);
+
+    private:
+        void     InitAtEnd(Message &aMessage);
+        uint16_t WriteFrom(Cursor &aSource, uint16_t aLength);
+    };
+
     /**
      * This method frees this message buffer.
      *
@@ -399,6 +568,22 @@ public:
      */
     otError Append(const void *aBuf, uint16_t aLength);
 
+    /**
+     * This method appends bytes read from another message to the end of the message.
+     *
+     * The bytes are copied directly between the buffers of the two messages. @p aMessage may be the message itself.
+     *
+     * @param[in]  aMessage  The message to read the bytes from.
+     * @param[in]  aOffset   Byte offset within @p aMessage to begin reading.
+     * @param[in]  aLength   The number of bytes to append.
+     *
+     * @retval OT_ERROR_NONE          Successfully appended the bytes.
+     * @retval OT_ERROR_INVALID_ARGS  @p aOffset and @p aLength exceed the length of @p aMessage.
+     * @retval OT_ERROR_NO_BUFS       Insufficient available buffers to grow the message.
+     *
+     */
+    otError AppendFrom(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
     /**
      * This method reads bytes from the message.
      *
@@ -869,6 +1054,49 @@ private:
      */
     void SetReserved(uint16_t aReservedHeader) { mBuffer.mHead.mInfo.mReserved = aReservedHeader; }
 
+    /**
+     * This method returns the last buffer of the message.
+     *
+     * @returns A pointer to the last buffer.
+     *
+     */
+    Buffer *GetTailBuffer(void) const { return mBuffer.mHead.mInfo.mTailBuffer; }
+
+    /**
+     * This method sets the last buffer of the message.
+     *
+     * @param[in]  aBuffer  A pointer to the last buffer.
+     *
+     */
+    void SetTailBuffer(Buffer *aBuffer) { mBuffer.mHead.mInfo.mTailBuffer = aBuffer; }
+
+    /**
+     * This method returns the number of buffers following the first one, needed to hold a number of bytes.
+     *
+     * @param[in]  aLength  The number of bytes, including the reserved header bytes.
+     *
+     * @returns The number of buffers following the first one.
+     *
+     */
+    static int GetBufferCountFor(uint16_t aLength)
+    {
+        return (aLength > kHeadBufferDataSize) ? (((aLength - kHeadBufferDataSize) - 1) / kBufferDataSize) + 1 : 0;
+    }
+
+    /**
+     * This method grows the message by linking new buffers after the last one.
+     *
+     * Unlike `SetLength()`, this method does not walk the buffer chain.
+     *
+     * @param[in]  aLength  The number of bytes to add to the message.
+     *
+     * @retval OT_ERROR_NONE          Successfully grew the message.
+     * @retval OT_ERROR_INVALID_ARGS  The message would exceed the maximum length.
+     * @retval OT_ERROR_NO_BUFS       Insufficient available buffers to grow the message.
+     *
+     */
+    otError Extend(uint16_t aLength);
+
     /**
      * This method adds or frees message buffers to meet the requested length.
      *
@@ -98,6 +98,152 @@ void TimerMilli::Stop(void)
     Get<TimerMilliScheduler>().Remove(*this);
 }
 
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
+void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mNext  = NULL;
+    aTimer.mChild = NULL;
+    aTimer.mPrev  = NULL;
+
+    mTimerHeap = Meld(mTimerHeap, &aTimer, now);
+
+    if (mTimerHeap == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now;
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    now = Time(aAlarmApi.AlarmGetNow());
+
+    if (mTimerHeap == &aTimer)
+    {
+        mTimerHeap = MergePairs(aTimer.mChild, now);
+        SetAlarm(aAlarmApi);
+    }
+    else
+    {
+        // Unlink the timer from its siblings, then meld its children back. The root stays the same, so there is no
+        // need to update the alarm.
+
+        if (aTimer.mPrev->mChild == &aTimer)
+        {
+            aTimer.mPrev->mChild = aTimer.mNext;
+        }
+        else
+        {
+            aTimer.mPrev->mNext = aTimer.mNext;
+        }
+
+        if (aTimer.mNext != NULL)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+
+        mTimerHeap = Meld(mTimerHeap, MergePairs(aTimer.mChild, now), now);
+    }
+
+    aTimer.mChild = NULL;
+    aTimer.mPrev  = NULL;
+    aTimer.SetNext(&aTimer);
+
+exit:
+    return;
+}
+
+Timer *TimerScheduler::Meld(Timer *aFirst, Timer *aSecond, Time aNow)
+{
+    Timer *root;
+
+    if (aFirst == NULL)
+    {
+        root = aSecond;
+    }
+    else if (aSecond == NULL)
+    {
+        root = aFirst;
+    }
+    else
+    {
+        Timer *child;
+
+        // On equal fire times `aFirst` stays the root.
+        if (aSecond->DoesFireBefore(*aFirst, aNow))
+        {
+            root  = aSecond;
+            child = aFirst;
+        }
+        else
+        {
+            root  = aFirst;
+            child = aSecond;
+        }
+
+        child->mPrev = root;
+        child->mNext = root->mChild;
+
+        if (root->mChild != NULL)
+        {
+            root->mChild->mPrev = child;
+        }
+
+        root->mChild = child;
+    }
+
+    if (root != NULL)
+    {
+        root->mNext = NULL;
+        root->mPrev = NULL;
+    }
+
+    return root;
+}
+
+Timer *TimerScheduler::MergePairs(Timer *aList, Time aNow)
+{
+    Timer *pairs = NULL;
+    Timer *root  = NULL;
+
+    // First pass: meld the siblings in pairs from left to right, collecting the results in reverse order.
+
+    while (aList != NULL)
+    {
+        Timer *first  = aList;
+        Timer *second = first->mNext;
+        Timer *merged;
+
+        aList = (second != NULL) ? second->mNext : NULL;
+
+        merged        = Meld(first, second, aNow);
+        merged->mNext = pairs;
+        pairs         = merged;
+    }
+
+    // Second pass: meld the pairs from right to left into a single heap.
+
+    while (pairs != NULL)
+    {
+        Timer *next = pairs->mNext;
+
+        root  = Meld(root, pairs, aNow);
+        pairs = next;
+    }
+
+    return root;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
 void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = NULL;
@@ -144,15 +290,18 @@ exit:
     return;
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    Timer *timer = GetHead();
+
+    if (timer == NULL)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer *  timer = mTimerList.GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
@@ -164,7 +313,7 @@ void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
@@ -100,6 +100,10 @@ public:
         , mHandler(aHandler)
         , mFireTime()
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+        , mChild(NULL)
+        , mPrev(NULL)
+#endif
     {
     }
 
@@ -138,6 +142,12 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer * mNext;
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    // When the timer is part of the scheduler heap, `mNext` points to the next sibling, `mChild` to the first child
+    // and `mPrev` either to the previous sibling or to the parent (for the first child).
+    Timer *mChild;
+    Timer *mPrev;
+#endif
 };
 
 /**
@@ -250,6 +260,11 @@ private:
 /**
  * This class implements the base timer scheduler.
  *
+ * By default the running timers are kept in a list sorted by fire time. When
+ * `OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE` is set, they are kept in an intrusive pairing heap instead, so that
+ * adding a timer takes constant time and removing a timer takes amortized logarithmic time. Timers with the same fire
+ * time are fired in unspecified order when the heap is used.
+ *
  */
 class TimerScheduler : public InstanceLocator
 {
@@ -275,7 +290,11 @@ protected:
      */
     explicit TimerScheduler(Instance &aInstance)
         : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+        , mTimerHeap(NULL)
+#else
         , mTimerList()
+#endif
     {
     }
 
@@ -313,7 +332,50 @@ protected:
      */
     void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    /**
+     * This method returns the timer with the earliest fire time.
+     *
+     * @returns A pointer to the timer with the earliest fire time, or NULL if no timer is running.
+     *
+     */
+    Timer *GetHead(void) { return mTimerHeap; }
+
+    /**
+     * This static method melds two timer heaps.
+     *
+     * @param[in]  aFirst   A pointer to the root of the first heap (may be NULL).
+     * @param[in]  aSecond  A pointer to the root of the second heap (may be NULL).
+     * @param[in]  aNow     The current time.
+     *
+     * @returns A pointer to the root of the melded heap.
+     *
+     */
+    static Timer *Meld(Timer *aFirst, Timer *aSecond, Time aNow);
+
+    /**
+     * This static method melds a list of sibling heaps into a single heap (two-pass pairing).
+     *
+     * @param[in]  aList  A pointer to the first heap in the sibling list (may be NULL).
+     * @param[in]  aNow   The current time.
+     *
+     * @returns A pointer to the root of the melded heap.
+     *
+     */
+    static Timer *MergePairs(Timer *aList, Time aNow);
+
+    Timer *mTimerHeap;
+#else
+    /**
+     * This method returns the timer with the earliest fire time.
+     *
+     * @returns A pointer to the timer with the earliest fire time, or NULL if no timer is running.
+     *
+     */
+    Timer *GetHead(void) { return mTimerList.GetHead(); }
+
     LinkedList<Timer> mTimerList;
+#endif
 };
 
 /**
@@ -105,30 +105,32 @@ exit:
 
 otError Tlv::Find(const Message &aMessage, uint8_t aType, uint16_t *aOffset, uint16_t *aSize, bool *aIsExtendedTlv)
 {
-    otError  error        = OT_ERROR_NOT_FOUND;
-    uint16_t offset       = aMessage.GetOffset();
-    uint16_t remainingLen = aMessage.GetLength();
-    Tlv      tlv;
-    uint32_t size;
+    otError         error        = OT_ERROR_NOT_FOUND;
+    uint16_t        offset       = aMessage.GetOffset();
+    uint16_t        remainingLen = aMessage.GetLength();
+    Message::Cursor cursor;
+    ExtendedTlv     extTlv;
+    uint32_t        size;
 
     VerifyOrExit(offset <= remainingLen);
     remainingLen -= offset;
 
+    cursor.Init(aMessage, offset);
+
     while (true)
     {
         VerifyOrExit(sizeof(Tlv) <= remainingLen);
-        aMessage.Read(offset, sizeof(Tlv), &tlv);
+        cursor.Read(&extTlv, sizeof(Tlv));
 
-        if (tlv.mLength != kExtendedLength)
+        if (!extTlv.IsExtended())
         {
-            size = tlv.GetSize();
+            size = extTlv.GetSize();
         }
         else
         {
-            ExtendedTlv extTlv;
-
+            // Continue reading the extended length field following the base TLV header.
             VerifyOrExit(sizeof(ExtendedTlv) <= remainingLen);
-            aMessage.Read(offset, sizeof(ExtendedTlv), &extTlv);
+            cursor.Read(reinterpret_cast<uint8_t *>(&extTlv) + sizeof(Tlv), sizeof(ExtendedTlv) - sizeof(Tlv));
 
             VerifyOrExit(extTlv.GetLength() <= (remainingLen - sizeof(ExtendedTlv)));
             size = extTlv.GetSize();
@@ -136,7 +138,7 @@ otError Tlv::Find(const Message &aMessage, uint8_t aType, uint16_t *aOffset, uin
 
         VerifyOrExit(size <= remainingLen);
 
-        if (tlv.GetType() == aType)
+        if (extTlv.GetType() == aType)
         {
             if (aOffset != NULL)
             {
@@ -150,7 +152,7 @@ otError Tlv::Find(const Message &aMessage, uint8_t aType, uint16_t *aOffset, uin
 
             if (aIsExtendedTlv != NULL)
             {
-                *aIsExtendedTlv = (tlv.mLength == kExtendedLength);
+                *aIsExtendedTlv = extTlv.IsExtended();
             }
 
             error = OT_ERROR_NONE;
@@ -159,6 +161,7 @@ otError Tlv::Find(const Message &aMessage, uint8_t aType, uint16_t *aOffset, uin
 
         offset += size;
         remainingLen -= size;
+        cursor.Seek(offset);
     }
 
 exit:
@@ -89,6 +89,18 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+ *
+ * Number of outstanding CoAP requests per CoAP agent indexed for matching responses (1 to 254).
+ *
+ * Requests sent while the index is full are still retransmitted and matched, by walking the pending request queue.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
@@ -99,6 +111,36 @@
 #define OPENTHREAD_CONFIG_COAP_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+ *
+ * Define to 1 to enable CoAP block-wise transfers (RFC7959).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+ *
+ * Define to 1 to enable CoAP Observe (RFC7641) support.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+#define OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
+ *
+ * Maximum number of observers registered with the resources of a CoAP agent.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
+#define OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
  *
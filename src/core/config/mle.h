@@ -58,6 +58,20 @@
 #define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_INDIRECT_MESSAGE_REFS
+ *
+ * The number of message references shared by the per-child indirect transmit queues.
+ *
+ * A multicast message queued for several sleepy children uses one reference per child. When all references are in
+ * use, a child falls back to scanning the send queue until its queued messages are delivered.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_INDIRECT_MESSAGE_REFS
+#define OPENTHREAD_CONFIG_MLE_INDIRECT_MESSAGE_REFS \
+    (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS + OPENTHREAD_CONFIG_MLE_MAX_CHILDREN)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT
  *
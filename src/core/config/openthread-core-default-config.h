@@ -332,6 +332,19 @@
 #define OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH "tmp"
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_BATCH
+ *
+ * The number of settings log records appended on posix platform before the log is flushed to disk with fsync().
+ *
+ * Setting this to 1 syncs every write. Records not yet synced may be lost on power failure, in which case the
+ * settings roll back to the last synced state.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_BATCH
+#define OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_BATCH 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -428,4 +441,32 @@
 #define OPENTHREAD_CONFIG_LEGACY_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+ *
+ * Define to 1 to keep running timers in a pairing heap instead of a sorted list.
+ *
+ * With the heap, starting or stopping a timer no longer scans all running timers, which helps when many timers are
+ * active at the same time. Timers with the same fire time are then fired in unspecified order.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+ *
+ * Define to 1 to run AES-128 and SHA-256 on the CPU crypto instructions (AES-NI and SHA extensions on x86-64, ARMv8
+ * cryptography extensions on AArch64) when the running CPU supports them.
+ *
+ * The CPU features are detected at run time, and the mbedtls implementation is used when they are missing. On
+ * AArch64 the accelerated code is only built when the compiler targets the cryptography extensions (e.g.,
+ * `-march=armv8-a+crypto`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+#define OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE 0
+#endif
+
 #endif // OPENTHREAD_CORE_DEFAULT_CONFIG_H_
@@ -38,7 +38,7 @@
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES
  *
- * The number of EID-to-RLOC cache entries.
+ * The number of EID-to-RLOC cache entries (must be below 32768).
  *
  */
 #ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES
@@ -0,0 +1,396 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements AES-128 and SHA-256 with CPU crypto instructions.
+ */
+
+#include "accel.hpp"
+
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
+#include <string.h>
+
+#include <openthread/platform/toolchain.h>
+
+#include "common/debug.hpp"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define OT_CRYPTO_ACCEL_X86 1
+#define OT_CRYPTO_ACCEL_ARM 0
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO) && defined(__linux__)
+#define OT_CRYPTO_ACCEL_X86 0
+#define OT_CRYPTO_ACCEL_ARM 1
+#include <arm_neon.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#else
+#define OT_CRYPTO_ACCEL_X86 0
+#define OT_CRYPTO_ACCEL_ARM 0
+#endif
+
+namespace ot {
+namespace Crypto {
+namespace Accel {
+
+static bool sEnabled   = true;
+static bool sDetected  = false;
+static bool sHasAes    = false;
+static bool sHasSha256 = false;
+
+#if OT_CRYPTO_ACCEL_X86 || OT_CRYPTO_ACCEL_ARM
+static const uint32_t kSha256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+#endif
+
+static void DetectFeatures(void)
+{
+#if OT_CRYPTO_ACCEL_X86
+    unsigned int eax, ebx, ecx, edx;
+
+    sHasAes    = false;
+    sHasSha256 = false;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        bool hasSse41 = (ecx & bit_SSE4_1) != 0;
+
+        sHasAes = (ecx & bit_AES) != 0;
+
+        if (hasSse41 && __get_cpuid_max(0, NULL) >= 7)
+        {
+            __cpuid_count(7, 0, eax, ebx, ecx, edx);
+            sHasSha256 = (ebx & bit_SHA) != 0;
+        }
+    }
+#elif OT_CRYPTO_ACCEL_ARM
+    unsigned long hwcap = getauxval(AT_HWCAP);
+
+    sHasAes    = (hwcap & HWCAP_AES) != 0;
+    sHasSha256 = (hwcap & HWCAP_SHA2) != 0;
+#else
+    sHasAes    = false;
+    sHasSha256 = false;
+#endif
+
+    sDetected = true;
+}
+
+void SetEnabled(bool aEnabled)
+{
+    sEnabled = aEnabled;
+}
+
+bool IsAesSupported(void)
+{
+    if (!sDetected)
+    {
+        DetectFeatures();
+    }
+
+    return sEnabled && sHasAes;
+}
+
+bool IsSha256Supported(void)
+{
+    if (!sDetected)
+    {
+        DetectFeatures();
+    }
+
+    return sEnabled && sHasSha256;
+}
+
+#if OT_CRYPTO_ACCEL_X86
+
+#define OT_CRYPTO_ACCEL_TARGET_AES __attribute__((target("aes,sse2")))
+#define OT_CRYPTO_ACCEL_TARGET_SHA __attribute__((target("sha,sse4.1")))
+
+static inline OT_CRYPTO_ACCEL_TARGET_AES __m128i Aes128ExpandStep(__m128i aKey, __m128i aKeyGenAssist)
+{
+    // `aKeyGenAssist` holds RotWord(SubWord(w[3])) ^ Rcon in its top word, which is
+    // added to the running XOR of the previous round key words.
+
+    aKeyGenAssist = _mm_shuffle_epi32(aKeyGenAssist, 0xff);
+    aKey          = _mm_xor_si128(aKey, _mm_slli_si128(aKey, 4));
+    aKey          = _mm_xor_si128(aKey, _mm_slli_si128(aKey, 4));
+    aKey          = _mm_xor_si128(aKey, _mm_slli_si128(aKey, 4));
+
+    return _mm_xor_si128(aKey, aKeyGenAssist);
+}
+
+OT_CRYPTO_ACCEL_TARGET_AES void Aes128SetKey(const uint8_t aKey[kAes128KeySize],
+                                             uint8_t       aRoundKeys[kAes128RoundKeysSize])
+{
+    __m128i *roundKeys = reinterpret_cast<__m128i *>(aRoundKeys);
+    __m128i  key       = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aKey));
+
+    // `_mm_aeskeygenassist_si128()` takes the round constant as an immediate.
+
+    _mm_storeu_si128(&roundKeys[0], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x01));
+    _mm_storeu_si128(&roundKeys[1], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x02));
+    _mm_storeu_si128(&roundKeys[2], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x04));
+    _mm_storeu_si128(&roundKeys[3], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x08));
+    _mm_storeu_si128(&roundKeys[4], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x10));
+    _mm_storeu_si128(&roundKeys[5], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x20));
+    _mm_storeu_si128(&roundKeys[6], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x40));
+    _mm_storeu_si128(&roundKeys[7], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x80));
+    _mm_storeu_si128(&roundKeys[8], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x1b));
+    _mm_storeu_si128(&roundKeys[9], key);
+    key = Aes128ExpandStep(key, _mm_aeskeygenassist_si128(key, 0x36));
+    _mm_storeu_si128(&roundKeys[10], key);
+}
+
+OT_CRYPTO_ACCEL_TARGET_AES void Aes128Encrypt(const uint8_t aRoundKeys[kAes128RoundKeysSize],
+                                              const uint8_t aInput[16],
+                                              uint8_t       aOutput[16])
+{
+    const __m128i *roundKeys = reinterpret_cast<const __m128i *>(aRoundKeys);
+    __m128i        block     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aInput));
+
+    block = _mm_xor_si128(block, _mm_loadu_si128(&roundKeys[0]));
+
+    for (int round = 1; round < 10; round++)
+    {
+        block = _mm_aesenc_si128(block, _mm_loadu_si128(&roundKeys[round]));
+    }
+
+    block = _mm_aesenclast_si128(block, _mm_loadu_si128(&roundKeys[10]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOutput), block);
+}
+
+OT_CRYPTO_ACCEL_TARGET_SHA void Sha256Process(uint32_t       aState[kSha256StateWordCount],
+                                              const uint8_t *aBlocks,
+                                              size_t         aBlockCount)
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i       abef;
+    __m128i       cdgh;
+    __m128i       tmp;
+
+    // The SHA instructions keep the state as {A, B, E, F} and {C, D, G, H}.
+
+    tmp  = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&aState[0])), 0xb1);
+    cdgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&aState[4])), 0x1b);
+    abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+
+    for (; aBlockCount > 0; aBlockCount--, aBlocks += kSha256BlockSize)
+    {
+        const __m128i *data      = reinterpret_cast<const __m128i *>(aBlocks);
+        const __m128i *constants = reinterpret_cast<const __m128i *>(kSha256RoundConstants);
+        __m128i        abefSave  = abef;
+        __m128i        cdghSave  = cdgh;
+        __m128i        schedule[4];
+
+        // Each iteration runs four rounds. `schedule[i % 4]` holds the message words
+        // W[4i..4i+3], computed from the previous 16 words after the first 16 rounds.
+
+        for (int i = 0; i < 16; i++)
+        {
+            __m128i &words = schedule[i % 4];
+            __m128i  msg;
+
+            if (i < 4)
+            {
+                words = _mm_shuffle_epi8(_mm_loadu_si128(&data[i]), byteSwap);
+            }
+            else
+            {
+                words = _mm_sha256msg1_epu32(words, schedule[(i + 1) % 4]);
+                words = _mm_add_epi32(words, _mm_alignr_epi8(schedule[(i + 3) % 4], schedule[(i + 2) % 4], 4));
+                words = _mm_sha256msg2_epu32(words, schedule[(i + 3) % 4]);
+            }
+
+            msg  = _mm_add_epi32(words, _mm_loadu_si128(&constants[i]));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, msg);
+            msg  = _mm_shuffle_epi32(msg, 0x0e);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, msg);
+        }
+
+        abef = _mm_add_epi32(abef, abefSave);
+        cdgh = _mm_add_epi32(cdgh, cdghSave);
+    }
+
+    tmp  = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    abef = _mm_blend_epi16(tmp, cdgh, 0xf0);
+    cdgh = _mm_alignr_epi8(cdgh, tmp, 8);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&aState[0]), abef);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&aState[4]), cdgh);
+}
+
+#elif OT_CRYPTO_ACCEL_ARM
+
+static uint32_t Aes128SubWord(uint32_t aWord)
+{
+    // With the word in all four columns, ShiftRows leaves the state unchanged and
+    // AESE with an all-zero round key reduces to SubBytes.
+
+    uint8x16_t block = vaeseq_u8(vreinterpretq_u8_u32(vdupq_n_u32(aWord)), vdupq_n_u8(0));
+
+    return vgetq_lane_u32(vreinterpretq_u32_u8(block), 0);
+}
+
+void Aes128SetKey(const uint8_t aKey[kAes128KeySize], uint8_t aRoundKeys[kAes128RoundKeysSize])
+{
+    static const uint8_t kRoundConstants[10] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
+
+    // Words are kept in memory byte order, so on this little-endian target RotWord
+    // is a right rotation by one byte and the round constant goes to the low byte.
+
+    uint32_t words[kAes128RoundKeysSize / sizeof(uint32_t)];
+
+    memcpy(words, aKey, kAes128KeySize);
+
+    for (unsigned int i = 4; i < sizeof(words) / sizeof(words[0]); i++)
+    {
+        uint32_t word = words[i - 1];
+
+        if (i % 4 == 0)
+        {
+            word = Aes128SubWord((word >> 8) | (word << 24)) ^ kRoundConstants[i / 4 - 1];
+        }
+
+        words[i] = words[i - 4] ^ word;
+    }
+
+    memcpy(aRoundKeys, words, kAes128RoundKeysSize);
+}
+
+void Aes128Encrypt(const uint8_t aRoundKeys[kAes128RoundKeysSize], const uint8_t aInput[16], uint8_t aOutput[16])
+{
+    uint8x16_t block = vld1q_u8(aInput);
+
+    for (int round = 0; round < 9; round++)
+    {
+        block = vaesmcq_u8(vaeseq_u8(block, vld1q_u8(&aRoundKeys[16 * round])));
+    }
+
+    block = vaeseq_u8(block, vld1q_u8(&aRoundKeys[16 * 9]));
+    block = veorq_u8(block, vld1q_u8(&aRoundKeys[16 * 10]));
+    vst1q_u8(aOutput, block);
+}
+
+void Sha256Process(uint32_t aState[kSha256StateWordCount], const uint8_t *aBlocks, size_t aBlockCount)
+{
+    uint32x4_t abcd = vld1q_u32(&aState[0]);
+    uint32x4_t efgh = vld1q_u32(&aState[4]);
+
+    for (; aBlockCount > 0; aBlockCount--, aBlocks += kSha256BlockSize)
+    {
+        uint32x4_t abcdSave = abcd;
+        uint32x4_t efghSave = efgh;
+        uint32x4_t schedule[4];
+
+        // Each iteration runs four rounds. `schedule[i % 4]` holds the message words
+        // W[4i..4i+3], computed from the previous 16 words after the first 16 rounds.
+
+        for (int i = 0; i < 16; i++)
+        {
+            uint32x4_t &words = schedule[i % 4];
+            uint32x4_t  msg;
+            uint32x4_t  abcdPrev;
+
+            if (i < 4)
+            {
+                words = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&aBlocks[16 * i])));
+            }
+            else
+            {
+                words = vsha256su0q_u32(words, schedule[(i + 1) % 4]);
+                words = vsha256su1q_u32(words, schedule[(i + 2) % 4], schedule[(i + 3) % 4]);
+            }
+
+            msg      = vaddq_u32(words, vld1q_u32(&kSha256RoundConstants[4 * i]));
+            abcdPrev = abcd;
+            abcd     = vsha256hq_u32(abcd, efgh, msg);
+            efgh     = vsha256h2q_u32(efgh, abcdPrev, msg);
+        }
+
+        abcd = vaddq_u32(abcd, abcdSave);
+        efgh = vaddq_u32(efgh, efghSave);
+    }
+
+    vst1q_u32(&aState[0], abcd);
+    vst1q_u32(&aState[4], efgh);
+}
+
+#else // OT_CRYPTO_ACCEL_X86 || OT_CRYPTO_ACCEL_ARM
+
+void Aes128SetKey(const uint8_t aKey[kAes128KeySize], uint8_t aRoundKeys[kAes128RoundKeysSize])
+{
+    OT_UNUSED_VARIABLE(aKey);
+    OT_UNUSED_VARIABLE(aRoundKeys);
+    assert(false);
+}
+
+void Aes128Encrypt(const uint8_t aRoundKeys[kAes128RoundKeysSize], const uint8_t aInput[16], uint8_t aOutput[16])
+{
+    OT_UNUSED_VARIABLE(aRoundKeys);
+    OT_UNUSED_VARIABLE(aInput);
+    OT_UNUSED_VARIABLE(aOutput);
+    assert(false);
+}
+
+void Sha256Process(uint32_t aState[kSha256StateWordCount], const uint8_t *aBlocks, size_t aBlockCount)
+{
+    OT_UNUSED_VARIABLE(aState);
+    OT_UNUSED_VARIABLE(aBlocks);
+    OT_UNUSED_VARIABLE(aBlockCount);
+    assert(false);
+}
+
+#endif // OT_CRYPTO_ACCEL_X86 || OT_CRYPTO_ACCEL_ARM
+
+} // namespace Accel
+} // namespace Crypto
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
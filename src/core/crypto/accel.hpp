@@ -0,0 +1,147 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the CPU accelerated AES and SHA-256 backend.
+ */
+
+#ifndef CRYPTO_ACCEL_HPP_
+#define CRYPTO_ACCEL_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ot {
+namespace Crypto {
+
+/**
+ * @addtogroup core-security
+ *
+ * @{
+ *
+ */
+
+/**
+ * This namespace includes the AES-128 and SHA-256 primitives implemented with CPU crypto instructions.
+ *
+ * `AesEcb` and `Sha256` use them when `OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE` is set and the running CPU supports
+ * them, and use mbedtls otherwise.
+ *
+ */
+namespace Accel {
+
+enum
+{
+    kAes128KeySize        = 16,  ///< AES-128 key size (bytes).
+    kAes128RoundKeysSize  = 176, ///< AES-128 expanded key schedule size (bytes).
+    kSha256BlockSize      = 64,  ///< SHA-256 block size (bytes).
+    kSha256StateWordCount = 8,   ///< Number of 32-bit words in the SHA-256 state.
+};
+
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
+/**
+ * This function enables or disables the accelerated backend.
+ *
+ * The backend is enabled by default. Disabling it makes objects set up afterwards (by `AesEcb::SetKey()` or
+ * `Sha256::Start()`) use mbedtls, e.g., to compare both implementations.
+ *
+ * @param[in]  aEnabled  TRUE to use the CPU crypto instructions when supported, FALSE to always use mbedtls.
+ *
+ */
+void SetEnabled(bool aEnabled);
+
+/**
+ * This function indicates whether AES-128 runs on the CPU crypto instructions.
+ *
+ * @retval TRUE   If the backend is enabled and the CPU supports the AES instructions.
+ * @retval FALSE  If the backend is disabled or the CPU does not support the AES instructions.
+ *
+ */
+bool IsAesSupported(void);
+
+/**
+ * This function indicates whether SHA-256 runs on the CPU crypto instructions.
+ *
+ * @retval TRUE   If the backend is enabled and the CPU supports the SHA-256 instructions.
+ * @retval FALSE  If the backend is disabled or the CPU does not support the SHA-256 instructions.
+ *
+ */
+bool IsSha256Supported(void);
+
+/**
+ * This function expands an AES-128 key into its encryption key schedule.
+ *
+ * MUST only be called when `IsAesSupported()` returns TRUE.
+ *
+ * @param[in]   aKey        A pointer to the key.
+ * @param[out]  aRoundKeys  A pointer to the output key schedule.
+ *
+ */
+void Aes128SetKey(const uint8_t aKey[kAes128KeySize], uint8_t aRoundKeys[kAes128RoundKeysSize]);
+
+/**
+ * This function encrypts one block with an AES-128 key schedule.
+ *
+ * MUST only be called when `IsAesSupported()` returns TRUE.
+ *
+ * @param[in]   aRoundKeys  A pointer to the key schedule set by `Aes128SetKey()`.
+ * @param[in]   aInput      A pointer to the input block.
+ * @param[out]  aOutput     A pointer to the output block (may be the same as @p aInput).
+ *
+ */
+void Aes128Encrypt(const uint8_t aRoundKeys[kAes128RoundKeysSize], const uint8_t aInput[16], uint8_t aOutput[16]);
+
+/**
+ * This function runs the SHA-256 compression function over whole blocks.
+ *
+ * MUST only be called when `IsSha256Supported()` returns TRUE.
+ *
+ * @param[inout]  aState       The SHA-256 state words.
+ * @param[in]     aBlocks      A pointer to the input blocks.
+ * @param[in]     aBlockCount  The number of @p kSha256BlockSize blocks at @p aBlocks.
+ *
+ */
+void Sha256Process(uint32_t aState[kSha256StateWordCount], const uint8_t *aBlocks, size_t aBlockCount);
+
+#endif // OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
+} // namespace Accel
+
+/**
+ * @}
+ *
+ */
+
+} // namespace Crypto
+} // namespace ot
+
+#endif // CRYPTO_ACCEL_HPP_
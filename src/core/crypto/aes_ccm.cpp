@@ -39,9 +39,20 @@
 namespace ot {
 namespace Crypto {
 
+AesCcm::AesCcm(void)
+    : mKeySchedule(&mEcb)
+{
+}
+
 void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
     mEcb.SetKey(aKey, 8 * aKeyLength);
+    mKeySchedule = &mEcb;
+}
+
+void AesCcm::SetKey(AesEcb &aKeySchedule)
+{
+    mKeySchedule = &aKeySchedule;
 }
 
 otError AesCcm::Init(uint32_t    aHeaderLength,
@@ -120,7 +131,7 @@ otError AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeySchedule->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -179,7 +190,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -193,7 +204,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -220,7 +231,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mKeySchedule->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -237,7 +248,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -250,7 +261,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -269,7 +280,7 @@ void AesCcm::Finalize(void *aTag, uint8_t *aTagLength)
 
     if (mTagLength > 0)
     {
-        mEcb.Encrypt(mCtr, mCtrPad);
+        mKeySchedule->Encrypt(mCtr, mCtrPad);
 
         for (int i = 0; i < mTagLength; i++)
         {
@@ -59,6 +59,12 @@ namespace Crypto {
 class AesCcm
 {
 public:
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    AesCcm(void);
+
     /**
      * This method sets the key.
      *
@@ -68,6 +74,18 @@ public:
      */
     void SetKey(const uint8_t *aKey, uint16_t aKeyLength);
 
+    /**
+     * This method sets the key from an already expanded key schedule.
+     *
+     * This avoids expanding the key again when the same key secures many frames.
+     *
+     * @note The @p aKeySchedule MUST NOT be changed or freed until the AES CCM computation is finished.
+     *
+     * @param[in]  aKeySchedule  A reference to an `AesEcb` with the key set.
+     *
+     */
+    void SetKey(AesEcb &aKeySchedule);
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -123,6 +141,7 @@ private:
     };
 
     AesEcb   mEcb;
+    AesEcb * mKeySchedule;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
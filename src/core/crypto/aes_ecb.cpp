@@ -37,18 +37,41 @@ namespace ot {
 namespace Crypto {
 
 AesEcb::AesEcb()
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    : mUseAccel(false)
+#endif
 {
     mbedtls_aes_init(&mContext);
 }
 
 void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
-    mbedtls_aes_setkey_enc(&mContext, aKey, aKeyLength);
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    mUseAccel = (aKeyLength == 8 * Accel::kAes128KeySize) && Accel::IsAesSupported();
+
+    if (mUseAccel)
+    {
+        Accel::Aes128SetKey(aKey, mRoundKeys);
+    }
+    else
+#endif
+    {
+        mbedtls_aes_setkey_enc(&mContext, aKey, aKeyLength);
+    }
 }
 
 void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
 {
-    mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    if (mUseAccel)
+    {
+        Accel::Aes128Encrypt(mRoundKeys, aInput, aOutput);
+    }
+    else
+#endif
+    {
+        mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+    }
 }
 
 AesEcb::~AesEcb()
@@ -38,6 +38,8 @@
 
 #include <mbedtls/aes.h>
 
+#include "crypto/accel.hpp"
+
 namespace ot {
 namespace Crypto {
 
@@ -51,6 +53,11 @@ namespace Crypto {
 /**
  * This class implements AES ECB computation.
  *
+ * An object holds the expanded key schedule of the key last set, so it can be kept and reused for any number of
+ * blocks (e.g., by `AesCcm`) as long as the key does not change.
+ *
+ * With `OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE`, 128-bit keys use the CPU AES instructions when available.
+ *
  */
 class AesEcb
 {
@@ -76,7 +83,7 @@ public:
      * This method sets the key.
      *
      * @param[in]  aKey        A pointer to the key.
-     * @param[in]  aKeyLength  The key length in bytes.
+     * @param[in]  aKeyLength  The key length in bits.
      *
      */
     void SetKey(const uint8_t *aKey, uint16_t aKeyLength);
@@ -92,6 +99,10 @@ public:
 
 private:
     mbedtls_aes_context mContext;
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    uint8_t mRoundKeys[Accel::kAes128RoundKeysSize];
+    bool    mUseAccel;
+#endif
 };
 
 /**
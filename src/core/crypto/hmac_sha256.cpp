@@ -33,9 +33,74 @@
 
 #include "hmac_sha256.hpp"
 
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+#include <string.h>
+#endif
+
 namespace ot {
 namespace Crypto {
 
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
+HmacSha256::HmacSha256()
+{
+}
+
+HmacSha256::~HmacSha256()
+{
+}
+
+void HmacSha256::Start(const uint8_t *aKey, uint16_t aKeyLength)
+{
+    // Keys longer than the block size are replaced by their hash (RFC 2104).
+
+    memset(mKey, 0, sizeof(mKey));
+
+    if (aKeyLength > sizeof(mKey))
+    {
+        mSha256.Start();
+        mSha256.Update(aKey, aKeyLength);
+        mSha256.Finish(mKey);
+    }
+    else
+    {
+        memcpy(mKey, aKey, aKeyLength);
+    }
+
+    StartHash(kInnerPad);
+}
+
+void HmacSha256::Update(const uint8_t *aBuf, uint16_t aBufLength)
+{
+    mSha256.Update(aBuf, aBufLength);
+}
+
+void HmacSha256::Finish(uint8_t aHash[kHashSize])
+{
+    uint8_t innerHash[kHashSize];
+
+    mSha256.Finish(innerHash);
+
+    StartHash(kOuterPad);
+    mSha256.Update(innerHash, sizeof(innerHash));
+    mSha256.Finish(aHash);
+}
+
+void HmacSha256::StartHash(uint8_t aPad)
+{
+    uint8_t paddedKey[kBlockSize];
+
+    for (uint8_t i = 0; i < kBlockSize; i++)
+    {
+        paddedKey[i] = mKey[i] ^ aPad;
+    }
+
+    mSha256.Start();
+    mSha256.Update(paddedKey, sizeof(paddedKey));
+}
+
+#else // OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
 HmacSha256::HmacSha256()
 {
     const mbedtls_md_info_t *mdInfo = NULL;
@@ -64,5 +129,7 @@ void HmacSha256::Finish(uint8_t aHash[kHashSize])
     mbedtls_md_hmac_finish(&mContext, aHash);
 }
 
+#endif // OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
 } // namespace Crypto
 } // namespace ot
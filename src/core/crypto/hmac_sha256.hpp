@@ -40,6 +40,8 @@
 
 #include <mbedtls/md.h>
 
+#include "crypto/sha256.hpp"
+
 namespace ot {
 namespace Crypto {
 
@@ -53,6 +55,9 @@ namespace Crypto {
 /**
  * This class implements HMAC SHA-256 computation.
  *
+ * With `OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE`, HMAC is computed on top of `Sha256` so that it uses the CPU SHA-256
+ * instructions when available.
+ *
  */
 class HmacSha256
 {
@@ -101,7 +106,21 @@ public:
     void Finish(uint8_t aHash[kHashSize]);
 
 private:
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    enum
+    {
+        kBlockSize = Accel::kSha256BlockSize,
+        kInnerPad  = 0x36,
+        kOuterPad  = 0x5c,
+    };
+
+    void StartHash(uint8_t aPad);
+
+    Sha256  mSha256;
+    uint8_t mKey[kBlockSize];
+#else
     mbedtls_md_context_t mContext;
+#endif
 };
 
 /**
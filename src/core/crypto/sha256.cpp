@@ -33,10 +33,28 @@
 
 #include "sha256.hpp"
 
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#endif
+
 namespace ot {
 namespace Crypto {
 
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+static const uint32_t kInitialState[Accel::kSha256StateWordCount] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+#endif
+
 Sha256::Sha256()
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    : mBufferLength(0)
+    , mLength(0)
+    , mUseAccel(false)
+#endif
 {
     mbedtls_sha256_init(&mContext);
 }
@@ -48,18 +66,122 @@ Sha256::~Sha256()
 
 void Sha256::Start(void)
 {
-    mbedtls_sha256_starts_ret(&mContext, 0);
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    mUseAccel = Accel::IsSha256Supported();
+
+    if (mUseAccel)
+    {
+        memcpy(mState, kInitialState, sizeof(mState));
+        mBufferLength = 0;
+        mLength       = 0;
+    }
+    else
+#endif
+    {
+        mbedtls_sha256_starts_ret(&mContext, 0);
+    }
 }
 
 void Sha256::Update(const uint8_t *aBuf, uint16_t aBufLength)
 {
-    mbedtls_sha256_update_ret(&mContext, aBuf, aBufLength);
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    if (mUseAccel)
+    {
+        UpdateAccel(aBuf, aBufLength);
+    }
+    else
+#endif
+    {
+        mbedtls_sha256_update_ret(&mContext, aBuf, aBufLength);
+    }
 }
 
 void Sha256::Finish(uint8_t aHash[kHashSize])
 {
-    mbedtls_sha256_finish_ret(&mContext, aHash);
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    if (mUseAccel)
+    {
+        FinishAccel(aHash);
+    }
+    else
+#endif
+    {
+        mbedtls_sha256_finish_ret(&mContext, aHash);
+    }
+}
+
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
+void Sha256::UpdateAccel(const uint8_t *aBuf, uint16_t aBufLength)
+{
+    mLength += aBufLength;
+
+    if (mBufferLength > 0)
+    {
+        uint16_t length = sizeof(mBuffer) - mBufferLength;
+
+        if (length > aBufLength)
+        {
+            length = aBufLength;
+        }
+
+        memcpy(&mBuffer[mBufferLength], aBuf, length);
+        mBufferLength += length;
+        aBuf += length;
+        aBufLength -= length;
+
+        if (mBufferLength < sizeof(mBuffer))
+        {
+            ExitNow();
+        }
+
+        Accel::Sha256Process(mState, mBuffer, 1);
+        mBufferLength = 0;
+    }
+
+    // Whole blocks are hashed straight from the input, only the tail is buffered.
+
+    if (aBufLength >= sizeof(mBuffer))
+    {
+        uint16_t blockCount = aBufLength / sizeof(mBuffer);
+
+        Accel::Sha256Process(mState, aBuf, blockCount);
+        aBuf += blockCount * sizeof(mBuffer);
+        aBufLength -= blockCount * sizeof(mBuffer);
+    }
+
+    memcpy(mBuffer, aBuf, aBufLength);
+    mBufferLength = static_cast<uint8_t>(aBufLength);
+
+exit:
+    return;
+}
+
+void Sha256::FinishAccel(uint8_t aHash[kHashSize])
+{
+    const uint8_t kLengthOffset = sizeof(mBuffer) - sizeof(uint64_t);
+
+    mBuffer[mBufferLength++] = 0x80;
+
+    if (mBufferLength > kLengthOffset)
+    {
+        memset(&mBuffer[mBufferLength], 0, sizeof(mBuffer) - mBufferLength);
+        Accel::Sha256Process(mState, mBuffer, 1);
+        mBufferLength = 0;
+    }
+
+    memset(&mBuffer[mBufferLength], 0, kLengthOffset - mBufferLength);
+    Encoding::BigEndian::WriteUint32(static_cast<uint32_t>(mLength >> 29), &mBuffer[kLengthOffset]);
+    Encoding::BigEndian::WriteUint32(static_cast<uint32_t>(mLength << 3), &mBuffer[kLengthOffset + 4]);
+    Accel::Sha256Process(mState, mBuffer, 1);
+
+    for (uint8_t i = 0; i < Accel::kSha256StateWordCount; i++)
+    {
+        Encoding::BigEndian::WriteUint32(mState[i], &aHash[sizeof(uint32_t) * i]);
+    }
 }
 
+#endif // OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+
 } // namespace Crypto
 } // namespace ot
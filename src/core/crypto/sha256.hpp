@@ -40,6 +40,8 @@
 
 #include <mbedtls/sha256.h>
 
+#include "crypto/accel.hpp"
+
 namespace ot {
 namespace Crypto {
 
@@ -53,6 +55,9 @@ namespace Crypto {
 /**
  * This class implements SHA-256 computation.
  *
+ * With `OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE`, the compression function runs on the CPU SHA-256 instructions when
+ * available.
+ *
  */
 class Sha256
 {
@@ -98,7 +103,19 @@ public:
     void Finish(uint8_t aHash[kHashSize]);
 
 private:
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    void UpdateAccel(const uint8_t *aBuf, uint16_t aBufLength);
+    void FinishAccel(uint8_t aHash[kHashSize]);
+#endif
+
     mbedtls_sha256_context mContext;
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    uint32_t mState[Accel::kSha256StateWordCount];
+    uint8_t  mBuffer[Accel::kSha256BlockSize];
+    uint8_t  mBufferLength;
+    uint64_t mLength;
+    bool     mUseAccel;
+#endif
 };
 
 /**
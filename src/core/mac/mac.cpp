@@ -913,7 +913,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame, bool aProcessAesCcm)
 {
     KeyManager &      keyManager = Get<KeyManager>();
     uint8_t           keyIdMode;
-    const ExtAddress *extAddress = NULL;
+    const ExtAddress *extAddress  = NULL;
+    Crypto::AesEcb *  keySchedule = NULL;
 
     VerifyOrExit(aFrame.GetSecurityEnabled());
 
@@ -935,7 +936,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame, bool aProcessAesCcm)
 
     case Frame::kKeyIdMode1:
         aFrame.SetAesKey(keyManager.GetCurrentMacKey());
-        extAddress = &GetExtAddress();
+        keySchedule = &keyManager.GetCurrentMacKeySchedule();
+        extAddress  = &GetExtAddress();
 
         // If the frame is marked as a retransmission, `MeshForwarder` which
         // prepared the frame should set the frame counter and key id to the
@@ -971,7 +973,7 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame, bool aProcessAesCcm)
 
     if (aProcessAesCcm)
     {
-        aFrame.ProcessTransmitAesCcm(*extAddress);
+        aFrame.ProcessTransmitAesCcm(*extAddress, keySchedule);
     }
 
 exit:
@@ -1392,7 +1394,8 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
     uint8_t           tagLength;
     uint8_t           keyid;
     uint32_t          keySequence = 0;
-    const uint8_t *   macKey;
+    const uint8_t *   macKey      = NULL;
+    Crypto::AesEcb *  keySchedule = NULL;
     const ExtAddress *extAddress;
     Crypto::AesCcm    aesCcm;
 
@@ -1422,16 +1425,17 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
         {
             keySequence = keyManager.GetCurrentKeySequence();
             macKey      = keyManager.GetCurrentMacKey();
+            keySchedule = &keyManager.GetCurrentMacKeySchedule();
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() - 1) & 0x7f))
         {
             keySequence = keyManager.GetCurrentKeySequence() - 1;
-            macKey      = keyManager.GetTemporaryMacKey(keySequence);
+            keySchedule = keyManager.GetTemporaryMacKeySchedule(keySequence);
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() + 1) & 0x7f))
         {
             keySequence = keyManager.GetCurrentKeySequence() + 1;
-            macKey      = keyManager.GetTemporaryMacKey(keySequence);
+            keySchedule = keyManager.GetTemporaryMacKeySchedule(keySequence);
         }
         else
         {
@@ -1473,7 +1477,14 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
     KeyManager::GenerateNonce(*extAddress, frameCounter, securityLevel, nonce);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
-    aesCcm.SetKey(macKey, 16);
+    if (keySchedule != NULL)
+    {
+        aesCcm.SetKey(*keySchedule);
+    }
+    else
+    {
+        aesCcm.SetKey(macKey, 16);
+    }
 
     SuccessOrExit(aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce)));
 
@@ -1000,10 +1000,11 @@ void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 #endif
 }
 
-void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb *aKeySchedule)
 {
 #if OPENTHREAD_RADIO
     OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aKeySchedule);
 #else
     uint32_t       frameCounter = 0;
     uint8_t        securityLevel;
@@ -1019,7 +1020,15 @@ void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
 
     KeyManager::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey(), 16);
+    if (aKeySchedule != NULL)
+    {
+        aesCcm.SetKey(*aKeySchedule);
+    }
+    else
+    {
+        aesCcm.SetKey(GetAesKey(), 16);
+    }
+
     tagLength = GetFooterLength() - Frame::kFcsSize;
 
     error = aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -44,6 +44,10 @@
 
 namespace ot {
 
+namespace Crypto {
+class AesEcb;
+}
+
 namespace Mac {
 
 /**
@@ -1096,11 +1100,13 @@ public:
     /**
      * This method performs AES CCM on the frame which is going to be sent.
      *
-     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
-     *                          for AES CCM computation.
+     * @param[in]  aExtAddress   A reference to the extended address, which will be used to generate nonce
+     *                           for AES CCM computation.
+     * @param[in]  aKeySchedule  A pointer to the expanded key schedule of the frame's key, or NULL to expand the key
+     *                           set by `SetAesKey()`.
      *
      */
-    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb *aKeySchedule = NULL);
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
      * This method sets the Time IE offset.
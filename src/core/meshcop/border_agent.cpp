@@ -255,6 +255,9 @@ void BorderAgent::HandleCoapResponse(void *               aContext,
                               Tlv::GetTlv(*response, Tlv::kCommissionerSessionId, sizeof(sessionIdTlv), sessionIdTlv));
             VerifyOrExit(sessionIdTlv.IsValid(), error = OT_ERROR_PARSE);
 
+            // A new petition in the same session gets a new session id, so remove the
+            // previous ALOC before changing it.
+            instance.Get<ThreadNetif>().RemoveUnicastAddress(borderAgent.mCommissionerAloc);
             instance.Get<Mle::MleRouter>().GetCommissionerAloc(borderAgent.mCommissionerAloc.GetAddress(),
                                                                sessionIdTlv.GetCommissionerSessionId());
             instance.Get<ThreadNetif>().AddUnicastAddress(borderAgent.mCommissionerAloc);
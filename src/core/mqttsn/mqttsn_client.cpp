@@ -249,7 +249,7 @@ Message* WaitingMessagesQueue<CallbackType>::Find(uint16_t aMessageId, MessageMe
 }
 
 template <typename CallbackType>
-otError WaitingMessagesQueue<CallbackType>::HandleTimer()
+otError WaitingMessagesQueue<CallbackType>::HandleTimer(TimeMilli &aNextTime)
 {
     otError error = OT_ERROR_NONE;
     Message* message = mQueue.GetHead();
@@ -259,9 +259,11 @@ otError WaitingMessagesQueue<CallbackType>::HandleTimer()
         Message* current = message;
         message = message->GetNext();
         MessageMetadata<CallbackType> metadata;
+        TimeMilli expireTime;
         metadata.ReadFrom(*current);
+        expireTime = TimeMilli(metadata.mTimestamp + metadata.mRetransmissionTimeout);
         // check if message timed out
-        if (metadata.mTimestamp + metadata.mRetransmissionTimeout <= TimerMilli::GetNow().GetValue())
+        if (expireTime <= TimerMilli::GetNow())
         {
             if (metadata.mRetransmissionCount > 0)
             {
@@ -276,6 +278,11 @@ otError WaitingMessagesQueue<CallbackType>::HandleTimer()
                 metadata.mTimestamp = TimerMilli::GetNow().GetValue();
                 // Update message metadata
                 metadata.UpdateIn(*current);
+                expireTime = TimeMilli(metadata.mTimestamp + metadata.mRetransmissionTimeout);
+                if (expireTime < aNextTime)
+                {
+                    aNextTime = expireTime;
+                }
             }
             else
             {
@@ -287,6 +294,10 @@ otError WaitingMessagesQueue<CallbackType>::HandleTimer()
                 SuccessOrExit(error = Dequeue(*current));
             }
         }
+        else if (expireTime < aNextTime)
+        {
+            aNextTime = expireTime;
+        }
     }
 exit:
     return error;
@@ -329,6 +340,7 @@ MqttsnClient::MqttsnClient(Instance& instance)
     , mIsRunning(false)
     , mActiveGateways()
     , mProcessTask(instance, &MqttsnClient::HandleProcessTask, this)
+    , mProcessTimer(instance, &MqttsnClient::HandleProcessTimer, this)
     , mSubscribeQueue(HandleSubscribeTimeout, this, HandleSubscribeRetransmission, this)
     , mRegisterQueue(HandleRegisterTimeout, this, HandleMessageRetransmission, this)
     , mUnsubscribeQueue(HandleUnsubscribeTimeout, this, HandleMessageRetransmission, this)
@@ -449,6 +461,9 @@ void MqttsnClient::HandleUdpReceive(void *aContext, otMessage *aMessage, const o
     default:
         break;
     }
+
+    // Received message may change client state or pending messages, reschedule process timer
+    client->mProcessTask.Post();
 }
 
 void MqttsnClient::ConnackReceived(const Ip6::MessageInfo &messageInfo, const unsigned char* data, uint16_t length)
@@ -1114,6 +1129,15 @@ void MqttsnClient::HandleProcessTask(Tasklet &aTasklet)
     }
 }
 
+void MqttsnClient::HandleProcessTimer(Timer &aTimer)
+{
+    otError error = aTimer.GetOwner<MqttsnClient>().Process();
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnMqttsn("Process timer failed: %s", otThreadErrorToString(error));
+    }
+}
+
 otError MqttsnClient::Start(uint16_t aPort)
 {
     otError error = OT_ERROR_NONE;
@@ -1136,6 +1160,7 @@ exit:
 otError MqttsnClient::Stop()
 {
     mIsRunning = false;
+    mProcessTimer.Stop();
     otError error = mSocket.Close();
     // Clear active gateways list because ADVERTISE messages won't be received anymore
     mActiveGateways.Clear();
@@ -1155,34 +1180,45 @@ otError MqttsnClient::Stop()
 otError MqttsnClient::Process()
 {
     otError error = OT_ERROR_NONE;
-    uint32_t now = TimerMilli::GetNow().GetValue();
-
-    if (mIsRunning)
-    {
-        // Enqueue again if client running
-        SuccessOrExit(error = mProcessTask.Post());
-    }
+    TimeMilli now = TimerMilli::GetNow();
+    TimeMilli nextTime = now.GetDistantFuture();
 
     // Process keep alive and send periodical PINGREQ message
-    if (mClientState == kStateActive && mPingReqTime != 0 && mPingReqTime <= now)
+    if (mClientState == kStateActive && mPingReqTime != 0 && TimeMilli(mPingReqTime) <= now)
     {
         SuccessOrExit(error = PingGateway());
     }
 
     // Handle pending messages timeouts
-    SuccessOrExit(error = mConnectQueue.HandleTimer());
-    SuccessOrExit(error = mSubscribeQueue.HandleTimer());
-    SuccessOrExit(error = mRegisterQueue.HandleTimer());
-    SuccessOrExit(error = mUnsubscribeQueue.HandleTimer());
-    SuccessOrExit(error = mPublishQos1Queue.HandleTimer());
-    SuccessOrExit(error = mPublishQos2PublishQueue.HandleTimer());
-    SuccessOrExit(error = mPublishQos2PubrelQueue.HandleTimer());
-    SuccessOrExit(error = mPublishQos2PubrecQueue.HandleTimer());
-    SuccessOrExit(error = mPingreqQueue.HandleTimer());
-    SuccessOrExit(error = mDisconnectQueue.HandleTimer());
+    SuccessOrExit(error = mConnectQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mSubscribeQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mRegisterQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mUnsubscribeQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mPublishQos1Queue.HandleTimer(nextTime));
+    SuccessOrExit(error = mPublishQos2PublishQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mPublishQos2PubrelQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mPublishQos2PubrecQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mPingreqQueue.HandleTimer(nextTime));
+    SuccessOrExit(error = mDisconnectQueue.HandleTimer(nextTime));
 
     // Handle active gateways
-    SuccessOrExit(error = mActiveGateways.HandleTimer());
+    SuccessOrExit(error = mActiveGateways.HandleTimer(nextTime));
+
+    // Next PINGREQ is sent only when there is no PINGREQ waiting for response
+    if (mClientState == kStateActive && mPingReqTime != 0 && mPingreqQueue.IsEmpty())
+    {
+        TimeMilli pingTime(mPingReqTime);
+
+        if (pingTime < now)
+        {
+            pingTime = now;
+        }
+
+        if (pingTime < nextTime)
+        {
+            nextTime = pingTime;
+        }
+    }
 
 exit:
     // Handle communication timeout
@@ -1199,10 +1235,23 @@ exit:
         }
     }
     mTimeoutRaised = false;
-    // Only enqueue process when client running and is not asleep
-    if (mIsRunning && mClientState != kStateAsleep)
+    // Only schedule process when client running and is not asleep
+    if (!mIsRunning || mClientState == kStateAsleep)
     {
-        mProcessTask.Post();
+        mProcessTimer.Stop();
+    }
+    else if (error != OT_ERROR_NONE)
+    {
+        // Processing was interrupted, e.g. by lack of buffers, try again later
+        mProcessTimer.Start(kProcessRetryInterval);
+    }
+    else if (nextTime < now.GetDistantFuture())
+    {
+        mProcessTimer.FireAt(nextTime);
+    }
+    else
+    {
+        mProcessTimer.Stop();
     }
     return error;
 }
@@ -1598,6 +1647,8 @@ otError MqttsnClient::SendMessageWithRetransmission(Message &aMessage, WaitingMe
             mConfig.GetRetransmissionTimeout() * 1000,
             mConfig.GetRetransmissionCount(), aCallback, aContext);
     SuccessOrExit(error = aQueue.EnqueueCopy(*messageCopy, messageCopy->GetLength(), metadata));
+    // Reschedule process timer to cover retransmission of the new message
+    mProcessTask.Post();
 exit:
     if (messageCopy)
     {
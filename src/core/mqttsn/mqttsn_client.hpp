@@ -32,6 +32,7 @@
 #include "mqttsn/mqttsn_gateway_list.hpp"
 #include "common/locator.hpp"
 #include "common/tasklet.hpp"
+#include "common/timer.hpp"
 #include "net/ip6_address.hpp"
 #include "net/udp6.hpp"
 #include <openthread/mqttsn.h>
@@ -440,10 +441,13 @@ public:
     /**
      * Evaluate queued messages timeout and retransmission.
      *
+     * @param[inout]  aNextTime  A reference to the next fire time. It is updated if any message remaining in the queue
+     *                           times out earlier than the given time.
+     *
      * @retval OT_ERROR_NONE  Timeouts were successfully processed.
      *
      */
-    otError HandleTimer(void);
+    otError HandleTimer(TimeMilli &aNextTime);
 
     /**
      * Force waiting messages timeout, invoke callback and empty queue.
@@ -697,6 +701,9 @@ public:
     /**
      * Process service workers.
      *
+     * Handles due keep alive and retransmission timeouts and schedules the process timer to the earliest pending
+     * deadline, so the client stays idle while there is nothing to do.
+     *
      * @retval OT_ERROR_NONE  Successfully processed.
      *
      */
@@ -1043,6 +1050,11 @@ protected:
     bool VerifyGatewayAddress(const Ip6::MessageInfo &aMessageInfo);
 
 private:
+    enum
+    {
+        kProcessRetryInterval = 100, ///< Delay before retrying interrupted processing (in milliseconds).
+    };
+
     uint16_t GetNextMessageId(void);
     void ResetPingreqTime(void);
     void WakeUp(void);
@@ -1067,6 +1079,8 @@ private:
 
     static void HandleProcessTask(Tasklet &aTasklet);
 
+    static void HandleProcessTimer(Timer &aTimer);
+
     static void HandleSubscribeTimeout(const MessageMetadata<otMqttsnSubscribedHandler> &aMetadata, void* aContext);
 
     static void HandleRegisterTimeout(const MessageMetadata<otMqttsnRegisteredHandler> &aMetadata, void* aContext);
@@ -1103,6 +1117,7 @@ private:
     bool mIsRunning;
     ActiveGatewayList mActiveGateways;
     Tasklet mProcessTask;
+    TimerMilli mProcessTimer;
     WaitingMessagesQueue<otMqttsnSubscribedHandler> mSubscribeQueue;
     WaitingMessagesQueue<otMqttsnRegisteredHandler> mRegisterQueue;
     WaitingMessagesQueue<otMqttsnUnsubscribedHandler> mUnsubscribeQueue;
@@ -147,29 +147,42 @@ void ActiveGatewayList::Clear()
 
 otError ActiveGatewayList::HandleTimer(void)
 {
-	otError error = OT_ERROR_NONE;
-	StaticListEntry<GatewayInfo> *entry = NULL;
-	uint32_t millisNow;
+    TimeMilli nextTime = TimerMilli::GetNow().GetDistantFuture();
+
+    return HandleTimer(nextTime);
+}
+
+otError ActiveGatewayList::HandleTimer(TimeMilli &aNextTime)
+{
+    otError error = OT_ERROR_NONE;
+    StaticListEntry<GatewayInfo> *entry = NULL;
+    TimeMilli now;
     if (mGatewayInfoList.IsEmpty())
     {
         ExitNow(error = OT_ERROR_NONE);
     }
-	millisNow = TimerMilli::GetNow().GetValue();
+    now = TimerMilli::GetNow();
     entry = mGatewayInfoList.GetHead();
     // Find all expired gateways in the list and remove them
     do
     {
         StaticListEntry<GatewayInfo> *currentEntry = entry;
         GatewayInfo &info = currentEntry->GetValue();
+        // Gateway is considered inactive once its duration has fully elapsed
+        TimeMilli expireTime(info.mLastUpdatedTimestamp + info.mDuration + 1);
         entry = currentEntry->GetNext();
-        if (millisNow > info.mLastUpdatedTimestamp + info.mDuration)
+        if (now >= expireTime)
         {
             SuccessOrExit(error = mGatewayInfoList.Remove(*currentEntry));
         }
+        else if (expireTime < aNextTime)
+        {
+            aNextTime = expireTime;
+        }
     }
     while (entry != NULL);
 exit:
-	return error;
+    return error;
 }
 
 GatewayInfo *ActiveGatewayList::Find(GatewayId aGatewayId)
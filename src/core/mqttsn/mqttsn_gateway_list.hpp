@@ -32,6 +32,7 @@
 #include <openthread/mqttsn.h>
 #include "net/ip6_address.hpp"
 #include "common/linked_list.hpp"
+#include "common/time.hpp"
 
 /**
  * @file
@@ -374,6 +375,18 @@ public:
      */
     otError HandleTimer(void);
 
+    /**
+     * This method checks active gateways in the list, removes inactive gateways and reports the time when the next
+     * remaining gateway expires.
+     *
+     * @param[inout]  aNextTime  A reference to the next fire time. It is updated if any remaining gateway expires
+     *                           earlier than the given time.
+     *
+     * @retval OT_ERROR_NONE  Operation was successfully executed.
+     *
+     */
+    otError HandleTimer(TimeMilli &aNextTime);
+
     /**
      * Get list of active gateways.
      *
@@ -80,10 +80,51 @@ const otNetifMulticastAddress Netif::kLinkLocalAllRoutersMulticastAddress = {
     {{{0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02}}},
     &Netif::kRealmLocalAllRoutersMulticastAddress};
 
+void NetifAddressFilter::Add(const Address &aAddress)
+{
+    uint8_t index = GetIndex(aAddress);
+
+    // A saturated counter sticks, it only makes the filter report more false positives.
+    if (mCounters[index] != kMaxCounterValue)
+    {
+        mCounters[index]++;
+    }
+
+    mCount++;
+}
+
+bool NetifAddressFilter::Remove(const Address &aAddress)
+{
+    bool    rval  = false;
+    uint8_t index = GetIndex(aAddress);
+
+    // A saturated counter no longer knows how many addresses it holds, and an empty one means the filter is out of
+    // sync with the address list.
+    VerifyOrExit(mCounters[index] != 0 && mCounters[index] != kMaxCounterValue && mCount != 0);
+
+    mCounters[index]--;
+    mCount--;
+    rval = true;
+
+exit:
+    return rval;
+}
+
+uint8_t NetifAddressFilter::GetIndex(const Address &aAddress)
+{
+    uint32_t hash = aAddress.mFields.m32[0] ^ aAddress.mFields.m32[1] ^ aAddress.mFields.m32[2] ^
+                    aAddress.mFields.m32[3];
+
+    // Fibonacci hashing, keeping the top bits of the product.
+    return static_cast<uint8_t>(((hash * 2654435761U) >> 24) % kNumCounters);
+}
+
 Netif::Netif(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mUnicastAddresses()
     , mMulticastAddresses()
+    , mUnicastFilter()
+    , mMulticastFilter()
     , mMulticastPromiscuous(false)
     , mAddressCallback(NULL)
     , mAddressCallbackContext(NULL)
@@ -104,6 +145,8 @@ bool Netif::IsMulticastSubscribed(const Address &aAddress) const
 {
     bool rval = false;
 
+    VerifyOrExit(mMulticastFilter.MayContain(aAddress));
+
     for (const NetifMulticastAddress *cur = mMulticastAddresses.GetHead(); cur; cur = cur->GetNext())
     {
         if (cur->GetAddress() == aAddress)
@@ -141,6 +184,11 @@ otError Netif::SubscribeAllNodesMulticast(void)
         tail->SetNext(&linkLocalAllNodesAddress);
     }
 
+    for (const NetifMulticastAddress *entry = &linkLocalAllNodesAddress; entry; entry = entry->GetNext())
+    {
+        mMulticastFilter.Add(entry->GetAddress());
+    }
+
     Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_SUBSCRIBED);
 
     VerifyOrExit(mAddressCallback != NULL);
@@ -189,6 +237,8 @@ otError Netif::UnsubscribeAllNodesMulticast(void)
         prev->SetNext(NULL);
     }
 
+    RebuildMulticastFilter();
+
     Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_UNSUBSCRIBED);
 
     VerifyOrExit(mAddressCallback != NULL);
@@ -245,6 +295,12 @@ otError Netif::SubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllRoutersAddress);
     }
 
+    for (const NetifMulticastAddress *entry = &linkLocalAllRoutersAddress; entry != &linkLocalAllNodesAddress;
+         entry                              = entry->GetNext())
+    {
+        mMulticastFilter.Add(entry->GetAddress());
+    }
+
     Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_SUBSCRIBED);
 
     VerifyOrExit(mAddressCallback != NULL);
@@ -289,6 +345,8 @@ otError Netif::UnsubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllNodesAddress);
     }
 
+    RebuildMulticastFilter();
+
     Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_UNSUBSCRIBED);
 
     VerifyOrExit(mAddressCallback != NULL);
@@ -305,9 +363,16 @@ exit:
 
 otError Netif::SubscribeMulticast(NetifMulticastAddress &aAddress)
 {
-    otError error;
+    otError error = mMulticastAddresses.Add(aAddress);
+
+    if (error == OT_ERROR_ALREADY)
+    {
+        // The entry may have been changed in place since it was subscribed.
+        RebuildMulticastFilter();
+    }
 
-    SuccessOrExit(error = mMulticastAddresses.Add(aAddress));
+    SuccessOrExit(error);
+    mMulticastFilter.Add(aAddress.GetAddress());
 
     Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_SUBSCRIBED);
 
@@ -323,6 +388,7 @@ otError Netif::UnsubscribeMulticast(const NetifMulticastAddress &aAddress)
     otError error;
 
     SuccessOrExit(error = mMulticastAddresses.Remove(aAddress));
+    RemoveFromMulticastFilter(aAddress.GetAddress());
 
     Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_UNSUBSCRIBED);
 
@@ -380,6 +446,7 @@ otError Netif::SubscribeExternalMulticast(const Address &aAddress)
         {
             entry->mAddress = aAddress;
             mMulticastAddresses.Push(*entry);
+            mMulticastFilter.Add(aAddress);
             Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_SUBSCRIBED);
             ExitNow();
         }
@@ -421,6 +488,7 @@ otError Netif::UnsubscribeExternalMulticast(const Address &aAddress)
 
     VerifyOrExit(entry != NULL, error = OT_ERROR_NOT_FOUND);
 
+    RemoveFromMulticastFilter(entry->GetAddress());
     entry->MarkAsNotInUse();
 
     Get<Notifier>().Signal(OT_CHANGED_IP6_MULTICAST_UNSUBSCRIBED);
@@ -449,9 +517,16 @@ void Netif::SetAddressCallback(otIp6AddressCallback aCallback, void *aCallbackCo
 
 otError Netif::AddUnicastAddress(NetifUnicastAddress &aAddress)
 {
-    otError error;
+    otError error = mUnicastAddresses.Add(aAddress);
+
+    if (error == OT_ERROR_ALREADY)
+    {
+        // The entry may have been changed in place since it was added.
+        RebuildUnicastFilter();
+    }
 
-    SuccessOrExit(error = mUnicastAddresses.Add(aAddress));
+    SuccessOrExit(error);
+    mUnicastFilter.Add(aAddress.GetAddress());
 
     Get<Notifier>().Signal(aAddress.mRloc ? OT_CHANGED_THREAD_RLOC_ADDED : OT_CHANGED_IP6_ADDRESS_ADDED);
 
@@ -467,6 +542,7 @@ otError Netif::RemoveUnicastAddress(const NetifUnicastAddress &aAddress)
     otError error;
 
     SuccessOrExit(error = mUnicastAddresses.Remove(aAddress));
+    RemoveFromUnicastFilter(aAddress.GetAddress());
 
     Get<Notifier>().Signal(aAddress.mRloc ? OT_CHANGED_THREAD_RLOC_REMOVED : OT_CHANGED_IP6_ADDRESS_REMOVED);
 
@@ -504,6 +580,7 @@ otError Netif::AddExternalUnicastAddress(const NetifUnicastAddress &aAddress)
         {
             *entry = aAddress;
             mUnicastAddresses.Push(*entry);
+            mUnicastFilter.Add(entry->GetAddress());
             Get<Notifier>().Signal(OT_CHANGED_IP6_ADDRESS_ADDED);
             ExitNow();
         }
@@ -545,6 +622,7 @@ otError Netif::RemoveExternalUnicastAddress(const Address &aAddress)
 
     VerifyOrExit(entry != NULL, error = OT_ERROR_NOT_FOUND);
 
+    RemoveFromUnicastFilter(entry->GetAddress());
     entry->MarkAsNotInUse();
 
     Get<Notifier>().Signal(OT_CHANGED_IP6_ADDRESS_REMOVED);
@@ -564,10 +642,48 @@ void Netif::RemoveAllExternalUnicastAddresses(void)
     }
 }
 
+void Netif::RebuildUnicastFilter(void)
+{
+    mUnicastFilter.Clear();
+
+    for (const NetifUnicastAddress *entry = mUnicastAddresses.GetHead(); entry; entry = entry->GetNext())
+    {
+        mUnicastFilter.Add(entry->GetAddress());
+    }
+}
+
+void Netif::RebuildMulticastFilter(void)
+{
+    mMulticastFilter.Clear();
+
+    for (const NetifMulticastAddress *entry = mMulticastAddresses.GetHead(); entry; entry = entry->GetNext())
+    {
+        mMulticastFilter.Add(entry->GetAddress());
+    }
+}
+
+void Netif::RemoveFromUnicastFilter(const Address &aAddress)
+{
+    if (!mUnicastFilter.Remove(aAddress))
+    {
+        RebuildUnicastFilter();
+    }
+}
+
+void Netif::RemoveFromMulticastFilter(const Address &aAddress)
+{
+    if (!mMulticastFilter.Remove(aAddress))
+    {
+        RebuildMulticastFilter();
+    }
+}
+
 bool Netif::IsUnicastAddress(const Address &aAddress) const
 {
     bool rval = false;
 
+    VerifyOrExit(mUnicastFilter.MayContain(aAddress));
+
     for (const NetifUnicastAddress *cur = mUnicastAddresses.GetHead(); cur; cur = cur->GetNext())
     {
         if (cur->GetAddress() == aAddress)
@@ -165,6 +165,80 @@ private:
     void MarkAsNotInUse(void) { mNext = this; }
 };
 
+/**
+ * This class implements a counting filter over a set of IPv6 addresses.
+ *
+ * The filter answers "definitely not in the set" without walking the address lists, which is the common case for
+ * datagrams that are forwarded. A positive answer still needs to be confirmed against the list.
+ *
+ */
+class NetifAddressFilter
+{
+public:
+    /**
+     * This constructor initializes the filter as empty.
+     *
+     */
+    NetifAddressFilter(void) { Clear(); }
+
+    /**
+     * This method empties the filter.
+     *
+     */
+    void Clear(void) { memset(this, 0, sizeof(*this)); }
+
+    /**
+     * This method adds an address to the filter.
+     *
+     * @param[in]  aAddress  The address to add.
+     *
+     */
+    void Add(const Address &aAddress);
+
+    /**
+     * This method removes an address previously added to the filter.
+     *
+     * @param[in]  aAddress  The address to remove.
+     *
+     * @retval TRUE   If @p aAddress was removed.
+     * @retval FALSE  If the filter can no longer track the set (a counter saturated or would underflow) and needs to
+     *                be rebuilt from the address list.
+     *
+     */
+    bool Remove(const Address &aAddress);
+
+    /**
+     * This method indicates whether an address may have been added to the filter.
+     *
+     * @param[in]  aAddress  The address to check.
+     *
+     * @retval TRUE   If @p aAddress may be in the set.
+     * @retval FALSE  If @p aAddress is definitely not in the set.
+     *
+     */
+    bool MayContain(const Address &aAddress) const { return mCounters[GetIndex(aAddress)] != 0; }
+
+    /**
+     * This method returns the number of addresses in the filter.
+     *
+     * @returns The number of addresses in the filter.
+     *
+     */
+    uint16_t GetCount(void) const { return mCount; }
+
+private:
+    enum
+    {
+        kNumCounters     = 32,   ///< Number of counters (must be a power of two).
+        kMaxCounterValue = 0xff, ///< Value at which a counter saturates.
+    };
+
+    static uint8_t GetIndex(const Address &aAddress);
+
+    uint16_t mCount;
+    uint8_t  mCounters[kNumCounters];
+};
+
 /**
  * This class implements an IPv6 network interface.
  *
@@ -199,9 +273,22 @@ public:
      */
     const NetifUnicastAddress *GetUnicastAddresses(void) const { return mUnicastAddresses.GetHead(); }
 
+    /**
+     * This method returns the number of unicast addresses assigned to the network interface.
+     *
+     * @returns The number of unicast addresses.
+     *
+     */
+    uint16_t GetUnicastAddressCount(void) const { return mUnicastFilter.GetCount(); }
+
     /**
      * This method adds a unicast address to the network interface.
      *
+     * @note The address MUST NOT be modified in place while it is added, since the address lookup filter keeps counts
+     *       derived from it. To change it, remove it with `RemoveUnicastAddress()`, update it, then add it again. If
+     *       an added entry is changed in place anyway, calling this method again with it (returning
+     *       `OT_ERROR_ALREADY`) re-syncs the filter.
+     *
      * @param[in]  aAddress  A reference to the unicast address.
      *
      * @retval OT_ERROR_NONE      Successfully added the unicast address.
@@ -301,9 +388,22 @@ public:
      */
     const NetifMulticastAddress *GetMulticastAddresses(void) const { return mMulticastAddresses.GetHead(); }
 
+    /**
+     * This method returns the number of multicast addresses the network interface is subscribed to.
+     *
+     * @returns The number of multicast addresses.
+     *
+     */
+    uint16_t GetMulticastAddressCount(void) const { return mMulticastFilter.GetCount(); }
+
     /**
      * This method subscribes the network interface to a multicast address.
      *
+     * @note The address MUST NOT be modified in place while it is subscribed, since the address lookup filter keeps
+     *       counts derived from it. To change it, unsubscribe it with `UnsubscribeMulticast()`, update it, then
+     *       subscribe it again. If a subscribed entry is changed in place anyway, calling this method again with it
+     *       (returning `OT_ERROR_ALREADY`) re-syncs the filter.
+     *
      * @param[in]  aAddress  A reference to the multicast address.
      *
      * @retval OT_ERROR_NONE     Successfully subscribed to @p aAddress.
@@ -413,8 +513,15 @@ private:
         kMulticastPrefixLength = 128, ///< Multicast prefix length used to notify internal address changes.
     };
 
+    void RebuildUnicastFilter(void);
+    void RebuildMulticastFilter(void);
+    void RemoveFromUnicastFilter(const Address &aAddress);
+    void RemoveFromMulticastFilter(const Address &aAddress);
+
     LinkedList<NetifUnicastAddress>   mUnicastAddresses;
     LinkedList<NetifMulticastAddress> mMulticastAddresses;
+    NetifAddressFilter                mUnicastFilter;
+    NetifAddressFilter                mMulticastFilter;
     bool                              mMulticastPromiscuous;
 
     otIp6AddressCallback mAddressCallback;
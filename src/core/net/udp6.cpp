@@ -63,7 +63,8 @@ static bool IsMle(Instance &aInstance, uint16_t aPort)
 UdpSocket::UdpSocket(Udp &aUdp)
     : InstanceLocator(aUdp.GetInstance())
 {
-    mHandle = NULL;
+    mHandle       = NULL;
+    mNextInBucket = NULL;
 }
 
 Message *UdpSocket::NewMessage(uint16_t aReserved, const otMessageSettings *aSettings)
@@ -75,6 +76,9 @@ otError UdpSocket::Open(otUdpReceive aHandler, void *aContext)
 {
     otError error = OT_ERROR_NONE;
 
+    // Drop the index entry of a socket that is opened again.
+    Get<Udp>().RemoveSocket(*this);
+
     GetSockName().Clear();
     GetPeerName().Clear();
     mHandler = aHandler;
@@ -94,7 +98,8 @@ exit:
 
 otError UdpSocket::Bind(const SockAddr &aSockAddr)
 {
-    otError error = OT_ERROR_NONE;
+    otError  error   = OT_ERROR_NONE;
+    uint16_t oldPort = mSockName.mPort;
 
     mSockName = aSockAddr;
 
@@ -115,6 +120,8 @@ otError UdpSocket::Bind(const SockAddr &aSockAddr)
     }
 #endif
 
+    Get<Udp>().UpdateSocketPort(*this, oldPort);
+
     return error;
 }
 
@@ -202,6 +209,38 @@ exit:
     return error;
 }
 
+uint8_t UdpSocket::GetMatchScore(const MessageInfo &aMessageInfo)
+{
+    // A matching socket scores one, plus one for each bound address or connected peer field it matches exactly.
+    uint8_t score = 0;
+
+    VerifyOrExit(GetSockName().mPort == aMessageInfo.GetSockPort());
+    score = 1;
+
+    // the bound address is not checked for multicast destinations
+    if (!aMessageInfo.GetSockAddr().IsMulticast() && !GetSockName().GetAddress().IsUnspecified())
+    {
+        VerifyOrExit(GetSockName().GetAddress() == aMessageInfo.GetSockAddr(), score = 0);
+        score++;
+    }
+
+    // verify source if connected socket
+    if (GetPeerName().mPort != 0)
+    {
+        VerifyOrExit(GetPeerName().mPort == aMessageInfo.GetPeerPort(), score = 0);
+        score++;
+
+        if (!GetPeerName().GetAddress().IsUnspecified())
+        {
+            VerifyOrExit(GetPeerName().GetAddress() == aMessageInfo.GetPeerAddr(), score = 0);
+            score++;
+        }
+    }
+
+exit:
+    return score;
+}
+
 Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
@@ -212,6 +251,7 @@ Udp::Udp(Instance &aInstance)
     , mUdpForwarder(NULL)
 #endif
 {
+    memset(mSocketBuckets, 0, sizeof(mSocketBuckets));
 }
 
 otError Udp::AddReceiver(UdpReceiver &aReceiver)
@@ -232,18 +272,68 @@ exit:
 
 void Udp::AddSocket(UdpSocket &aSocket)
 {
-    mSockets.Add(aSocket);
+    SuccessOrExit(mSockets.Add(aSocket));
+    AddToBucket(aSocket);
+
+exit:
+    return;
 }
 
 void Udp::RemoveSocket(UdpSocket &aSocket)
 {
     SuccessOrExit(mSockets.Remove(aSocket));
+    RemoveFromBucket(aSocket, aSocket.GetSockName().mPort);
     aSocket.SetNext(NULL);
 
 exit:
     return;
 }
 
+void Udp::AddToBucket(UdpSocket &aSocket)
+{
+    UdpSocket *&head = mSocketBuckets[GetBucketIndex(aSocket.GetSockName().mPort)];
+
+    aSocket.mNextInBucket = head;
+    head                  = &aSocket;
+}
+
+bool Udp::RemoveFromBucket(UdpSocket &aSocket, uint16_t aPort)
+{
+    UdpSocket *&head    = mSocketBuckets[GetBucketIndex(aPort)];
+    UdpSocket * prev    = NULL;
+    bool        removed = false;
+
+    for (UdpSocket *socket = head; socket; prev = socket, socket = socket->GetNextInBucket())
+    {
+        if (socket == &aSocket)
+        {
+            if (prev == NULL)
+            {
+                head = aSocket.GetNextInBucket();
+            }
+            else
+            {
+                prev->mNextInBucket = aSocket.mNextInBucket;
+            }
+
+            aSocket.mNextInBucket = NULL;
+            removed               = true;
+            break;
+        }
+    }
+
+    return removed;
+}
+
+void Udp::UpdateSocketPort(UdpSocket &aSocket, uint16_t aOldPort)
+{
+    // Only open sockets are indexed, a socket that is not found is left alone.
+    if (RemoveFromBucket(aSocket, aOldPort))
+    {
+        AddToBucket(aSocket);
+    }
+}
+
 uint16_t Udp::GetEphemeralPort(void)
 {
     uint16_t rval = mEphemeralPort;
@@ -341,40 +431,30 @@ exit:
 
 void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
-    // find socket
-    for (UdpSocket *socket = mSockets.GetHead(); socket; socket = socket->GetNext())
+    UdpSocket *socket    = mSocketBuckets[GetBucketIndex(aMessageInfo.GetSockPort())];
+    UdpSocket *match     = NULL;
+    uint8_t    bestScore = 0;
+
+    // find the most specific socket bound to the destination port
+    for (; socket; socket = socket->GetNextInBucket())
     {
-        if (socket->GetSockName().mPort != aMessageInfo.GetSockPort())
-        {
-            continue;
-        }
+        uint8_t score = socket->GetMatchScore(aMessageInfo);
 
-        if (!aMessageInfo.GetSockAddr().IsMulticast() && !socket->GetSockName().GetAddress().IsUnspecified() &&
-            socket->GetSockName().GetAddress() != aMessageInfo.GetSockAddr())
+        if (score > bestScore)
         {
-            continue;
+            match     = socket;
+            bestScore = score;
         }
+    }
 
-        // verify source if connected socket
-        if (socket->GetPeerName().mPort != 0)
-        {
-            if (socket->GetPeerName().mPort != aMessageInfo.GetPeerPort())
-            {
-                continue;
-            }
+    VerifyOrExit(match != NULL);
 
-            if (!socket->GetPeerName().GetAddress().IsUnspecified() &&
-                socket->GetPeerName().GetAddress() != aMessageInfo.GetPeerAddr())
-            {
-                continue;
-            }
-        }
+    aMessage.RemoveHeader(aMessage.GetOffset());
+    assert(aMessage.GetOffset() == 0);
+    match->HandleUdpReceive(aMessage, aMessageInfo);
 
-        aMessage.RemoveHeader(aMessage.GetOffset());
-        assert(aMessage.GetOffset() == 0);
-        socket->HandleUdpReceive(aMessage, aMessageInfo);
-        break;
-    }
+exit:
+    return;
 }
 
 void Udp::UpdateChecksum(Message &aMessage, uint16_t aChecksum)
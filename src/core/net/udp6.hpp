@@ -200,6 +200,10 @@ public:
     SockAddr &GetPeerName(void) { return *static_cast<SockAddr *>(&mPeerName); }
 
 private:
+    UdpSocket *GetNextInBucket(void) { return static_cast<UdpSocket *>(mNextInBucket); }
+
+    uint8_t GetMatchScore(const MessageInfo &aMessageInfo);
+
     void HandleUdpReceive(Message &aMessage, const MessageInfo &aMessageInfo)
     {
         mHandler(mContext, &aMessage, &aMessageInfo);
@@ -349,9 +353,24 @@ private:
         kDynamicPortMax = 65535, ///< Service Name and Transport Protocol Port Number Registry
     };
 
+    enum
+    {
+        kSocketBuckets = 16, ///< Number of port buckets indexing the sockets (must be a power of two).
+    };
+
+    static uint8_t GetBucketIndex(uint16_t aPort)
+    {
+        return static_cast<uint8_t>((aPort ^ (aPort >> 8)) & (kSocketBuckets - 1));
+    }
+
+    void AddToBucket(UdpSocket &aSocket);
+    bool RemoveFromBucket(UdpSocket &aSocket, uint16_t aPort);
+    void UpdateSocketPort(UdpSocket &aSocket, uint16_t aOldPort);
+
     uint16_t                mEphemeralPort;
     LinkedList<UdpReceiver> mReceivers;
     LinkedList<UdpSocket>   mSockets;
+    UdpSocket *             mSocketBuckets[kSocketBuckets];
 #if OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE
     void *         mUdpForwarderContext;
     otUdpForwarder mUdpForwarder;
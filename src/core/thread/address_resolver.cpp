@@ -61,6 +61,7 @@ AddressResolver::AddressResolver(Instance &aInstance)
     , mTimer(aInstance, &AddressResolver::HandleTimer, this)
 {
     Clear();
+    ResetCounters();
 
     Get<Coap::Coap>().AddResource(mAddressError);
     Get<Coap::Coap>().AddResource(mAddressQuery);
@@ -73,20 +74,38 @@ void AddressResolver::Clear(void)
 {
     memset(&mCache, 0, sizeof(mCache));
 
-    for (uint8_t i = 0; i < kCacheEntries; i++)
+    for (uint16_t bucket = 0; bucket < kCacheHashSize; bucket++)
     {
-        mCache[i].mAge = i;
+        mCacheHash[bucket] = kInvalidIndex;
     }
+
+    for (CacheIndex i = 0; i < kCacheEntries; i++)
+    {
+        mCache[i].mPrev = (i > 0) ? static_cast<CacheIndex>(i - 1) : static_cast<CacheIndex>(kInvalidIndex);
+        mCache[i].mNext =
+            (i + 1 < kCacheEntries) ? static_cast<CacheIndex>(i + 1) : static_cast<CacheIndex>(kInvalidIndex);
+    }
+
+    mLruHead = 0;
+    mLruTail = kCacheEntries - 1;
 }
 
-otError AddressResolver::GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const
+otError AddressResolver::GetEntry(uint16_t aIndex, otEidCacheEntry &aEntry) const
 {
-    otError error = OT_ERROR_NONE;
+    otError  error = OT_ERROR_NONE;
+    uint16_t age   = 0;
 
     VerifyOrExit(aIndex < kCacheEntries, error = OT_ERROR_INVALID_ARGS);
+
+    // The age is the position of the entry in the LRU list.
+    for (CacheIndex index = mLruHead; index != aIndex; index = mCache[index].mNext)
+    {
+        age++;
+    }
+
     aEntry.mTarget = mCache[aIndex].mTarget;
     aEntry.mRloc16 = mCache[aIndex].mRloc16;
-    aEntry.mAge    = mCache[aIndex].mAge;
+    aEntry.mAge    = (age < 0xff) ? static_cast<uint8_t>(age) : 0xff;
     aEntry.mValid  = mCache[aIndex].mState == Cache::kStateCached;
 
 exit:
@@ -117,37 +136,54 @@ void AddressResolver::Remove(uint16_t aRloc16)
 
 void AddressResolver::Remove(const Ip6::Address &aEid)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    Cache *entry = FindCacheEntry(aEid);
+
+    if (entry != NULL)
     {
-        if (mCache[i].mState == Cache::kStateInvalid || mCache[i].mTarget != aEid)
+        InvalidateCacheEntry(*entry, kReasonRemovingEid);
+    }
+}
+
+AddressResolver::Cache *AddressResolver::FindCacheEntry(const Ip6::Address &aEid)
+{
+    Cache *entry = NULL;
+
+    // The hash table is never more than half full, so probing always ends at an empty bucket.
+    for (uint16_t bucket = HashEid(aEid); mCacheHash[bucket] != kInvalidIndex; bucket = GetNextBucket(bucket))
+    {
+        if (mCache[mCacheHash[bucket]].mTarget == aEid)
         {
-            continue;
+            entry = &mCache[mCacheHash[bucket]];
+            break;
         }
-
-        InvalidateCacheEntry(mCache[i], kReasonRemovingEid);
-        break;
     }
+
+    return entry;
 }
 
 AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
 {
     Cache *rval = NULL;
 
-    for (int i = 0; i < kCacheEntries; i++)
+    // Pick the least recently used entry which is not waiting for its first Address Query response.
+    for (CacheIndex index = mLruTail; index != kInvalidIndex; index = mCache[index].mPrev)
     {
-        if (mCache[i].mState == Cache::kStateQuery && mCache[i].mFailures == 0)
+        if (mCache[index].mState == Cache::kStateQuery && mCache[index].mFailures == 0)
         {
             continue;
         }
 
-        if (rval == NULL || rval->mAge < mCache[i].mAge)
-        {
-            rval = &mCache[i];
-        }
+        rval = &mCache[index];
+        break;
     }
 
     if (rval != NULL)
     {
+        if (rval->mState != Cache::kStateInvalid)
+        {
+            mCounters.mEvictions++;
+        }
+
         InvalidateCacheEntry(*rval, kReasonEvictingForNewEntry);
     }
 
@@ -156,15 +192,132 @@ AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
 
 void AddressResolver::MarkCacheEntryAsUsed(Cache &aEntry)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    LruRemove(aEntry);
+    LruPushFront(aEntry);
+}
+
+uint16_t AddressResolver::HashEid(const Ip6::Address &aEid)
+{
+    uint32_t hash = 0;
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(aEid.mFields.m32); i++)
     {
-        if (mCache[i].mAge < aEntry.mAge)
+        hash ^= aEid.mFields.m32[i];
+    }
+
+    // Multiplicative hashing to spread the folded address bits over the buckets.
+    hash *= 2654435761u;
+
+    return static_cast<uint16_t>((hash >> 16) % kCacheHashSize);
+}
+
+void AddressResolver::AddToHash(const Cache &aEntry)
+{
+    uint16_t bucket = HashEid(aEntry.mTarget);
+
+    while (mCacheHash[bucket] != kInvalidIndex)
+    {
+        bucket = GetNextBucket(bucket);
+    }
+
+    mCacheHash[bucket] = GetCacheIndex(aEntry);
+}
+
+void AddressResolver::RemoveFromHash(const Cache &aEntry)
+{
+    CacheIndex index  = GetCacheIndex(aEntry);
+    uint16_t   bucket = HashEid(aEntry.mTarget);
+
+    while (mCacheHash[bucket] != index)
+    {
+        assert(mCacheHash[bucket] != kInvalidIndex);
+        bucket = GetNextBucket(bucket);
+    }
+
+    mCacheHash[bucket] = kInvalidIndex;
+
+    // Shift back the following entries of the probe sequence so that lookups do not stop at the emptied bucket.
+    for (uint16_t next = GetNextBucket(bucket); mCacheHash[next] != kInvalidIndex; next = GetNextBucket(next))
+    {
+        uint16_t home = HashEid(mCache[mCacheHash[next]].mTarget);
+        bool     keep;
+
+        // The entry stays if its home bucket lies cyclically within (bucket, next].
+        if (bucket < next)
+        {
+            keep = (bucket < home) && (home <= next);
+        }
+        else
         {
-            mCache[i].mAge++;
+            keep = (bucket < home) || (home <= next);
         }
+
+        if (!keep)
+        {
+            mCacheHash[bucket] = mCacheHash[next];
+            mCacheHash[next]   = kInvalidIndex;
+            bucket             = next;
+        }
+    }
+}
+
+void AddressResolver::LruRemove(Cache &aEntry)
+{
+    if (aEntry.mPrev != kInvalidIndex)
+    {
+        mCache[aEntry.mPrev].mNext = aEntry.mNext;
+    }
+    else
+    {
+        mLruHead = aEntry.mNext;
+    }
+
+    if (aEntry.mNext != kInvalidIndex)
+    {
+        mCache[aEntry.mNext].mPrev = aEntry.mPrev;
+    }
+    else
+    {
+        mLruTail = aEntry.mPrev;
+    }
+}
+
+void AddressResolver::LruPushFront(Cache &aEntry)
+{
+    CacheIndex index = GetCacheIndex(aEntry);
+
+    aEntry.mPrev = kInvalidIndex;
+    aEntry.mNext = mLruHead;
+
+    if (mLruHead != kInvalidIndex)
+    {
+        mCache[mLruHead].mPrev = index;
+    }
+    else
+    {
+        mLruTail = index;
     }
 
-    aEntry.mAge = 0;
+    mLruHead = index;
+}
+
+void AddressResolver::LruPushBack(Cache &aEntry)
+{
+    CacheIndex index = GetCacheIndex(aEntry);
+
+    aEntry.mPrev = mLruTail;
+    aEntry.mNext = kInvalidIndex;
+
+    if (mLruTail != kInvalidIndex)
+    {
+        mCache[mLruTail].mNext = index;
+    }
+    else
+    {
+        mLruHead = index;
+    }
+
+    mLruTail = index;
 }
 
 const char *AddressResolver::InvalidationReasonToString(InvalidationReason aReason)
@@ -201,12 +354,12 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aRe
 {
     OT_UNUSED_VARIABLE(aReason);
 
-    for (int i = 0; i < kCacheEntries; i++)
+    LruRemove(aEntry);
+    LruPushBack(aEntry);
+
+    if (aEntry.mState != Cache::kStateInvalid)
     {
-        if (mCache[i].mAge > aEntry.mAge)
-        {
-            mCache[i].mAge--;
-        }
+        RemoveFromHash(aEntry);
     }
 
     switch (aEntry.mState)
@@ -226,43 +379,36 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aRe
         break;
     }
 
-    aEntry.mAge   = kCacheEntries - 1;
     aEntry.mState = Cache::kStateInvalid;
 }
 
 otError AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
-    otError error = OT_ERROR_NOT_FOUND;
+    otError error = OT_ERROR_NONE;
+    Cache * entry = FindCacheEntry(aEid);
 
-    for (int i = 0; i < kCacheEntries; i++)
+    VerifyOrExit(entry != NULL, error = OT_ERROR_NOT_FOUND);
+
+    if (entry->mRloc16 != aRloc16)
     {
-        if (mCache[i].mState == Cache::kStateInvalid || mCache[i].mTarget != aEid)
-        {
-            continue;
-        }
+        // not updating the age here is intentional because this cache entry is not actually being used
+        entry->mRloc16 = aRloc16;
 
-        if (mCache[i].mRloc16 != aRloc16)
+        if (entry->mState != Cache::kStateCached)
         {
-            // not updating the age here is intentional because this cache entry is not actually being used
-            mCache[i].mRloc16 = aRloc16;
-
-            if (mCache[i].mState != Cache::kStateCached)
-            {
-                mCache[i].mRetryTimeout        = 0;
-                mCache[i].mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
-                mCache[i].mTimeout             = 0;
-                mCache[i].mFailures            = 0;
-                mCache[i].mState               = Cache::kStateCached;
+            entry->mRetryTimeout        = 0;
+            entry->mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
+            entry->mTimeout             = 0;
+            entry->mFailures            = 0;
+            entry->mState               = Cache::kStateCached;
 
-                Get<MeshForwarder>().HandleResolved(aEid, OT_ERROR_NONE);
-            }
-
-            otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
+            Get<MeshForwarder>().HandleResolved(aEid, OT_ERROR_NONE);
         }
 
-        error = OT_ERROR_NONE;
+        otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
     }
 
+exit:
     return error;
 }
 
@@ -279,6 +425,7 @@ otError AddressResolver::AddCacheEntry(const Ip6::Address &aEid, Mac::ShortAddre
     entry->mFailures = 0;
     entry->mState    = Cache::kStateCached;
 
+    AddToHash(*entry);
     MarkCacheEntryAsUsed(*entry);
 
 exit:
@@ -307,19 +454,7 @@ void AddressResolver::RestartAddressQueries(void)
 otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
 {
     otError error = OT_ERROR_NONE;
-    Cache * entry = NULL;
-
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState != Cache::kStateInvalid)
-        {
-            if (mCache[i].mTarget == aEid)
-            {
-                entry = &mCache[i];
-                break;
-            }
-        }
-    }
+    Cache * entry = FindCacheEntry(aEid);
 
     if (entry == NULL)
     {
@@ -338,7 +473,8 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
         entry->mFailures     = 0;
         entry->mRetryTimeout = kAddressQueryInitialRetryDelay;
         entry->mState        = Cache::kStateQuery;
-        error                = OT_ERROR_ADDRESS_QUERY;
+        AddToHash(*entry);
+        error = OT_ERROR_ADDRESS_QUERY;
         break;
 
     case Cache::kStateQuery:
@@ -366,6 +502,16 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
     }
 
 exit:
+
+    if (error == OT_ERROR_NONE)
+    {
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
     return error;
 }
 
@@ -423,6 +569,7 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     ThreadRloc16Tlv              rloc16Tlv;
     ThreadLastTransactionTimeTlv lastTransactionTimeTlv;
     uint32_t                     lastTransactionTime;
+    Cache *                      entry;
 
     VerifyOrExit(aMessage.GetType() == OT_COAP_TYPE_CONFIRMABLE && aMessage.GetCode() == OT_COAP_CODE_POST);
 
@@ -450,56 +597,51 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
                  HostSwap16(aMessageInfo.GetPeerAddr().mFields.m16[7]), targetTlv.GetTarget().ToString().AsCString(),
                  rloc16Tlv.GetRloc16());
 
-    for (int i = 0; i < kCacheEntries; i++)
+    entry = FindCacheEntry(targetTlv.GetTarget());
+    VerifyOrExit(entry != NULL);
+
+    switch (entry->mState)
     {
-        if (mCache[i].mTarget != targetTlv.GetTarget())
-        {
-            continue;
-        }
+    case Cache::kStateInvalid:
+        break;
 
-        switch (mCache[i].mState)
+    case Cache::kStateCached:
+        if (entry->mLastTransactionTime != kLastTransactionTimeInvalid)
         {
-        case Cache::kStateInvalid:
-            break;
-
-        case Cache::kStateCached:
-            if (mCache[i].mLastTransactionTime != kLastTransactionTimeInvalid)
+            if (memcmp(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid)) != 0)
             {
-                if (memcmp(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid)) != 0)
-                {
-                    SendAddressError(targetTlv, mlIidTlv, NULL);
-                    ExitNow();
-                }
-
-                if (lastTransactionTime >= mCache[i].mLastTransactionTime)
-                {
-                    ExitNow();
-                }
+                SendAddressError(targetTlv, mlIidTlv, NULL);
+                ExitNow();
             }
 
-            // fall through
+            if (lastTransactionTime >= entry->mLastTransactionTime)
+            {
+                ExitNow();
+            }
+        }
 
-        case Cache::kStateQuery:
-            memcpy(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid));
-            mCache[i].mRloc16              = rloc16Tlv.GetRloc16();
-            mCache[i].mRetryTimeout        = 0;
-            mCache[i].mLastTransactionTime = lastTransactionTime;
-            mCache[i].mTimeout             = 0;
-            mCache[i].mFailures            = 0;
-            mCache[i].mState               = Cache::kStateCached;
-            MarkCacheEntryAsUsed(mCache[i]);
+        // fall through
 
-            otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
-                         targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
+    case Cache::kStateQuery:
+        memcpy(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid));
+        entry->mRloc16              = rloc16Tlv.GetRloc16();
+        entry->mRetryTimeout        = 0;
+        entry->mLastTransactionTime = lastTransactionTime;
+        entry->mTimeout             = 0;
+        entry->mFailures            = 0;
+        entry->mState               = Cache::kStateCached;
+        MarkCacheEntryAsUsed(*entry);
 
-            if (Get<Coap::Coap>().SendEmptyAck(aMessage, aMessageInfo) == OT_ERROR_NONE)
-            {
-                otLogInfoArp("Sending address notification acknowledgment");
-            }
+        otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
+                     targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
 
-            Get<MeshForwarder>().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
-            break;
+        if (Get<Coap::Coap>().SendEmptyAck(aMessage, aMessageInfo) == OT_ERROR_NONE)
+        {
+            otLogInfoArp("Sending address notification acknowledgment");
         }
+
+        Get<MeshForwarder>().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
+        break;
     }
 
 exit:
@@ -805,19 +947,16 @@ void AddressResolver::HandleIcmpReceive(Message &               aMessage,
     OT_UNUSED_VARIABLE(aMessageInfo);
 
     Ip6::Header ip6Header;
+    Cache *     entry;
 
     VerifyOrExit(aIcmpHeader.GetType() == Ip6::IcmpHeader::kTypeDstUnreach);
     VerifyOrExit(aIcmpHeader.GetCode() == Ip6::IcmpHeader::kCodeDstUnreachNoRoute);
     VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(ip6Header), &ip6Header) == sizeof(ip6Header));
 
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState != Cache::kStateInvalid && mCache[i].mTarget == ip6Header.GetDestination())
-        {
-            InvalidateCacheEntry(mCache[i], kReasonReceivedIcmpDstUnreachNoRoute);
-            break;
-        }
-    }
+    entry = FindCacheEntry(ip6Header.GetDestination());
+    VerifyOrExit(entry != NULL);
+
+    InvalidateCacheEntry(*entry, kReasonReceivedIcmpDstUnreachNoRoute);
 
 exit:
     return;
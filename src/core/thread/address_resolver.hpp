@@ -43,6 +43,7 @@
 #include "net/icmp6.hpp"
 #include "net/udp6.hpp"
 #include "thread/thread_tlvs.hpp"
+#include "utils/static_assert.hpp"
 
 namespace ot {
 
@@ -84,7 +85,7 @@ public:
      * @retval OT_ERROR_INVALID_ARGS  @p aIndex was out of bounds.
      *
      */
-    otError GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const;
+    otError GetEntry(uint16_t aIndex, otEidCacheEntry &aEntry) const;
 
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
@@ -156,13 +157,38 @@ public:
      */
     void RestartAddressQueries(void);
 
+    /**
+     * This method gets the EID cache counters.
+     *
+     * @returns A reference to the EID cache counters.
+     *
+     */
+    const otEidCacheCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the EID cache counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
 private:
+    // Index of a cache entry, wide enough to also hold `kInvalidIndex`.
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES < 0xff
+    typedef uint8_t CacheIndex;
+#else
+    typedef uint16_t CacheIndex;
+#endif
+
     enum
     {
         kCacheEntries      = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES,
-        kStateUpdatePeriod = 1000u, ///< State update period in milliseconds.
+        kCacheHashSize     = 2 * kCacheEntries,           ///< Number of hash buckets (keeps load factor at most 1/2).
+        kInvalidIndex      = static_cast<CacheIndex>(-1), ///< Marks an empty hash bucket or the end of the LRU list.
+        kStateUpdatePeriod = 1000u,                       ///< State update period in milliseconds.
     };
 
+    OT_STATIC_ASSERT(kCacheHashSize <= 0xffff, "OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES must be below 32768");
+
     /**
      * Thread Protocol Parameters and Constants
      *
@@ -195,7 +221,8 @@ private:
         uint16_t          mRetryTimeout;
         uint8_t           mTimeout;
         uint8_t           mFailures;
-        uint8_t           mAge;
+        CacheIndex        mPrev; ///< Index of the next more recently used entry (`kInvalidIndex` if none).
+        CacheIndex        mNext; ///< Index of the next less recently used entry (`kInvalidIndex` if none).
         State             mState;
     };
 
@@ -210,10 +237,22 @@ private:
 
     static const char *InvalidationReasonToString(InvalidationReason aReason);
 
+    Cache *FindCacheEntry(const Ip6::Address &aEid);
     Cache *NewCacheEntry(void);
     void   MarkCacheEntryAsUsed(Cache &aEntry);
     void   InvalidateCacheEntry(Cache &aEntry, InvalidationReason aReason);
 
+    CacheIndex GetCacheIndex(const Cache &aEntry) const { return static_cast<CacheIndex>(&aEntry - mCache); }
+
+    static uint16_t HashEid(const Ip6::Address &aEid);
+    static uint16_t GetNextBucket(uint16_t aBucket) { return (aBucket + 1 < kCacheHashSize) ? aBucket + 1 : 0; }
+    void            AddToHash(const Cache &aEntry);
+    void            RemoveFromHash(const Cache &aEntry);
+
+    void LruRemove(Cache &aEntry);
+    void LruPushFront(Cache &aEntry);
+    void LruPushBack(Cache &aEntry);
+
     otError SendAddressQuery(const Ip6::Address &aEid);
     otError SendAddressError(const ThreadTargetTlv &      aTarget,
                              const ThreadMeshLocalEidTlv &aEid,
@@ -243,12 +282,16 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    Coap::Resource   mAddressError;
-    Coap::Resource   mAddressQuery;
-    Coap::Resource   mAddressNotification;
-    Cache            mCache[kCacheEntries];
-    Ip6::IcmpHandler mIcmpHandler;
-    TimerMilli       mTimer;
+    Coap::Resource     mAddressError;
+    Coap::Resource     mAddressQuery;
+    Coap::Resource     mAddressNotification;
+    Cache              mCache[kCacheEntries];
+    CacheIndex         mCacheHash[kCacheHashSize]; ///< Open addressing index of valid entries by EID (linear probing).
+    CacheIndex         mLruHead;                   ///< Index of the most recently used entry.
+    CacheIndex         mLruTail;                   ///< Index of the least recently used entry.
+    otEidCacheCounters mCounters;
+    Ip6::IcmpHandler   mIcmpHandler;
+    TimerMilli         mTimer;
 };
 
 /**
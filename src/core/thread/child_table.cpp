@@ -107,9 +107,13 @@ ChildTable::ChildTable(Instance &aInstance)
 
 void ChildTable::Clear(void)
 {
+    mRloc16Index.Clear();
+    mExtAddressIndex.Clear();
+
     for (Child *child = &mChildren[0]; child < OT_ARRAY_END(mChildren); child++)
     {
         child->Clear();
+        UpdateChildIndex(*child);
     }
 }
 
@@ -133,6 +137,7 @@ Child *ChildTable::GetNewChild(void)
         if (child->IsStateInvalid())
         {
             child->Clear();
+            UpdateChildIndex(*child);
             ExitNow();
         }
     }
@@ -143,38 +148,57 @@ exit:
     return child;
 }
 
+void ChildTable::SetChildRloc16(Child &aChild, uint16_t aRloc16)
+{
+    aChild.SetRloc16(aRloc16);
+    mRloc16Index.Update(GetChildIndex(aChild), aRloc16);
+}
+
+void ChildTable::SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress)
+{
+    aChild.SetExtAddress(aAddress);
+    mExtAddressIndex.Update(GetChildIndex(aChild), HashExtAddress(aAddress));
+}
+
+void ChildTable::UpdateChildIndex(Child &aChild)
+{
+    uint16_t childIndex = GetChildIndex(aChild);
+
+    mRloc16Index.Update(childIndex, aChild.GetRloc16());
+    mExtAddressIndex.Update(childIndex, HashExtAddress(aChild.GetExtAddress()));
+}
+
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
-    Child *child = mChildren;
+    Child *child = NULL;
 
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    for (uint16_t index = mRloc16Index.GetHead(aRloc16); index != kInvalidIndex; index = mRloc16Index.GetNext(index))
     {
-        if (child->MatchesFilter(aFilter) && (child->GetRloc16() == aRloc16))
+        if ((index < mMaxChildrenAllowed) && mChildren[index].MatchesFilter(aFilter) &&
+            (mChildren[index].GetRloc16() == aRloc16))
         {
-            ExitNow();
+            ExitNow(child = &mChildren[index]);
         }
     }
 
-    child = NULL;
-
 exit:
     return child;
 }
 
 Child *ChildTable::FindChild(const Mac::ExtAddress &aAddress, Child::StateFilter aFilter)
 {
-    Child *child = mChildren;
+    Child *child = NULL;
 
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    for (uint16_t index = mExtAddressIndex.GetHead(HashExtAddress(aAddress)); index != kInvalidIndex;
+         index = mExtAddressIndex.GetNext(index))
     {
-        if (child->MatchesFilter(aFilter) && (child->GetExtAddress() == aAddress))
+        if ((index < mMaxChildrenAllowed) && mChildren[index].MatchesFilter(aFilter) &&
+            (mChildren[index].GetExtAddress() == aAddress))
         {
-            ExitNow();
+            ExitNow(child = &mChildren[index]);
         }
     }
 
-    child = NULL;
-
 exit:
     return child;
 }
@@ -246,6 +270,61 @@ exit:
     return error;
 }
 
+uint16_t ChildTable::HashExtAddress(const Mac::ExtAddress &aAddress)
+{
+    uint16_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aAddress.m8); i += 2)
+    {
+        hash ^= static_cast<uint16_t>((aAddress.m8[i] << 8) | aAddress.m8[i + 1]);
+    }
+
+    return hash;
+}
+
+void ChildTable::HashIndex::Clear(void)
+{
+    for (uint16_t bucket = 0; bucket < kNumHashBuckets; bucket++)
+    {
+        mHeads[bucket] = kInvalidIndex;
+    }
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        mNext[index]    = kInvalidIndex;
+        mBuckets[index] = kInvalidIndex;
+    }
+}
+
+void ChildTable::HashIndex::Update(uint16_t aChildIndex, uint16_t aHash)
+{
+    uint16_t  bucket = aHash % kNumHashBuckets;
+    uint16_t *prevNext;
+
+    VerifyOrExit(mBuckets[aChildIndex] != bucket);
+
+    // Unlink the entry from its current bucket (if any).
+
+    if (mBuckets[aChildIndex] != kInvalidIndex)
+    {
+        for (prevNext = &mHeads[mBuckets[aChildIndex]]; *prevNext != kInvalidIndex; prevNext = &mNext[*prevNext])
+        {
+            if (*prevNext == aChildIndex)
+            {
+                *prevNext = mNext[aChildIndex];
+                break;
+            }
+        }
+    }
+
+    mNext[aChildIndex]    = mHeads[bucket];
+    mHeads[bucket]        = aChildIndex;
+    mBuckets[aChildIndex] = bucket;
+
+exit:
+    return;
+}
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -187,6 +187,24 @@ public:
      */
     Child *GetNewChild(void);
 
+    /**
+     * This method sets the RLOC16 of a `Child` entry and updates the child table index accordingly.
+     *
+     * @param[in]  aChild   A reference to the `Child` entry.
+     * @param[in]  aRloc16  The RLOC16 value.
+     *
+     */
+    void SetChildRloc16(Child &aChild, uint16_t aRloc16);
+
+    /**
+     * This method sets the extended address of a `Child` entry and updates the child table index accordingly.
+     *
+     * @param[in]  aChild    A reference to the `Child` entry.
+     * @param[in]  aAddress  The extended address.
+     *
+     */
+    void SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress);
+
     /**
      * This method searches the child table for a `Child` with a given RLOC16 also matching a given state filter.
      *
@@ -278,11 +296,38 @@ public:
 private:
     enum
     {
-        kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kMaxChildren    = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kNumHashBuckets = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kInvalidIndex   = 0xffff,
+    };
+
+    /**
+     * This class implements a hash index mapping a key hash to the child entries using it.
+     *
+     * Every child entry is always linked in exactly one bucket of the index.
+     *
+     */
+    class HashIndex
+    {
+    public:
+        void     Clear(void);
+        void     Update(uint16_t aChildIndex, uint16_t aHash);
+        uint16_t GetHead(uint16_t aHash) const { return mHeads[aHash % kNumHashBuckets]; }
+        uint16_t GetNext(uint16_t aChildIndex) const { return mNext[aChildIndex]; }
+
+    private:
+        uint16_t mHeads[kNumHashBuckets];
+        uint16_t mNext[kMaxChildren];
+        uint16_t mBuckets[kMaxChildren];
     };
 
-    uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+    void            UpdateChildIndex(Child &aChild);
+    static uint16_t HashExtAddress(const Mac::ExtAddress &aAddress);
+
+    uint16_t  mMaxChildrenAllowed;
+    Child     mChildren[kMaxChildren];
+    HashIndex mRloc16Index;
+    HashIndex mExtAddressIndex;
 };
 
 #endif // OPENTHREAD_FTD
@@ -316,6 +361,9 @@ public:
 
     Child *GetNewChild(void) { return NULL; }
 
+    void SetChildRloc16(Child &, uint16_t) {}
+    void SetChildExtAddress(Child &, const Mac::ExtAddress &) {}
+
     Child *FindChild(uint16_t, Child::StateFilter) { return NULL; }
     Child *FindChild(const Mac::ExtAddress &, Child::StateFilter) { return NULL; }
     Child *FindChild(const Mac::Address &, Child::StateFilter) { return NULL; }
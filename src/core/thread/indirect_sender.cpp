@@ -63,13 +63,17 @@ const Mac::Address &IndirectSender::ChildInfo::GetMacAddress(Mac::Address &aMacA
 IndirectSender::IndirectSender(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+    , mFreeMessageRefs(NULL)
     , mSourceMatchController(aInstance)
     , mDataPollHandler(aInstance)
 {
+    ResetMessageRefs();
 }
 
 void IndirectSender::Stop(void)
 {
+    ChildTable &childTable = Get<ChildTable>();
+
     VerifyOrExit(mEnabled);
 
     for (ChildTable::Iterator iter(GetInstance(), Child::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
@@ -78,6 +82,20 @@ void IndirectSender::Stop(void)
         mSourceMatchController.ResetMessageCount(*iter.GetChild());
     }
 
+    // Message references may also be held by children that were
+    // removed but not yet cleaned up, so reset the queues of all
+    // children before reclaiming the references.
+
+    for (uint16_t index = 0; index < childTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *child = childTable.GetChildAtIndex(index);
+
+        child->mIndirectQueue         = NULL;
+        child->mIndirectQueueOverflow = false;
+    }
+
+    ResetMessageRefs();
+
     mDataPollHandler.Clear();
 
 exit:
@@ -94,7 +112,13 @@ otError IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChil
     childIndex = Get<ChildTable>().GetChildIndex(aChild);
     VerifyOrExit(!aMessage.GetChildMask(childIndex), error = OT_ERROR_ALREADY);
 
+    if (aChild.GetIndirectMessageCount() == 0)
+    {
+        aChild.mIndirectQueueOverflow = false;
+    }
+
     aMessage.SetChildMask(childIndex);
+    AddMessageRef(aChild, aMessage);
     mSourceMatchController.IncrementMessageCount(aChild);
 
     RequestMessageUpdate(aChild);
@@ -111,6 +135,7 @@ otError IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &a
     VerifyOrExit(aMessage.GetChildMask(childIndex), error = OT_ERROR_NOT_FOUND);
 
     aMessage.ClearChildMask(childIndex);
+    RemoveMessageRef(aChild, aMessage);
     mSourceMatchController.DecrementMessageCount(aChild);
 
     RequestMessageUpdate(aChild);
@@ -121,16 +146,36 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
-    Message *message;
-    Message *nextMessage;
+    uint16_t    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    MessageRef *ref        = NULL;
+    Message *   message;
+    Message *   nextMessage;
 
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+    if (aChild.mIndirectQueueOverflow)
     {
-        nextMessage = message->GetNext();
+        message = Get<MeshForwarder>().GetNextQueuedMessage(NULL);
+    }
+    else
+    {
+        ref     = aChild.mIndirectQueue;
+        message = (ref != NULL) ? ref->mMessage : NULL;
+    }
+
+    for (; message != NULL; message = nextMessage)
+    {
+        if (aChild.mIndirectQueueOverflow)
+        {
+            nextMessage = Get<MeshForwarder>().GetNextQueuedMessage(message);
+        }
+        else
+        {
+            ref         = ref->mNext;
+            nextMessage = (ref != NULL) ? ref->mMessage : NULL;
+        }
 
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        message->ClearChildMask(childIndex);
 
         if (!message->IsChildPending() && !message->GetDirectTransmission())
         {
@@ -139,11 +184,12 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
                 Get<MeshForwarder>().mSendMessage = NULL;
             }
 
-            Get<MeshForwarder>().mSendQueue.Dequeue(*message);
+            Get<MeshForwarder>().DequeueMessage(*message);
             message->Free();
         }
     }
 
+    ClearMessageRefs(aChild);
     aChild.SetIndirectMessage(NULL);
     mSourceMatchController.ResetMessageCount(aChild);
 
@@ -175,17 +221,36 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
-        uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        MeshForwarder &meshForwarder = Get<MeshForwarder>();
+        uint16_t       childIndex    = Get<ChildTable>().GetChildIndex(aChild);
+
+        if (aChild.mIndirectQueueOverflow)
+        {
+            Message *next;
 
-        for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+            for (Message *message = meshForwarder.GetNextQueuedMessage(NULL); message; message = next)
+            {
+                next = meshForwarder.GetNextQueuedMessage(message);
+
+                if (message->GetChildMask(childIndex))
+                {
+                    message->ClearChildMask(childIndex);
+                    message->SetDirectTransmission();
+                    meshForwarder.UpdateSendQueue(*message);
+                }
+            }
+        }
+        else
         {
-            if (message->GetChildMask(childIndex))
+            for (MessageRef *ref = aChild.mIndirectQueue; ref != NULL; ref = ref->mNext)
             {
-                message->ClearChildMask(childIndex);
-                message->SetDirectTransmission();
+                ref->mMessage->ClearChildMask(childIndex);
+                ref->mMessage->SetDirectTransmission();
+                meshForwarder.UpdateSendQueue(*ref->mMessage);
             }
         }
 
+        ClearMessageRefs(aChild);
         aChild.SetIndirectMessage(NULL);
         mSourceMatchController.ResetMessageCount(aChild);
 
@@ -202,13 +267,32 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild)
 {
-    Message *message;
-    Message *next;
-    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    uint16_t    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    MessageRef *ref        = NULL;
+    Message *   message;
+    Message *   next;
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = next)
+    if (aChild.mIndirectQueueOverflow)
     {
-        next = message->GetNext();
+        message = Get<MeshForwarder>().GetNextQueuedMessage(NULL);
+    }
+    else
+    {
+        ref     = aChild.mIndirectQueue;
+        message = (ref != NULL) ? ref->mMessage : NULL;
+    }
+
+    for (; message; message = next)
+    {
+        if (aChild.mIndirectQueueOverflow)
+        {
+            next = Get<MeshForwarder>().GetNextQueuedMessage(message);
+        }
+        else
+        {
+            ref  = ref->mNext;
+            next = (ref != NULL) ? ref->mMessage : NULL;
+        }
 
         if (message->GetChildMask(childIndex))
         {
@@ -218,8 +302,9 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild)
             if ((message->GetType() == Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
             {
                 message->ClearChildMask(childIndex);
+                RemoveMessageRef(aChild, *message);
                 mSourceMatchController.DecrementMessageCount(aChild);
-                Get<MeshForwarder>().mSendQueue.Dequeue(*message);
+                Get<MeshForwarder>().DequeueMessage(*message);
                 message->Free();
                 continue;
             }
@@ -536,12 +621,13 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         if (message->GetChildMask(childIndex))
         {
             message->ClearChildMask(childIndex);
+            RemoveMessageRef(aChild, *message);
             mSourceMatchController.DecrementMessageCount(aChild);
         }
 
         if (!message->GetDirectTransmission() && !message->IsChildPending())
         {
-            Get<MeshForwarder>().mSendQueue.Dequeue(*message);
+            Get<MeshForwarder>().DequeueMessage(*message);
             message->Free();
         }
     }
@@ -568,6 +654,95 @@ void IndirectSender::ClearMessagesForRemovedChildren(void)
     }
 }
 
+void IndirectSender::ResetMessageRefs(void)
+{
+    mFreeMessageRefs = NULL;
+
+    for (MessageRef *ref = OT_ARRAY_END(mMessageRefs); ref != mMessageRefs;)
+    {
+        ref--;
+        ref->mMessage    = NULL;
+        ref->mNext       = mFreeMessageRefs;
+        mFreeMessageRefs = ref;
+    }
+}
+
+void IndirectSender::AddMessageRef(Child &aChild, Message &aMessage)
+{
+    MessageRef * ref = mFreeMessageRefs;
+    MessageRef **prevNext;
+
+    VerifyOrExit(!aChild.mIndirectQueueOverflow);
+
+    if (ref == NULL)
+    {
+        // All references are in use. The child falls back to scanning
+        // the send queue until all its queued messages are removed.
+
+        otLogNoteMac("No indirect queue entry for child 0x%04x, scanning send queue", aChild.GetRloc16());
+        ClearMessageRefs(aChild);
+        aChild.mIndirectQueueOverflow = true;
+        ExitNow();
+    }
+
+    mFreeMessageRefs = ref->mNext;
+    ref->mMessage    = &aMessage;
+
+    // Keep the same order as in the send queue, i.e., after all
+    // messages with the same or higher priority.
+
+    for (prevNext = &aChild.mIndirectQueue; *prevNext != NULL; prevNext = &(*prevNext)->mNext)
+    {
+        if ((*prevNext)->mMessage->GetPriority() < aMessage.GetPriority())
+        {
+            break;
+        }
+    }
+
+    ref->mNext = *prevNext;
+    *prevNext  = ref;
+
+exit:
+    return;
+}
+
+void IndirectSender::RemoveMessageRef(Child &aChild, Message &aMessage)
+{
+    MessageRef **prevNext;
+
+    VerifyOrExit(!aChild.mIndirectQueueOverflow);
+
+    for (prevNext = &aChild.mIndirectQueue; *prevNext != NULL; prevNext = &(*prevNext)->mNext)
+    {
+        MessageRef *ref = *prevNext;
+
+        if (ref->mMessage == &aMessage)
+        {
+            *prevNext        = ref->mNext;
+            ref->mMessage    = NULL;
+            ref->mNext       = mFreeMessageRefs;
+            mFreeMessageRefs = ref;
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+void IndirectSender::ClearMessageRefs(Child &aChild)
+{
+    MessageRef *ref;
+
+    while ((ref = aChild.mIndirectQueue) != NULL)
+    {
+        aChild.mIndirectQueue = ref->mNext;
+        ref->mMessage         = NULL;
+        ref->mNext            = mFreeMessageRefs;
+        mFreeMessageRefs      = ref;
+    }
+}
+
 } // namespace ot
 
 #endif // #if OPENTHREAD_FTD
@@ -66,6 +66,9 @@ class IndirectSender : public InstanceLocator, public IndirectSenderBase
     friend class Instance;
     friend class DataPollHandler::Callbacks;
 
+private:
+    struct MessageRef;
+
 public:
     /**
      * This class defines all the child info required for indirect transmission.
@@ -112,13 +115,15 @@ public:
 
         const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
 
-        Message *mIndirectMessage;             // Current indirect message.
-        uint16_t mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
-        bool     mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
-        bool     mWaitingForMessageUpdate : 1; // Indicates waiting for updating the indirect message.
-        uint16_t mQueuedMessageCount : 14;     // Number of queued indirect messages for the child.
-        bool     mUseShortAddress : 1;         // Indicates whether to use short or extended address.
-        bool     mSourceMatchPending : 1;      // Indicates whether or not pending to add to src match table.
+        Message *   mIndirectMessage;             // Current indirect message.
+        MessageRef *mIndirectQueue;               // Messages queued for the child, in send order.
+        bool        mIndirectQueueOverflow;       // Indicates `mIndirectQueue` is unused (send queue is scanned).
+        uint16_t    mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
+        bool        mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
+        bool        mWaitingForMessageUpdate : 1; // Indicates waiting for updating the indirect message.
+        uint16_t    mQueuedMessageCount : 14;     // Number of queued indirect messages for the child.
+        bool        mUseShortAddress : 1;         // Indicates whether to use short or extended address.
+        bool        mSourceMatchPending : 1;      // Indicates whether or not pending to add to src match table.
 
         OT_STATIC_ASSERT(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < (1UL << 14),
                          "mQueuedMessageCount cannot fit max required!");
@@ -207,6 +212,17 @@ private:
         kSupervisionMsgAckRequest = (OPENTHREAD_CONFIG_CHILD_SUPERVISION_MSG_NO_ACK_REQUEST == 0) ? true : false,
     };
 
+    enum
+    {
+        kNumMessageRefs = OPENTHREAD_CONFIG_MLE_INDIRECT_MESSAGE_REFS,
+    };
+
+    struct MessageRef
+    {
+        Message *   mMessage;
+        MessageRef *mNext;
+    };
+
     // Callbacks from DataPollHandler
     otError PrepareFrameForChild(Mac::TxFrame &aFrame, FrameContext &aContext, Child &aChild);
     void    HandleSentFrameToChild(const Mac::TxFrame &aFrame,
@@ -221,8 +237,14 @@ private:
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
+    void     ResetMessageRefs(void);
+    void     AddMessageRef(Child &aChild, Message &aMessage);
+    void     RemoveMessageRef(Child &aChild, Message &aMessage);
+    void     ClearMessageRefs(Child &aChild);
 
     bool                  mEnabled;
+    MessageRef *          mFreeMessageRefs;
+    MessageRef            mMessageRefs[kNumMessageRefs];
     SourceMatchController mSourceMatchController;
     DataPollHandler       mDataPollHandler;
 };
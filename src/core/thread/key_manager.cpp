@@ -70,6 +70,7 @@ const otMasterKey KeyManager::kDefaultMasterKey = {{
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+    , mKeyCacheMissCount(0)
     , mMacFrameCounter(0)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
@@ -86,6 +87,8 @@ KeyManager::KeyManager(Instance &aInstance)
     mMasterKey = static_cast<const MasterKey &>(kDefaultMasterKey);
     mPskc.Clear();
     ComputeKey(mKeySequence, mKey);
+    UpdateKeySchedules();
+    InvalidateKeyCache();
 }
 
 void KeyManager::Start(void)
@@ -117,6 +120,8 @@ otError KeyManager::SetMasterKey(const MasterKey &aKey)
 
     mKeySequence = 0;
     ComputeKey(mKeySequence, mKey);
+    UpdateKeySchedules();
+    InvalidateKeyCache();
 
     // reset parent frame counters
     parent = &Get<Mle::MleRouter>().GetParent();
@@ -174,8 +179,34 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
         mKeySwitchGuardEnabled = true;
     }
 
+    if (aKeySequence == mKeySequence + 1)
+    {
+        // On key rotation, the current key becomes the previous one
+        // and the next key (if already derived) becomes current.
+
+        memcpy(mPreviousKey.mKey, mKey, sizeof(mKey));
+        SetKeySchedules(mPreviousKey.mKey, mPreviousKey.mMacKeySchedule, mPreviousKey.mMleKeySchedule);
+        mPreviousKey.mIsValid = true;
+
+        if (mNextKey.mIsValid)
+        {
+            memcpy(mKey, mNextKey.mKey, sizeof(mKey));
+        }
+        else
+        {
+            ComputeKey(aKeySequence, mKey);
+        }
+
+        mNextKey.mIsValid = false;
+    }
+    else
+    {
+        ComputeKey(aKeySequence, mKey);
+        InvalidateKeyCache();
+    }
+
+    UpdateKeySchedules();
     mKeySequence = aKeySequence;
-    ComputeKey(mKeySequence, mKey);
 
     mMacFrameCounter = 0;
     mMleFrameCounter = 0;
@@ -188,14 +219,96 @@ exit:
 
 const uint8_t *KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey + kMacKeyOffset;
+    return GetTemporaryKey(aKeySequence) + kMacKeyOffset;
 }
 
 const uint8_t *KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey;
+    return GetTemporaryKey(aKeySequence);
+}
+
+Crypto::AesEcb *KeyManager::GetTemporaryMacKeySchedule(uint32_t aKeySequence)
+{
+    CachedKey *cachedKey = GetCachedKey(aKeySequence);
+
+    return (cachedKey != NULL) ? &cachedKey->mMacKeySchedule : NULL;
+}
+
+Crypto::AesEcb *KeyManager::GetTemporaryMleKeySchedule(uint32_t aKeySequence)
+{
+    CachedKey *cachedKey = GetCachedKey(aKeySequence);
+
+    return (cachedKey != NULL) ? &cachedKey->mMleKeySchedule : NULL;
+}
+
+const uint8_t *KeyManager::GetTemporaryKey(uint32_t aKeySequence)
+{
+    const uint8_t *key;
+    CachedKey *    cachedKey;
+
+    VerifyOrExit(aKeySequence != mKeySequence, key = mKey);
+
+    cachedKey = GetCachedKey(aKeySequence);
+
+    if (cachedKey == NULL)
+    {
+        mKeyCacheMissCount++;
+        ComputeKey(aKeySequence, mTemporaryKey);
+        ExitNow(key = mTemporaryKey);
+    }
+
+    key = cachedKey->mKey;
+
+exit:
+    return key;
+}
+
+KeyManager::CachedKey *KeyManager::GetCachedKey(uint32_t aKeySequence)
+{
+    CachedKey *cachedKey = NULL;
+
+    // Frames secured with the previous or next key sequence are
+    // common around a key rotation, so their keys are cached
+    // along with the expanded key schedules.
+
+    if (aKeySequence == mKeySequence - 1)
+    {
+        cachedKey = &mPreviousKey;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        cachedKey = &mNextKey;
+    }
+
+    VerifyOrExit(cachedKey != NULL);
+
+    if (!cachedKey->mIsValid)
+    {
+        mKeyCacheMissCount++;
+        ComputeKey(aKeySequence, cachedKey->mKey);
+        SetKeySchedules(cachedKey->mKey, cachedKey->mMacKeySchedule, cachedKey->mMleKeySchedule);
+        cachedKey->mIsValid = true;
+    }
+
+exit:
+    return cachedKey;
+}
+
+void KeyManager::UpdateKeySchedules(void)
+{
+    SetKeySchedules(mKey, mMacKeySchedule, mMleKeySchedule);
+}
+
+void KeyManager::SetKeySchedules(const uint8_t *aKey, Crypto::AesEcb &aMacKeySchedule, Crypto::AesEcb &aMleKeySchedule)
+{
+    aMacKeySchedule.SetKey(aKey + kMacKeyOffset, 8 * kMaxKeyLength);
+    aMleKeySchedule.SetKey(aKey, 8 * kMaxKeyLength);
+}
+
+void KeyManager::InvalidateKeyCache(void)
+{
+    mPreviousKey.mIsValid = false;
+    mNextKey.mIsValid     = false;
 }
 
 void KeyManager::IncrementMacFrameCounter(void)
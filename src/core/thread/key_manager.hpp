@@ -43,6 +43,7 @@
 #include "common/locator.hpp"
 #include "common/random.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
 
@@ -250,6 +251,26 @@ public:
      */
     const uint8_t *GetCurrentMleKey(void) const { return mKey; }
 
+    /**
+     * This method returns the expanded AES key schedule of the current MAC key.
+     *
+     * The schedule is updated along with the current key, so it can be used to secure any number of frames.
+     *
+     * @returns A reference to the current MAC key schedule.
+     *
+     */
+    Crypto::AesEcb &GetCurrentMacKeySchedule(void) { return mMacKeySchedule; }
+
+    /**
+     * This method returns the expanded AES key schedule of the current MLE key.
+     *
+     * The schedule is updated along with the current key, so it can be used to secure any number of messages.
+     *
+     * @returns A reference to the current MLE key schedule.
+     *
+     */
+    Crypto::AesEcb &GetCurrentMleKeySchedule(void) { return mMleKeySchedule; }
+
     /**
      * This method returns a pointer to a temporary MAC key computed from the given key sequence.
      *
@@ -270,6 +291,41 @@ public:
      */
     const uint8_t *GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the expanded AES key schedule of the MAC key for the key sequence just before or after
+     * the current one.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A pointer to the cached MAC key schedule, or NULL if @p aKeySequence is not the current key sequence
+     *          plus or minus one.
+     *
+     */
+    Crypto::AesEcb *GetTemporaryMacKeySchedule(uint32_t aKeySequence);
+
+    /**
+     * This method returns the expanded AES key schedule of the MLE key for the key sequence just before or after
+     * the current one.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A pointer to the cached MLE key schedule, or NULL if @p aKeySequence is not the current key sequence
+     *          plus or minus one.
+     *
+     */
+    Crypto::AesEcb *GetTemporaryMleKeySchedule(uint32_t aKeySequence);
+
+    /**
+     * This method returns the number of times a temporary MAC or MLE key had to be computed.
+     *
+     * The keys for the key sequences just before and after the current one are cached, so this counts the requests
+     * for other key sequences and the first request for each cached key sequence.
+     *
+     * @returns The number of temporary key cache misses.
+     *
+     */
+    uint32_t GetKeyCacheMissCount(void) const { return mKeyCacheMissCount; }
+
     /**
      * This method returns the current MAC Frame Counter value.
      *
@@ -449,7 +505,21 @@ private:
         kOneHourIntervalInMsec     = 3600u * 1000u,
     };
 
-    void ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    struct CachedKey
+    {
+        uint8_t        mKey[Crypto::HmacSha256::kHashSize];
+        Crypto::AesEcb mMacKeySchedule;
+        Crypto::AesEcb mMleKeySchedule;
+        bool           mIsValid;
+    };
+
+    void           ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    const uint8_t *GetTemporaryKey(uint32_t aKeySequence);
+    CachedKey *    GetCachedKey(uint32_t aKeySequence);
+    void           InvalidateKeyCache(void);
+    void           UpdateKeySchedules(void);
+
+    static void SetKeySchedules(const uint8_t *aKey, Crypto::AesEcb &aMacKeySchedule, Crypto::AesEcb &aMleKeySchedule);
 
     void        StartKeyRotationTimer(void);
     static void HandleKeyRotationTimer(Timer &aTimer);
@@ -463,7 +533,13 @@ private:
     uint32_t mKeySequence;
     uint8_t  mKey[Crypto::HmacSha256::kHashSize];
 
-    uint8_t mTemporaryKey[Crypto::HmacSha256::kHashSize];
+    Crypto::AesEcb mMacKeySchedule;
+    Crypto::AesEcb mMleKeySchedule;
+
+    CachedKey mPreviousKey;
+    CachedKey mNextKey;
+    uint8_t   mTemporaryKey[Crypto::HmacSha256::kHashSize];
+    uint32_t  mKeyCacheMissCount;
 
     uint32_t mMacFrameCounter;
     uint32_t mMleFrameCounter;
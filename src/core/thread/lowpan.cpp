@@ -479,9 +479,9 @@ otError Lowpan::CompressExtensionHeader(Message &aMessage, BufferWriter &aBuf, u
     uint8_t              padLength = 0;
     uint16_t             offset;
     uint8_t              tmpByte;
+    Message::Cursor      cursor(aMessage, aMessage.GetOffset());
 
-    VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(extHeader), &extHeader) == sizeof(extHeader),
-                 error = OT_ERROR_PARSE);
+    VerifyOrExit(cursor.Read(&extHeader, sizeof(extHeader)) == sizeof(extHeader), error = OT_ERROR_PARSE);
     aMessage.MoveOffset(sizeof(extHeader));
 
     tmpByte = kExtHdrDispatch | kExtHdrEidHbh;
@@ -513,7 +513,8 @@ otError Lowpan::CompressExtensionHeader(Message &aMessage, BufferWriter &aBuf, u
 
         while (offset < len + aMessage.GetOffset())
         {
-            VerifyOrExit(aMessage.Read(offset, sizeof(optionHeader), &optionHeader) == sizeof(optionHeader),
+            VerifyOrExit(cursor.Seek(offset) == OT_ERROR_NONE &&
+                             cursor.Read(&optionHeader, sizeof(optionHeader)) == sizeof(optionHeader),
                          error = OT_ERROR_PARSE);
 
             if (optionHeader.GetType() == Ip6::OptionPad1::kType)
@@ -125,6 +125,12 @@ void MeshForwarder::Stop(void)
     }
 
 #if OPENTHREAD_FTD
+    while ((message = mIndirectSendQueue.GetHead()) != NULL)
+    {
+        mIndirectSendQueue.Dequeue(*message);
+        message->Free();
+    }
+
     mIndirectSender.Stop();
     memset(mFragmentEntries, 0, sizeof(mFragmentEntries));
 #endif
@@ -151,7 +157,11 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
         mSendMessage = NULL;
     }
 
+#if OPENTHREAD_FTD
+    DequeueMessage(aMessage);
+#else
     mSendQueue.Dequeue(aMessage);
+#endif
     LogMessage(kMessageEvict, aMessage, NULL, OT_ERROR_NO_BUFS);
     aMessage.Free();
 }
@@ -260,6 +270,16 @@ Message *MeshForwarder::GetDirectTransmission(void)
 #endif
 
         default:
+#if OPENTHREAD_FTD
+            if (curMessage->IsChildPending())
+            {
+                // Only drop the direct transmission, the message is
+                // still queued for indirect transmission to children.
+                curMessage->ClearDirectTransmission();
+                UpdateSendQueue(*curMessage);
+                continue;
+            }
+#endif
             mSendQueue.Dequeue(*curMessage);
             LogMessage(kMessageDrop, *curMessage, NULL, error);
             curMessage->Free();
@@ -933,6 +953,14 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, otError aError)
         mSendMessage       = NULL;
         mMessageNextOffset = 0;
     }
+#if OPENTHREAD_FTD
+    else
+    {
+        // Move the message to the indirect send queue if it is
+        // still pending indirect transmission to sleepy children.
+        UpdateSendQueue(*mSendMessage);
+    }
+#endif
 
 exit:
 
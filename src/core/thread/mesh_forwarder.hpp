@@ -276,6 +276,9 @@ public:
     /**
      * This method returns a reference to the send queue.
      *
+     * On FTD builds, the send queue holds the messages pending direct transmission. Messages that are only pending
+     * indirect transmission to sleepy children are kept in the indirect send queue.
+     *
      * @returns  A reference to the send queue.
      *
      */
@@ -311,6 +314,14 @@ public:
      *
      */
     const MessageQueue &GetResolvingQueue(void) const { return mResolvingQueue; }
+
+    /**
+     * This method returns a reference to the indirect send queue.
+     *
+     * @returns  A reference to the indirect send queue.
+     *
+     */
+    const PriorityQueue &GetIndirectSendQueue(void) const { return mIndirectSendQueue; }
 #endif
 
 private:
@@ -397,6 +408,11 @@ private:
     void    ClearReassemblyList(void);
     void    RemoveMessage(Message &aMessage);
     void    HandleDiscoverComplete(void);
+#if OPENTHREAD_FTD
+    void     DequeueMessage(Message &aMessage);
+    void     UpdateSendQueue(Message &aMessage);
+    Message *GetNextQueuedMessage(const Message *aMessage) const;
+#endif
 
     void      HandleReceivedFrame(Mac::RxFrame &aFrame);
     otError   HandleFrameRequest(Mac::TxFrame &aFrame);
@@ -520,6 +536,7 @@ private:
 #if OPENTHREAD_FTD
     FragmentPriorityEntry mFragmentEntries[kNumFragmentPriorityEntries];
     MessageQueue          mResolvingQueue;
+    PriorityQueue         mIndirectSendQueue;
     IndirectSender        mIndirectSender;
 #endif
 
@@ -136,6 +136,7 @@ otError MeshForwarder::SendMessage(Message &aMessage)
         break;
     }
 
+    UpdateSendQueue(aMessage);
     mScheduleTransmissionTask.Post();
 
 exit:
@@ -184,10 +185,20 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, otError aError)
 
 otError MeshForwarder::EvictMessage(uint8_t aPriority)
 {
-    otError  error = OT_ERROR_NOT_FOUND;
+    otError  error      = OT_ERROR_NOT_FOUND;
+    Message *directTail = mSendQueue.GetTail();
     Message *message;
 
-    VerifyOrExit((message = mSendQueue.GetTail()) != NULL);
+    // The lowest priority message is the tail of either queue.
+
+    message = mIndirectSendQueue.GetTail();
+
+    if ((message == NULL) || ((directTail != NULL) && (directTail->GetPriority() < message->GetPriority())))
+    {
+        message = directTail;
+    }
+
+    VerifyOrExit(message != NULL);
 
     if (message->GetPriority() < aPriority)
     {
@@ -199,6 +210,17 @@ otError MeshForwarder::EvictMessage(uint8_t aPriority)
     {
         while (aPriority <= Message::kPriorityNet)
         {
+            // All messages in the indirect send queue are pending
+            // for sleepy children, so prefer them for eviction.
+
+            message = mIndirectSendQueue.GetHeadForPriority(aPriority);
+
+            if ((message != NULL) && (message->GetPriority() == aPriority))
+            {
+                RemoveMessage(*message);
+                ExitNow(error = OT_ERROR_NONE);
+            }
+
             for (message = mSendQueue.GetHeadForPriority(aPriority); message && (message->GetPriority() == aPriority);
                  message = message->GetNext())
             {
@@ -222,9 +244,9 @@ void MeshForwarder::RemoveMessages(Child &aChild, uint8_t aSubType)
     Mle::MleRouter &mle = Get<Mle::MleRouter>();
     Message *       nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+    for (Message *message = GetNextQueuedMessage(NULL); message; message = nextMessage)
     {
-        nextMessage = message->GetNext();
+        nextMessage = GetNextQueuedMessage(message);
 
         if ((aSubType != Message::kSubTypeNone) && (aSubType != message->GetSubType()))
         {
@@ -275,31 +297,88 @@ void MeshForwarder::RemoveMessages(Child &aChild, uint8_t aSubType)
                 mSendMessage = NULL;
             }
 
-            mSendQueue.Dequeue(*message);
+            DequeueMessage(*message);
             message->Free();
         }
+        else
+        {
+            UpdateSendQueue(*message);
+        }
+    }
+}
+
+void MeshForwarder::DequeueMessage(Message &aMessage)
+{
+    if (mSendQueue.Dequeue(aMessage) != OT_ERROR_NONE)
+    {
+        IgnoreReturnValue(mIndirectSendQueue.Dequeue(aMessage));
     }
 }
 
+void MeshForwarder::UpdateSendQueue(Message &aMessage)
+{
+    // Keep messages that are only pending indirect transmission out
+    // of the send queue, so that `GetDirectTransmission()` does not
+    // need to skip over them.
+
+    if (aMessage.GetDirectTransmission())
+    {
+        SuccessOrExit(mIndirectSendQueue.Dequeue(aMessage));
+        mSendQueue.Enqueue(aMessage);
+    }
+    else if (aMessage.IsChildPending())
+    {
+        SuccessOrExit(mSendQueue.Dequeue(aMessage));
+        mIndirectSendQueue.Enqueue(aMessage);
+    }
+
+exit:
+    return;
+}
+
+Message *MeshForwarder::GetNextQueuedMessage(const Message *aMessage) const
+{
+    // Iterates over the indirect send queue followed by the send queue.
+
+    Message *next = NULL;
+
+    if (aMessage == NULL)
+    {
+        next = mIndirectSendQueue.GetHead();
+    }
+    else if (aMessage != mIndirectSendQueue.GetTail())
+    {
+        ExitNow(next = aMessage->GetNext());
+    }
+
+    if (next == NULL)
+    {
+        next = mSendQueue.GetHead();
+    }
+
+exit:
+    return next;
+}
+
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    Ip6::Header ip6Header;
+    Message *nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = message->GetNext())
+    for (Message *message = GetNextQueuedMessage(NULL); message; message = nextMessage)
     {
+        nextMessage = GetNextQueuedMessage(message);
+
         if (message->GetSubType() != Message::kSubTypeMleDataResponse)
         {
             continue;
         }
 
-        message->Read(0, sizeof(ip6Header), &ip6Header);
+        // Multicast data responses may also be queued for sleepy
+        // children, so remove the message from all children.
 
-        if (!(ip6Header.GetDestination().IsMulticast()))
+        for (ChildTable::Iterator iter(GetInstance(), Child::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
         {
-            for (ChildTable::Iterator iter(GetInstance(), Child::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
-            {
-                IgnoreReturnValue(mIndirectSender.RemoveMessageFromSleepyChild(*message, *iter.GetChild()));
-            }
+            IgnoreReturnValue(mIndirectSender.RemoveMessageFromSleepyChild(*message, *iter.GetChild()));
         }
 
         if (mSendMessage == message)
@@ -307,7 +386,7 @@ void MeshForwarder::RemoveDataResponseMessages(void)
             mSendMessage = NULL;
         }
 
-        mSendQueue.Dequeue(*message);
+        DequeueMessage(*message);
         LogMessage(kMessageDrop, *message, NULL, OT_ERROR_NONE);
         message->Free();
     }
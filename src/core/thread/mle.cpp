@@ -2519,7 +2519,7 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         KeyManager::GenerateNonce(Get<Mac::Mac>().GetExtAddress(), Get<KeyManager>().GetMleFrameCounter(),
                                   Mac::Frame::kSecEncMic32, nonce);
 
-        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKey(), 16);
+        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKeySchedule());
         error = aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1),
                             sizeof(tag), nonce, sizeof(nonce));
         assert(error == OT_ERROR_NONE);
@@ -2581,12 +2581,12 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     otError         error = OT_ERROR_NONE;
     Header          header;
     uint32_t        keySequence;
-    const uint8_t * mleKey;
     uint32_t        frameCounter;
     uint8_t         messageTag[4];
     uint8_t         nonce[KeyManager::kNonceSize];
     Mac::ExtAddress macAddr;
     Crypto::AesCcm  aesCcm;
+    Crypto::AesEcb *keySchedule;
     uint16_t        mleOffset;
     uint8_t         buf[64];
     uint16_t        length;
@@ -2631,11 +2631,15 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     if (keySequence == Get<KeyManager>().GetCurrentKeySequence())
     {
-        mleKey = Get<KeyManager>().GetCurrentMleKey();
+        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKeySchedule());
+    }
+    else if ((keySchedule = Get<KeyManager>().GetTemporaryMleKeySchedule(keySequence)) != NULL)
+    {
+        aesCcm.SetKey(*keySchedule);
     }
     else
     {
-        mleKey = Get<KeyManager>().GetTemporaryMleKey(keySequence);
+        aesCcm.SetKey(Get<KeyManager>().GetTemporaryMleKey(keySequence), 16);
     }
 
     VerifyOrExit(aMessage.GetOffset() + header.GetLength() + sizeof(messageTag) <= aMessage.GetLength(),
@@ -2649,7 +2653,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     frameCounter = header.GetFrameCounter();
     KeyManager::GenerateNonce(macAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
-    aesCcm.SetKey(mleKey, 16);
     SuccessOrExit(error = aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) +
                                           header.GetHeaderLength(),
                                       aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce,
@@ -1658,7 +1658,7 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
         VerifyOrExit((child = mChildTable.GetNewChild()) != NULL);
 
         // MAC Address
-        child->SetExtAddress(macAddr);
+        mChildTable.SetChildExtAddress(*child, macAddr);
         child->GetLinkInfo().Clear();
         child->GetLinkInfo().AddRss(Get<Mac::Mac>().GetNoiseFloor(), linkInfo->mRss);
         child->ResetLinkFailures();
@@ -2890,7 +2890,7 @@ otError MleRouter::SendChildIdResponse(Child &aChild)
         } while (mChildTable.FindChild(rloc16, Child::kInStateAnyExceptInvalid) != NULL);
 
         // allocate Child ID
-        aChild.SetRloc16(rloc16);
+        mChildTable.SetChildRloc16(aChild, rloc16);
     }
 
     SuccessOrExit(error = AppendAddress16(*message, aChild.GetRloc16()));
@@ -2967,7 +2967,10 @@ otError MleRouter::SendChildUpdateRequest(Child &aChild)
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-        for (message = Get<MeshForwarder>().GetSendQueue().GetHead(); message; message = message->GetNext())
+        // Messages queued only for the sleepy child are kept in the
+        // indirect send queue.
+
+        for (message = Get<MeshForwarder>().GetIndirectSendQueue().GetHead(); message; message = message->GetNext())
         {
             if (message->GetChildMask(childIndex) && message->GetSubType() == Message::kSubTypeMleChildUpdateRequest)
             {
@@ -3570,9 +3573,9 @@ void MleRouter::RestoreChildren(void)
 
         child->Clear();
 
-        child->SetExtAddress(*static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
+        mChildTable.SetChildExtAddress(*child, *static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
         child->GetLinkInfo().Clear();
-        child->SetRloc16(childInfo.mRloc16);
+        mChildTable.SetChildRloc16(*child, childInfo.mRloc16);
         child->SetTimeout(childInfo.mTimeout);
         child->SetDeviceMode(DeviceMode(childInfo.mMode));
         child->SetState(Neighbor::kStateRestored);
@@ -55,23 +55,78 @@ namespace NetworkData {
 
 LeaderBase::LeaderBase(Instance &aInstance)
     : NetworkData(aInstance, kTypeLeader)
+    , mNumPrefixEntries(0)
+    , mLookupTableValid(false)
+    , mLookupVersion(0)
+    , mLookupStableVersion(0)
+    , mLookupLength(0)
 {
     Reset();
 }
 
 void LeaderBase::Reset(void)
 {
-    mVersion       = Random::NonCrypto::GetUint8();
-    mStableVersion = Random::NonCrypto::GetUint8();
-    mLength        = 0;
+    mVersion          = Random::NonCrypto::GetUint8();
+    mStableVersion    = Random::NonCrypto::GetUint8();
+    mLength           = 0;
+    mLookupTableValid = false;
     Get<Notifier>().Signal(OT_CHANGED_THREAD_NETDATA);
 }
 
-otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+void LeaderBase::UpdateLookupTable(void)
 {
-    PrefixTlv * prefix;
-    ContextTlv *contextTlv;
+    NetworkDataTlv *end = reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
+
+    VerifyOrExit(!mLookupTableValid || (mLookupVersion != mVersion) || (mLookupStableVersion != mStableVersion) ||
+                 (mLookupLength != mLength));
+
+    mNumPrefixEntries = 0;
+    memset(mContextIdEntries, kInvalidEntry, sizeof(mContextIdEntries));
+
+    for (NetworkDataTlv *cur = reinterpret_cast<NetworkDataTlv *>(mTlvs);
+         (cur < end) && (mNumPrefixEntries < kMaxPrefixEntries); cur = cur->GetNext())
+    {
+        PrefixEntry &entry = mPrefixEntries[mNumPrefixEntries];
+        PrefixTlv *  prefix;
+        ContextTlv * contextTlv;
+
+        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
+        {
+            continue;
+        }
+
+        prefix     = static_cast<PrefixTlv *>(cur);
+        contextTlv = FindContext(*prefix);
+
+        entry.mPrefixOffset    = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(prefix) - mTlvs);
+        entry.mContextOffset   = kInvalidEntry;
+        entry.mHasBorderRouter = (FindBorderRouter(*prefix) != NULL);
+        entry.mHasRoute        = (FindHasRoute(*prefix) != NULL);
 
+        if (contextTlv != NULL)
+        {
+            entry.mContextOffset = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(contextTlv) - mTlvs);
+
+            if (mContextIdEntries[contextTlv->GetContextId()] == kInvalidEntry)
+            {
+                mContextIdEntries[contextTlv->GetContextId()] = mNumPrefixEntries;
+            }
+        }
+
+        mNumPrefixEntries++;
+    }
+
+    mLookupTableValid    = true;
+    mLookupVersion       = mVersion;
+    mLookupStableVersion = mStableVersion;
+    mLookupLength        = mLength;
+
+exit:
+    return;
+}
+
+otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+{
     aContext.mPrefixLength = 0;
 
     if (PrefixMatch(Get<Mle::MleRouter>().GetMeshLocalPrefix().m8, aAddress.mFields.m8, 64) >= 0)
@@ -82,35 +137,30 @@ otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aC
         aContext.mCompressFlag = true;
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateLookupTable();
 
-        prefix = static_cast<PrefixTlv *>(cur);
+    for (uint8_t i = 0; i < mNumPrefixEntries; i++)
+    {
+        const PrefixEntry &entry  = mPrefixEntries[i];
+        PrefixTlv &        prefix = GetPrefixTlv(entry);
+        ContextTlv *       contextTlv;
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
+        if ((entry.mContextOffset == kInvalidEntry) || (prefix.GetPrefixLength() <= aContext.mPrefixLength))
         {
             continue;
         }
 
-        contextTlv = FindContext(*prefix);
-
-        if (contextTlv == NULL)
+        if (PrefixMatch(prefix.GetPrefix(), aAddress.mFields.m8, prefix.GetPrefixLength()) < 0)
         {
             continue;
         }
 
-        if (prefix->GetPrefixLength() > aContext.mPrefixLength)
-        {
-            aContext.mPrefix       = prefix->GetPrefix();
-            aContext.mPrefixLength = prefix->GetPrefixLength();
-            aContext.mContextId    = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
-        }
+        contextTlv = &GetContextTlv(entry);
+
+        aContext.mPrefix       = prefix.GetPrefix();
+        aContext.mPrefixLength = prefix.GetPrefixLength();
+        aContext.mContextId    = contextTlv->GetContextId();
+        aContext.mCompressFlag = contextTlv->IsCompress();
     }
 
     return (aContext.mPrefixLength > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
@@ -121,6 +171,7 @@ otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
     otError     error = OT_ERROR_NOT_FOUND;
     PrefixTlv * prefix;
     ContextTlv *contextTlv;
+    uint8_t     index;
 
     if (aContextId == Mle::kMeshLocalPrefixContextId)
     {
@@ -131,33 +182,21 @@ otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
         ExitNow(error = OT_ERROR_NONE);
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    VerifyOrExit(aContextId < kNumContextIds);
 
-        prefix     = static_cast<PrefixTlv *>(cur);
-        contextTlv = FindContext(*prefix);
+    UpdateLookupTable();
 
-        if (contextTlv == NULL)
-        {
-            continue;
-        }
+    index = mContextIdEntries[aContextId];
+    VerifyOrExit(index != kInvalidEntry);
 
-        if (contextTlv->GetContextId() != aContextId)
-        {
-            continue;
-        }
+    prefix     = &GetPrefixTlv(mPrefixEntries[index]);
+    contextTlv = &GetContextTlv(mPrefixEntries[index]);
 
-        aContext.mPrefix       = prefix->GetPrefix();
-        aContext.mPrefixLength = prefix->GetPrefixLength();
-        aContext.mContextId    = contextTlv->GetContextId();
-        aContext.mCompressFlag = contextTlv->IsCompress();
-        ExitNow(error = OT_ERROR_NONE);
-    }
+    aContext.mPrefix       = prefix->GetPrefix();
+    aContext.mPrefixLength = prefix->GetPrefixLength();
+    aContext.mContextId    = contextTlv->GetContextId();
+    aContext.mCompressFlag = contextTlv->IsCompress();
+    error                  = OT_ERROR_NONE;
 
 exit:
     return error;
@@ -190,30 +229,25 @@ exit:
 
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress)
 {
-    PrefixTlv *prefix;
-    bool       rval = false;
+    bool rval = false;
 
     if (memcmp(aAddress.mFields.m8, Get<Mle::MleRouter>().GetMeshLocalPrefix().m8, sizeof(otMeshLocalPrefix)) == 0)
     {
         ExitNow(rval = true);
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateLookupTable();
 
-        prefix = static_cast<PrefixTlv *>(cur);
+    for (uint8_t i = 0; i < mNumPrefixEntries; i++)
+    {
+        PrefixTlv &prefix = GetPrefixTlv(mPrefixEntries[i]);
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
+        if (!mPrefixEntries[i].mHasBorderRouter)
         {
             continue;
         }
 
-        if (FindBorderRouter(*prefix) == NULL)
+        if (PrefixMatch(prefix.GetPrefix(), aAddress.mFields.m8, prefix.GetPrefixLength()) < 0)
         {
             continue;
         }
@@ -230,27 +264,22 @@ otError LeaderBase::RouteLookup(const Ip6::Address &aSource,
                                 uint8_t *           aPrefixMatch,
                                 uint16_t *          aRloc16)
 {
-    otError    error = OT_ERROR_NO_ROUTE;
-    PrefixTlv *prefix;
+    otError error = OT_ERROR_NO_ROUTE;
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateLookupTable();
 
-        prefix = static_cast<PrefixTlv *>(cur);
+    for (uint8_t i = 0; i < mNumPrefixEntries; i++)
+    {
+        PrefixTlv &prefix = GetPrefixTlv(mPrefixEntries[i]);
 
-        if (PrefixMatch(prefix->GetPrefix(), aSource.mFields.m8, prefix->GetPrefixLength()) >= 0)
+        if (PrefixMatch(prefix.GetPrefix(), aSource.mFields.m8, prefix.GetPrefixLength()) >= 0)
         {
-            if (ExternalRouteLookup(prefix->GetDomainId(), aDestination, aPrefixMatch, aRloc16) == OT_ERROR_NONE)
+            if (ExternalRouteLookup(prefix.GetDomainId(), aDestination, aPrefixMatch, aRloc16) == OT_ERROR_NONE)
             {
                 ExitNow(error = OT_ERROR_NONE);
             }
 
-            if (DefaultRouteLookup(*prefix, aRloc16) == OT_ERROR_NONE)
+            if (mPrefixEntries[i].mHasBorderRouter && (DefaultRouteLookup(prefix, aRloc16) == OT_ERROR_NONE))
             {
                 if (aPrefixMatch)
                 {
@@ -272,36 +301,28 @@ otError LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
                                         uint16_t *          aRloc16)
 {
     otError         error = OT_ERROR_NO_ROUTE;
-    PrefixTlv *     prefix;
     HasRouteTlv *   hasRoute;
     HasRouteEntry * entry;
     HasRouteEntry * rvalRoute = NULL;
     uint8_t         rval_plen = 0;
     int8_t          plen;
-    NetworkDataTlv *cur;
     NetworkDataTlv *subCur;
 
-    for (cur = reinterpret_cast<NetworkDataTlv *>(mTlvs); cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
-         cur = cur->GetNext())
+    for (uint8_t i = 0; i < mNumPrefixEntries; i++)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
-
-        prefix = static_cast<PrefixTlv *>(cur);
+        PrefixTlv &prefix = GetPrefixTlv(mPrefixEntries[i]);
 
-        if (prefix->GetDomainId() != aDomainId)
+        if (!mPrefixEntries[i].mHasRoute || (prefix.GetDomainId() != aDomainId))
         {
             continue;
         }
 
-        plen = PrefixMatch(prefix->GetPrefix(), aDestination.mFields.m8, prefix->GetPrefixLength());
+        plen = PrefixMatch(prefix.GetPrefix(), aDestination.mFields.m8, prefix.GetPrefixLength());
 
         if (plen > rval_plen)
         {
             // select border router
-            for (subCur = prefix->GetSubTlvs(); subCur < prefix->GetNext(); subCur = subCur->GetNext())
+            for (subCur = prefix.GetSubTlvs(); subCur < prefix.GetNext(); subCur = subCur->GetNext())
             {
                 if (subCur->GetType() != NetworkDataTlv::kTypeHasRoute)
                 {
@@ -310,9 +331,9 @@ otError LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
 
                 hasRoute = static_cast<HasRouteTlv *>(subCur);
 
-                for (uint8_t i = 0; i < hasRoute->GetNumEntries(); i++)
+                for (uint8_t j = 0; j < hasRoute->GetNumEntries(); j++)
                 {
-                    entry = hasRoute->GetEntry(i);
+                    entry = hasRoute->GetEntry(j);
 
                     if (rvalRoute == NULL || entry->GetPreference() > rvalRoute->GetPreference() ||
                         (entry->GetPreference() == rvalRoute->GetPreference() &&
@@ -412,9 +433,10 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
     length = aMessage.Read(aMessageOffset + sizeof(tlv), tlv.GetLength(), mTlvs);
     VerifyOrExit(length == tlv.GetLength(), error = OT_ERROR_PARSE);
 
-    mLength        = tlv.GetLength();
-    mVersion       = aVersion;
-    mStableVersion = aStableVersion;
+    mLength           = tlv.GetLength();
+    mVersion          = aVersion;
+    mStableVersion    = aStableVersion;
+    mLookupTableValid = false;
 
     if (aStableOnly)
     {
@@ -234,6 +234,35 @@ protected:
     uint8_t mVersion;
 
 private:
+    enum
+    {
+        kMaxPrefixEntries = kMaxSize / sizeof(PrefixTlv), ///< Maximum number of Prefix TLVs in the Network Data.
+        kNumContextIds    = 16,                           ///< Number of 6LoWPAN Context IDs.
+        kInvalidEntry     = 0xff,                         ///< Invalid offset or entry index.
+    };
+
+    /**
+     * This structure represents a Prefix TLV in the lookup table.
+     *
+     */
+    struct PrefixEntry
+    {
+        uint8_t mPrefixOffset;    ///< Offset of the Prefix TLV within `mTlvs`.
+        uint8_t mContextOffset;   ///< Offset of the Context TLV within `mTlvs` or `kInvalidEntry` if none.
+        bool    mHasBorderRouter; ///< Indicates whether the prefix includes a Border Router TLV.
+        bool    mHasRoute;        ///< Indicates whether the prefix includes a Has Route TLV.
+    };
+
+    void        UpdateLookupTable(void);
+    PrefixTlv & GetPrefixTlv(const PrefixEntry &aEntry)
+    {
+        return *reinterpret_cast<PrefixTlv *>(mTlvs + aEntry.mPrefixOffset);
+    }
+    ContextTlv &GetContextTlv(const PrefixEntry &aEntry)
+    {
+        return *reinterpret_cast<ContextTlv *>(mTlvs + aEntry.mContextOffset);
+    }
+
     otError RemoveCommissioningData(void);
 
     otError ExternalRouteLookup(uint8_t             aDomainId,
@@ -241,6 +270,17 @@ private:
                                 uint8_t *           aPrefixMatch,
                                 uint16_t *          aRloc16);
     otError DefaultRouteLookup(PrefixTlv &aPrefix, uint16_t *aRloc16);
+
+    // The lookup table holds the Prefix TLVs (in Network Data order)
+    // and a Context ID map. It is rebuilt lazily once the Network Data
+    // version or length changes.
+    PrefixEntry mPrefixEntries[kMaxPrefixEntries];
+    uint8_t     mContextIdEntries[kNumContextIds];
+    uint8_t     mNumPrefixEntries;
+    bool        mLookupTableValid;
+    uint8_t     mLookupVersion;
+    uint8_t     mLookupStableVersion;
+    uint8_t     mLookupLength;
 };
 
 /**
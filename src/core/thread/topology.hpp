@@ -455,6 +455,8 @@ private:
  */
 class Child : public Neighbor, public IndirectSender::ChildInfo, public DataPollHandler::ChildInfo
 {
+    friend class ChildTable;
+
 public:
     enum
     {
@@ -700,6 +702,12 @@ private:
         kNumIp6Addresses = OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD - 1,
     };
 
+    // The RLOC16 and the Extended Address are the keys of the child table indices, so they are only changed through
+    // `ChildTable::SetChildRloc16()` and `ChildTable::SetChildExtAddress()`.
+    void SetRloc16(uint16_t aRloc16) { Neighbor::SetRloc16(aRloc16); }
+    void SetExtAddress(const Mac::ExtAddress &aAddress) { Neighbor::SetExtAddress(aAddress); }
+    void ClearExtAddress(void) { Neighbor::ClearExtAddress(); }
+
     uint8_t      mNetworkDataVersion;                                   ///< Current Network Data version
     uint8_t      mMeshLocalIid[Ip6::Address::kInterfaceIdentifierSize]; ///< IPv6 address IID for mesh-local address
     Ip6::Address mIp6Address[kNumIp6Addresses];                         ///< Registered IPv6 addresses
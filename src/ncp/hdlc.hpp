@@ -37,6 +37,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <openthread/error.h>
 #include "common/code_utils.hpp"
@@ -98,6 +99,32 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * If there is not enough space to write all the bytes, nothing is written.
+     *
+     * @param[in]  aData    A pointer to the bytes to write.
+     * @param[in]  aLength  The number of bytes in @p aData.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     *
+     */
+    otError WriteBytes(const uint8_t *aData, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(CanWrite(aLength), error = OT_ERROR_NO_BUFS);
+
+        memcpy(mWritePointer, aData, aLength);
+        mWritePointer += aLength;
+        mRemainingLength -= aLength;
+
+    exit:
+        return error;
+    }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -208,6 +208,10 @@ NcpBase::NcpBase(Instance *aInstance)
     , mUpdateChangedPropsTask(*aInstance, &NcpBase::UpdateChangedProps, this)
     , mThreadChangedFlags(0)
     , mChangedPropsSet()
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+    , mChangedPropsBatchTimer(*aInstance, &NcpBase::HandleChangedPropsBatchTimer, this)
+    , mChangedPropsBatchReady(false)
+#endif
     , mHostPowerState(SPINEL_HOST_POWER_STATE_ONLINE)
     , mHostPowerReplyFrameTag(NcpFrameBuffer::kInvalidTag)
     , mHostPowerStateHeader(0)
@@ -813,6 +817,35 @@ void NcpBase::UpdateChangedProps(void)
 
     VerifyOrExit(!mChangedPropsSet.IsEmpty());
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+    if (mDidInitialUpdates)
+    {
+        otError error;
+
+        // Hold the updates back until the batching window expires so
+        // that a burst of changes is reported in a single frame.
+
+        if (!mChangedPropsBatchReady)
+        {
+            if (!mChangedPropsBatchTimer.IsRunning())
+            {
+                mChangedPropsBatchTimer.Start(OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW);
+            }
+
+            ExitNow();
+        }
+
+        error = WriteChangedPropsBatchFrame();
+
+        // If the batch frame did not fit while there are other frames
+        // in the buffer, wait for `HandleFrameRemovedFromNcpBuffer()`
+        // to free up space. If it did not fit in an empty buffer, the
+        // remaining properties are sent in separate frames below.
+
+        VerifyOrExit((error != OT_ERROR_NO_BUFS) || mTxFrameBuffer.IsEmpty());
+    }
+#endif
+
     entry = mChangedPropsSet.GetSupportedEntries(numEntries);
 
     for (uint8_t index = 0; index < numEntries; index++, entry++)
@@ -846,8 +879,89 @@ void NcpBase::UpdateChangedProps(void)
 
 exit:
     mDidInitialUpdates = true;
+
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+    if (mChangedPropsSet.IsEmpty())
+    {
+        mChangedPropsBatchReady = false;
+    }
+#endif
 }
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+
+void NcpBase::HandleChangedPropsBatchTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+
+    NcpBase *ncp = GetNcpInstance();
+
+    ncp->mChangedPropsBatchReady = true;
+    ncp->UpdateChangedProps();
+}
+
+bool NcpBase::IsBatchableChangedProp(uint8_t aIndex, const ChangedPropsSet::Entry &aEntry) const
+{
+    // `LAST_STATUS` entries and properties without a get handler
+    // (e.g., vendor properties) are always sent in separate frames.
+
+    return mChangedPropsSet.IsEntryChanged(aIndex) && (aEntry.mPropKey != SPINEL_PROP_LAST_STATUS) &&
+           (FindGetPropertyHandler(aEntry.mPropKey) != NULL);
+}
+
+otError NcpBase::WriteChangedPropsBatchFrame(void)
+{
+    otError                       error        = OT_ERROR_NONE;
+    uint8_t                       numBatchable = 0;
+    uint8_t                       numEntries;
+    const ChangedPropsSet::Entry *entries = mChangedPropsSet.GetSupportedEntries(numEntries);
+    PropertyHandler               handler;
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (IsBatchableChangedProp(index, entries[index]))
+        {
+            numBatchable++;
+        }
+    }
+
+    // A single property is sent as a regular `VALUE_IS` frame.
+
+    VerifyOrExit(numBatchable > 1);
+
+    SuccessOrExit(error = mEncoder.BeginFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_CMD_PROP_VALUES_ARE));
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (!IsBatchableChangedProp(index, entries[index]))
+        {
+            continue;
+        }
+
+        handler = FindGetPropertyHandler(entries[index].mPropKey);
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(entries[index].mPropKey));
+        SuccessOrExit(error = (this->*handler)());
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (IsBatchableChangedProp(index, entries[index]))
+        {
+            mChangedPropsSet.RemoveEntry(index);
+        }
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+
 // ----------------------------------------------------------------------------
 // MARK: Inbound Command Handler
 // ----------------------------------------------------------------------------
@@ -51,6 +51,7 @@
 #include "changed_props_set.hpp"
 #include "common/instance.hpp"
 #include "common/tasklet.hpp"
+#include "common/timer.hpp"
 #include "ncp/ncp_buffer.hpp"
 #include "ncp/spinel_decoder.hpp"
 #include "ncp/spinel_encoder.hpp"
@@ -258,6 +259,12 @@ protected:
     static void UpdateChangedProps(Tasklet &aTasklet);
     void        UpdateChangedProps(void);
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+    static void HandleChangedPropsBatchTimer(Timer &aTimer);
+    bool        IsBatchableChangedProp(uint8_t aIndex, const ChangedPropsSet::Entry &aEntry) const;
+    otError     WriteChangedPropsBatchFrame(void);
+#endif
+
     static void HandleFrameRemovedFromNcpBuffer(void *                   aContext,
                                                 NcpFrameBuffer::FrameTag aFrameTag,
                                                 NcpFrameBuffer::Priority aPriority,
@@ -542,6 +549,10 @@ protected:
     Tasklet         mUpdateChangedPropsTask;
     uint32_t        mThreadChangedFlags;
     ChangedPropsSet mChangedPropsSet;
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+    TimerMilli      mChangedPropsBatchTimer;
+    bool            mChangedPropsBatchReady;
+#endif
 
     spinel_host_power_state_t mHostPowerState;
     NcpFrameBuffer::FrameTag  mHostPowerReplyFrameTag;
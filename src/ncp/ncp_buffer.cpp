@@ -32,6 +32,8 @@
 
 #include "ncp_buffer.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 
@@ -711,10 +713,11 @@ bool NcpFrameBuffer::OutFrameHasEnded(void)
     return (mReadState == kReadStateDone) || (mReadState == kReadStateNotActive);
 }
 
-uint8_t NcpFrameBuffer::OutFrameReadByte(void)
+uint16_t NcpFrameBuffer::OutFrameGetSpan(const uint8_t *&aSpan)
 {
-    otError error;
-    uint8_t retval = kReadByteAfterFrameHasEnded;
+    uint16_t length = 0;
+
+    aSpan = NULL;
 
     switch (mReadState)
     {
@@ -724,15 +727,55 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
     case kReadStateDone:
 
-        retval = kReadByteAfterFrameHasEnded;
+        break;
+
+    case kReadStateInSegment:
+
+        aSpan = mReadPointer;
+
+        if (mReadDirection == kForward)
+        {
+            // The span ends at the segment tail or where the circular buffer wraps, whichever comes first.
+            length = static_cast<uint16_t>(((mReadSegmentTail > mReadPointer) ? mReadSegmentTail : mBufferEnd) -
+                                           mReadPointer);
+        }
+        else
+        {
+            // Segments in backward direction are stored in reverse order, so only a single byte is contiguous.
+            length = sizeof(uint8_t);
+        }
+
+        break;
+
+    case kReadStateInMessage:
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+        aSpan  = mReadPointer;
+        length = static_cast<uint16_t>(mReadMessageTail - mReadPointer);
+#endif
+        break;
+    }
+
+    return length;
+}
+
+void NcpFrameBuffer::OutFrameSkip(uint16_t aLength)
+{
+    otError error;
+
+    switch (mReadState)
+    {
+    case kReadStateNotActive:
+
+        // Fall through
+
+    case kReadStateDone:
 
         break;
 
     case kReadStateInSegment:
 
-        // Read a byte from current read pointer and move the read pointer by 1 byte in the read direction.
-        retval       = *mReadPointer;
-        mReadPointer = GetUpdatedBufPtr(mReadPointer, 1, mReadDirection);
+        // Move the read pointer in the read direction.
+        mReadPointer = GetUpdatedBufPtr(mReadPointer, aLength, mReadDirection);
 
         // Check if at end of current segment.
         if (mReadPointer == mReadSegmentTail)
@@ -755,9 +798,7 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
     case kReadStateInMessage:
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
-        // Read a byte from current read pointer and move the read pointer by 1 byte.
-        retval = *mReadPointer;
-        mReadPointer++;
+        mReadPointer += aLength;
 
         // Check if at the end of content in message buffer.
         if (mReadPointer == mReadMessageTail)
@@ -774,17 +815,38 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 #endif
         break;
     }
+}
+
+uint8_t NcpFrameBuffer::OutFrameReadByte(void)
+{
+    const uint8_t *span;
+    uint8_t        retval = kReadByteAfterFrameHasEnded;
+
+    if (OutFrameGetSpan(span) > 0)
+    {
+        retval = *span;
+        OutFrameSkip(sizeof(uint8_t));
+    }
 
     return retval;
 }
 
 uint16_t NcpFrameBuffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
 {
-    uint16_t bytesRead = 0;
+    uint16_t       bytesRead = 0;
+    uint16_t       spanLength;
+    const uint8_t *span;
 
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
+    while ((bytesRead < aReadLength) && ((spanLength = OutFrameGetSpan(span)) > 0))
     {
-        *aDataBuffer++ = OutFrameReadByte();
+        if (spanLength > aReadLength - bytesRead)
+        {
+            spanLength = aReadLength - bytesRead;
+        }
+
+        memcpy(aDataBuffer + bytesRead, span, spanLength);
+        OutFrameSkip(spanLength);
+        bytesRead += spanLength;
     }
 
     return bytesRead;
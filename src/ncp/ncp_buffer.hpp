@@ -379,6 +379,37 @@ public:
      */
     uint8_t OutFrameReadByte(void);
 
+    /**
+     * This method gets the next contiguous span of bytes from the current output frame without moving the read offset.
+     *
+     * This allows the current output frame to be drained a span at a time instead of one byte at a time, e.g., by
+     * handing the span to an encoder or a driver and then calling `OutFrameSkip()` with the number of bytes consumed.
+     *
+     * Low priority frame segments are returned in place from the NCP buffer (a span ends at the end of a segment or
+     * where the circular buffer wraps). High priority frame segments are stored in reverse order, so each span
+     * contains a single byte. The content of an appended `otMessage` is returned from an internal buffer holding a
+     * portion of the message.
+     *
+     * The returned span remains valid until the read offset is moved or the frame is removed.
+     *
+     * @param[out] aSpan                A reference to a pointer to output the start of the span.
+     *
+     * @returns The number of bytes in the span, or zero if current output frame has ended or there is no
+     *          prepared/active output frame.
+     *
+     */
+    uint16_t OutFrameGetSpan(const uint8_t *&aSpan);
+
+    /**
+     * This method moves the read offset of the current output frame forward by a number of bytes.
+     *
+     * @note @p aLength MUST NOT be larger than the length of the span returned by the last `OutFrameGetSpan()` call.
+     *
+     * @param[in]  aLength              Number of bytes to skip.
+     *
+     */
+    void OutFrameSkip(uint16_t aLength);
+
     /**
      * This method reads and copies bytes from the current output frame into a given buffer.
      *
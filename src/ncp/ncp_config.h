@@ -158,6 +158,21 @@
 #define OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE 15
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+ *
+ * The batching window (in milliseconds) for unsolicited property updates. Set to zero to disable batching.
+ *
+ * When non-zero, NCP holds back unsolicited property updates for up to the given window after the first change and
+ * then reports all pending properties together in a single `SPINEL_CMD_PROP_VALUES_ARE` frame (one `t(iD)` struct
+ * per property). This reduces the number of frames (and host wake-ups) during bursts of changes, e.g., on attach or
+ * partition merge. The host driver must support `SPINEL_CMD_PROP_VALUES_ARE` frames when this is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+#define OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
  *
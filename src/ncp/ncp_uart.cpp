@@ -87,7 +87,6 @@ NcpUart::NcpUart(Instance *aInstance)
     , mFrameDecoder(mRxBuffer, &NcpUart::HandleFrame, this)
     , mUartBuffer()
     , mState(kStartingFrame)
-    , mByte(0)
     , mRxBuffer()
     , mUartSendImmediate(false)
     , mUartSendTask(*aInstance, EncodeAndSendToUart, this)
@@ -157,13 +156,32 @@ void NcpUart::EncodeAndSendToUart(void)
 
             mState = kEncodingFrame;
 
-            while (!txFrameBuffer.OutFrameHasEnded())
-            {
-                mByte = txFrameBuffer.OutFrameReadByte();
+            // fall through
 
-            case kEncodingFrame:
+        case kEncodingFrame:
 
-                SuccessOrExit(mFrameEncoder.Encode(mByte));
+            while (!txFrameBuffer.OutFrameHasEnded())
+            {
+                const uint8_t *span;
+                uint16_t       spanLength = txFrameBuffer.OutFrameGetSpan(span);
+                uint16_t       encodedLength;
+
+                if (mFrameEncoder.Encode(span, spanLength) != OT_ERROR_NONE)
+                {
+                    // The uart buffer cannot hold the whole span, encode as much of it as fits and send the buffer.
+                    for (encodedLength = 0; encodedLength < spanLength; encodedLength++)
+                    {
+                        if (mFrameEncoder.Encode(span[encodedLength]) != OT_ERROR_NONE)
+                        {
+                            break;
+                        }
+                    }
+
+                    txFrameBuffer.OutFrameSkip(encodedLength);
+                    ExitNow();
+                }
+
+                txFrameBuffer.OutFrameSkip(spanLength);
             }
 
             // track the change of mHostPowerStateInProgress by the
@@ -357,9 +375,16 @@ bool NcpUart::NcpFrameBufferEncrypterReader::OutFrameHasEnded(void)
     return (mDataBufferReadIndex >= mOutputDataLength);
 }
 
-uint8_t NcpUart::NcpFrameBufferEncrypterReader::OutFrameReadByte(void)
+uint16_t NcpUart::NcpFrameBufferEncrypterReader::OutFrameGetSpan(const uint8_t *&aSpan)
+{
+    aSpan = &mDataBuffer[mDataBufferReadIndex];
+
+    return static_cast<uint16_t>(mOutputDataLength - mDataBufferReadIndex);
+}
+
+void NcpUart::NcpFrameBufferEncrypterReader::OutFrameSkip(uint16_t aLength)
 {
-    return mDataBuffer[mDataBufferReadIndex++];
+    mDataBufferReadIndex += aLength;
 }
 
 otError NcpUart::NcpFrameBufferEncrypterReader::OutFrameRemove(void)
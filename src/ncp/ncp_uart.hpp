@@ -98,11 +98,12 @@ private:
          * Takes a reference to NcpFrameBuffer in order to read spinel frames.
          */
         explicit NcpFrameBufferEncrypterReader(NcpFrameBuffer &aTxFrameBuffer);
-        bool    IsEmpty(void) const;
-        otError OutFrameBegin(void);
-        bool    OutFrameHasEnded(void);
-        uint8_t OutFrameReadByte(void);
-        otError OutFrameRemove(void);
+        bool     IsEmpty(void) const;
+        otError  OutFrameBegin(void);
+        bool     OutFrameHasEnded(void);
+        uint16_t OutFrameGetSpan(const uint8_t *&aSpan);
+        void     OutFrameSkip(uint16_t aLength);
+        otError  OutFrameRemove(void);
 
     private:
         void Reset(void);
@@ -131,7 +132,6 @@ private:
     Hdlc::Decoder                        mFrameDecoder;
     Hdlc::FrameBuffer<kUartTxBufferSize> mUartBuffer;
     UartTxState                          mState;
-    uint8_t                              mByte;
     Hdlc::FrameBuffer<kRxBufferSize>     mRxBuffer;
     bool                                 mUartSendImmediate;
     Tasklet                              mUartSendTask;
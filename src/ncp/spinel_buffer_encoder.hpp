@@ -0,0 +1,277 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ *    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file contains the definitions of a spinel encoder writing to a flat buffer.
+ */
+
+#ifndef SPINEL_BUFFER_ENCODER_HPP_
+#define SPINEL_BUFFER_ENCODER_HPP_
+
+#include <openthread/config.h>
+
+#include <string.h>
+
+#include <openthread/platform/radio.h>
+
+#include "openthread-core-config.h"
+#include "common/code_utils.hpp"
+#include "ncp/spinel.h"
+
+namespace ot {
+namespace Ncp {
+
+/**
+ * This class defines a spinel encoder writing to a flat buffer.
+ *
+ * This is the counterpart of `SpinelDecoder`. Each spinel data type is written by its own (inline) method, so the
+ * layout of a frame is fixed when the code is compiled and the types of the written values are checked by the
+ * compiler, unlike `spinel_datatype_pack()` which interprets a format string and a variable argument list.
+ *
+ */
+class SpinelBufferEncoder
+{
+public:
+    /**
+     * This constructor initializes a `SpinelBufferEncoder` object.
+     *
+     * @param[in] aBuffer               A pointer to the buffer where the frame is written.
+     * @param[in] aBufferSize           The size of @p aBuffer (number of bytes).
+     *
+     */
+    SpinelBufferEncoder(uint8_t *aBuffer, uint16_t aBufferSize)
+        : mBuffer(aBuffer)
+        , mSize(aBufferSize)
+        , mLength(0)
+    {
+    }
+
+    /**
+     * This method returns the pointer to the start of the frame.
+     *
+     * @returns A pointer to buffer containing the frame.
+     *
+     */
+    const uint8_t *GetFrame(void) const { return mBuffer; }
+
+    /**
+     * This method returns the number of bytes written to the frame.
+     *
+     * @returns The length of the frame.
+     *
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method returns the number of bytes still available in the buffer.
+     *
+     * @returns The remaining buffer space (number of bytes).
+     *
+     */
+    uint16_t GetRemainingLength(void) const { return static_cast<uint16_t>(mSize - mLength); }
+
+    /**
+     * This method encodes and writes a boolean value to the frame.
+     *
+     * @param[in]  aBool                The boolean value to write.
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the value.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the value.
+     *
+     */
+    otError WriteBool(bool aBool) { return WriteUint8(aBool ? 0x01 : 0x00); }
+
+    /**
+     * This method encodes and writes a `uint8_t` value to the frame.
+     *
+     * @param[in]  aUint8               The value to write.
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the value.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the value.
+     *
+     */
+    otError WriteUint8(uint8_t aUint8)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(mLength < mSize, error = OT_ERROR_NO_BUFS);
+        mBuffer[mLength++] = aUint8;
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method encodes and writes an `int8_t` value to the frame.
+     *
+     * @param[in]  aInt8                The value to write.
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the value.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the value.
+     *
+     */
+    otError WriteInt8(int8_t aInt8) { return WriteUint8(static_cast<uint8_t>(aInt8)); }
+
+    /**
+     * This method encodes and writes a `uint16_t` value to the frame.
+     *
+     * @param[in]  aUint16              The value to write.
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the value.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the value.
+     *
+     */
+    otError WriteUint16(uint16_t aUint16)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(GetRemainingLength() >= sizeof(uint16_t), error = OT_ERROR_NO_BUFS);
+        mBuffer[mLength++] = static_cast<uint8_t>(aUint16 >> 0);
+        mBuffer[mLength++] = static_cast<uint8_t>(aUint16 >> 8);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method encodes and writes a `uint32_t` value to the frame.
+     *
+     * @param[in]  aUint32              The value to write.
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the value.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the value.
+     *
+     */
+    otError WriteUint32(uint32_t aUint32)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(GetRemainingLength() >= sizeof(uint32_t), error = OT_ERROR_NO_BUFS);
+        mBuffer[mLength++] = static_cast<uint8_t>(aUint32 >> 0);
+        mBuffer[mLength++] = static_cast<uint8_t>(aUint32 >> 8);
+        mBuffer[mLength++] = static_cast<uint8_t>(aUint32 >> 16);
+        mBuffer[mLength++] = static_cast<uint8_t>(aUint32 >> 24);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method encodes (using spinel packed encoding format) and writes an unsigned int value to the frame.
+     *
+     * @param[in]  aUint                The value to write.
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the value.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the value.
+     *
+     */
+    otError WriteUintPacked(unsigned int aUint)
+    {
+        otError        error = OT_ERROR_NONE;
+        spinel_ssize_t len;
+
+        if (aUint < 0x80)
+        {
+            // Commands and most property keys fit in a single byte.
+            ExitNow(error = WriteUint8(static_cast<uint8_t>(aUint)));
+        }
+
+        len = spinel_packed_uint_encode(&mBuffer[mLength], GetRemainingLength(), aUint);
+        VerifyOrExit(len <= GetRemainingLength(), error = OT_ERROR_NO_BUFS);
+        mLength += static_cast<uint16_t>(len);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method encodes and writes an EUI64 value to the frame.
+     *
+     * @param[in]  aExtAddress          The EUI64 value to write.
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the value.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the value.
+     *
+     */
+    otError WriteEui64(const otExtAddress &aExtAddress) { return WriteData(aExtAddress.m8, sizeof(spinel_eui64_t)); }
+
+    /**
+     * This method writes a data blob (sequence of bytes) to the frame.
+     *
+     * @param[in]  aData                A pointer to the data to write.
+     * @param[in]  aDataLen             The data length (number of bytes).
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the data.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the data.
+     *
+     */
+    otError WriteData(const uint8_t *aData, uint16_t aDataLen)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(GetRemainingLength() >= aDataLen, error = OT_ERROR_NO_BUFS);
+        memcpy(&mBuffer[mLength], aData, aDataLen);
+        mLength += aDataLen;
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method writes a data blob (sequence of bytes) with its length prepended before the data.
+     *
+     * @param[in]  aData                A pointer to the data to write.
+     * @param[in]  aDataLen             The data length (number of bytes).
+     *
+     * @retval OT_ERROR_NONE            Successfully wrote the data.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to write the data.
+     *
+     */
+    otError WriteDataWithLen(const uint8_t *aData, uint16_t aDataLen)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(GetRemainingLength() >= sizeof(uint16_t) + aDataLen, error = OT_ERROR_NO_BUFS);
+        IgnoreReturnValue(WriteUint16(aDataLen));
+        IgnoreReturnValue(WriteData(aData, aDataLen));
+
+    exit:
+        return error;
+    }
+
+private:
+    uint8_t *mBuffer;
+    uint16_t mSize;
+    uint16_t mLength;
+};
+
+} // namespace Ncp
+} // namespace ot
+
+#endif // SPINEL_BUFFER_ENCODER_HPP_
@@ -81,4 +81,14 @@
 #ifndef OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE
 #define OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE 1
 #endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+ *
+ * Define to 1 to run AES and SHA-256 on the CPU crypto instructions when available.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+#define OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE 1
+#endif
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
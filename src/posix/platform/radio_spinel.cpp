@@ -183,6 +183,7 @@ RadioSpinel::RadioSpinel(void)
     , mIsPromiscuous(false)
     , mIsReady(false)
     , mSupportsLogStream(false)
+    , mSrcMatchFailed(false)
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
     , mDiagMode(false)
     , mDiagOutput(NULL)
@@ -191,6 +192,11 @@ RadioSpinel::RadioSpinel(void)
     , mTxRadioEndUs(UINT64_MAX)
 {
     mVersion[0] = '\0';
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mAsyncRequests); i++)
+    {
+        mAsyncRequests[i].mHandler = NULL;
+    }
 }
 
 void RadioSpinel::Init(const otPlatformConfig &aPlatformConfig)
@@ -352,14 +358,14 @@ void RadioSpinel::Deinit(void)
 
 void RadioSpinel::HandleReceivedFrame(void)
 {
-    otError        error = OT_ERROR_NONE;
-    uint8_t        header;
-    spinel_ssize_t unpacked;
+    otError error = OT_ERROR_NONE;
+    uint8_t header;
+
+    VerifyOrExit(mRxFrameBuffer.GetLength() > 0, error = OT_ERROR_PARSE);
 
-    unpacked = spinel_datatype_unpack(mRxFrameBuffer.GetFrame(), mRxFrameBuffer.GetLength(), "C", &header);
+    header = mRxFrameBuffer.GetFrame()[0];
 
-    VerifyOrExit(unpacked > 0 && (header & SPINEL_HEADER_FLAG) == SPINEL_HEADER_FLAG &&
-                     SPINEL_HEADER_GET_IID(header) == 0,
+    VerifyOrExit((header & SPINEL_HEADER_FLAG) == SPINEL_HEADER_FLAG && SPINEL_HEADER_GET_IID(header) == 0,
                  error = OT_ERROR_PARSE);
 
     if (SPINEL_HEADER_GET_TID(header) == 0)
@@ -391,14 +397,17 @@ void RadioSpinel::HandleNotification(SpinelInterface::RxFrameBuffer &aFrameBuffe
     otError           error           = OT_ERROR_NONE;
     bool              shouldSaveFrame = false;
 
-    unpacked = spinel_datatype_unpack(aFrameBuffer.GetFrame(), aFrameBuffer.GetLength(), "CiiD", &header, &cmd, &key,
-                                      &data, &len);
+    unpacked =
+        spinel_datatype_unpack(aFrameBuffer.GetFrame(), aFrameBuffer.GetLength(), "CiD", &header, &cmd, &data, &len);
     VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
     VerifyOrExit(SPINEL_HEADER_GET_TID(header) == 0, error = OT_ERROR_PARSE);
 
     switch (cmd)
     {
     case SPINEL_CMD_PROP_VALUE_IS:
+        unpacked = spinel_datatype_unpack(data, len, "iD", &key, &data, &len);
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+
         // Some spinel properties cannot be handled during `WaitResponse()`, we must cache these events.
         // `mWaitingTid` is released immediately after received the response. And `mWaitingKey` is be set
         // to `SPINEL_PROP_LAST_STATUS` at the end of `WaitResponse()`.
@@ -411,6 +420,19 @@ void RadioSpinel::HandleNotification(SpinelInterface::RxFrameBuffer &aFrameBuffe
         HandleValueIs(key, data, static_cast<uint16_t>(len));
         break;
 
+    case SPINEL_CMD_PROP_VALUES_ARE:
+        // A batch of property updates is saved as a whole if any of
+        // its properties cannot be handled now, so that the updates
+        // are still handled in order.
+
+        if (!IsSafeToHandleNow(data, static_cast<uint16_t>(len)))
+        {
+            ExitNow(shouldSaveFrame = true);
+        }
+
+        error = HandleValuesAre(data, static_cast<uint16_t>(len));
+        break;
+
     case SPINEL_CMD_PROP_VALUE_INSERTED:
     case SPINEL_CMD_PROP_VALUE_REMOVED:
         otLogInfoPlat("Ignored command %d", cmd);
@@ -443,33 +465,93 @@ void RadioSpinel::HandleNotification(const uint8_t *aFrame, uint16_t aLength)
     uint8_t           header;
     otError           error = OT_ERROR_NONE;
 
-    unpacked = spinel_datatype_unpack(aFrame, aLength, "CiiD", &header, &cmd, &key, &data, &len);
+    unpacked = spinel_datatype_unpack(aFrame, aLength, "CiD", &header, &cmd, &data, &len);
     VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
     VerifyOrExit(SPINEL_HEADER_GET_TID(header) == 0, error = OT_ERROR_PARSE);
+
+    if (cmd == SPINEL_CMD_PROP_VALUES_ARE)
+    {
+        ExitNow(error = HandleValuesAre(data, static_cast<uint16_t>(len)));
+    }
+
     VerifyOrExit(cmd == SPINEL_CMD_PROP_VALUE_IS);
+    unpacked = spinel_datatype_unpack(data, len, "iD", &key, &data, &len);
+    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
     HandleValueIs(key, data, static_cast<uint16_t>(len));
 
 exit:
     LogIfFail("Error processing saved notification", error);
 }
 
-void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
+bool RadioSpinel::IsSafeToHandleNow(const uint8_t *aBuffer, uint16_t aLength) const
 {
+    bool              isSafe = true;
     spinel_prop_key_t key;
-    uint8_t *         data   = NULL;
-    spinel_size_t     len    = 0;
-    uint8_t           header = 0;
-    uint32_t          cmd    = 0;
-    spinel_ssize_t    rval   = 0;
-    otError           error  = OT_ERROR_NONE;
-
-    rval = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
-    VerifyOrExit(rval > 0 && cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED,
-                 error = OT_ERROR_PARSE);
+    spinel_ssize_t    unpacked;
+
+    while (aLength > 0)
+    {
+        // Parse errors are left to be reported by `HandleValuesAre()`.
+
+        unpacked = spinel_datatype_unpack(aBuffer, aLength, "t(i)", &key);
+        VerifyOrExit(unpacked > 0);
+        VerifyOrExit(IsSafeToHandleNow(key), isSafe = false);
+
+        aBuffer += unpacked;
+        aLength -= static_cast<uint16_t>(unpacked);
+    }
+
+exit:
+    return isSafe;
+}
+
+otError RadioSpinel::HandleValuesAre(const uint8_t *aBuffer, uint16_t aLength)
+{
+    otError           error = OT_ERROR_NONE;
+    spinel_prop_key_t key;
+    spinel_size_t     len = 0;
+    spinel_ssize_t    unpacked;
+    uint8_t *         data = NULL;
+
+    // The property values are packed as a sequence of `t(iD)` structs.
+
+    while (aLength > 0)
+    {
+        unpacked = spinel_datatype_unpack(aBuffer, aLength, "t(iD)", &key, &data, &len);
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        HandleValueIs(key, data, static_cast<uint16_t>(len));
+
+        aBuffer += unpacked;
+        aLength -= static_cast<uint16_t>(unpacked);
+    }
+
+exit:
+    return error;
+}
+
+void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
+{
+    Ncp::SpinelDecoder decoder;
+    spinel_prop_key_t  key;
+    const uint8_t *    data   = NULL;
+    uint16_t           len    = 0;
+    uint8_t            header = 0;
+    unsigned int       cmd    = 0;
+    unsigned int       propKey;
+    otError            error = OT_ERROR_NONE;
+
+    decoder.Init(aBuffer, aLength);
+    SuccessOrExit(error = decoder.ReadUint8(header));
+    SuccessOrExit(error = decoder.ReadUintPacked(cmd));
+    SuccessOrExit(error = decoder.ReadUintPacked(propKey));
+    SuccessOrExit(error = decoder.ReadData(data, len));
+    VerifyOrExit(cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED, error = OT_ERROR_PARSE);
+
+    key = static_cast<spinel_prop_key_t>(propKey);
 
     if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
     {
-        HandleWaitingResponse(cmd, key, data, static_cast<uint16_t>(len));
+        HandleWaitingResponse(cmd, key, data, len);
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
     }
@@ -477,12 +559,16 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
     {
         if (mState == kStateTransmitting)
         {
-            HandleTransmitDone(cmd, key, data, static_cast<uint16_t>(len));
+            HandleTransmitDone(cmd, key, data, len);
         }
 
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+    else if (mAsyncRequests[SPINEL_HEADER_GET_TID(header)].mHandler != NULL)
+    {
+        HandleAsyncResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, len);
+    }
     else
     {
         otLogWarnPlat("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -712,6 +798,82 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+void RadioSpinel::HandleAsyncResponse(spinel_tid_t      aTid,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t *   aBuffer,
+                                      uint16_t          aLength)
+{
+    AsyncRequest &request = mAsyncRequests[aTid];
+    otError       error   = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_UINT_PACKED_S, &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if (aKey != request.mKey || aCommand != request.mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    {
+        AsyncResponseHandler handler = request.mHandler;
+
+        // Release the transaction id first, so that the handler may issue new requests.
+        request.mHandler = NULL;
+        FreeTid(aTid);
+        (this->*handler)(request.mCommand, request.mKey, error);
+    }
+}
+
+void RadioSpinel::ExpireAsyncRequests(void)
+{
+    uint64_t now = platformGetTime();
+
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        AsyncRequest &       request = mAsyncRequests[tid];
+        AsyncResponseHandler handler = request.mHandler;
+
+        if (handler != NULL && now >= request.mTimeout)
+        {
+            otLogWarnPlat("No response for asynchronous transaction: %u", tid);
+            request.mHandler = NULL;
+            FreeTid(tid);
+            (this->*handler)(request.mCommand, request.mKey, OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    }
+}
+
+void RadioSpinel::ProcessAsyncRequests(void)
+{
+    ExpireAsyncRequests();
+
+    if (mSrcMatchFailed)
+    {
+        // The core considers the entry added, so fall back to setting frame pending in all acks.
+        mSrcMatchFailed = false;
+        LogIfFail("Error disabling source match", EnableSrcMatch(false));
+    }
+}
+
+void RadioSpinel::HandleSrcMatchResponse(uint32_t aCommand, spinel_prop_key_t aKey, otError aError)
+{
+    OT_UNUSED_VARIABLE(aKey);
+
+    LogIfFail("Error updating source match table", aError);
+
+    if (aError != OT_ERROR_NONE && aCommand == SPINEL_CMD_PROP_VALUE_INSERT)
+    {
+        mSrcMatchFailed = true;
+    }
+}
+
 void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
     otError error = OT_ERROR_NONE;
@@ -813,30 +975,36 @@ exit:
 
 otError RadioSpinel::ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffer, uint16_t aLength)
 {
-    otError        error        = OT_ERROR_NONE;
-    uint16_t       flags        = 0;
-    int8_t         noiseFloor   = -128;
-    spinel_size_t  size         = OT_RADIO_FRAME_MAX_SIZE;
-    unsigned int   receiveError = 0;
-    spinel_ssize_t unpacked;
-
-    unpacked = spinel_datatype_unpack_in_place(aBuffer, aLength,
-                                               SPINEL_DATATYPE_DATA_WLEN_S                          // Frame
-                                                               SPINEL_DATATYPE_INT8_S               // RSSI
-                                                               SPINEL_DATATYPE_INT8_S               // Noise Floor
-                                                               SPINEL_DATATYPE_UINT16_S             // Flags
-                                                               SPINEL_DATATYPE_STRUCT_S(            // PHY-data
-                                                                   SPINEL_DATATYPE_UINT8_S          // 802.15.4 channel
-                                                                           SPINEL_DATATYPE_UINT8_S  // 802.15.4 LQI
-                                                                           SPINEL_DATATYPE_UINT64_S // Timestamp (us).
-                                                                   ) SPINEL_DATATYPE_STRUCT_S(      // Vendor-data
-                                                                   SPINEL_DATATYPE_UINT_PACKED_S    // Receive error
-                                                                   ),
-                                               aFrame.mPsdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags,
-                                               &aFrame.mChannel, &aFrame.mInfo.mRxInfo.mLqi,
-                                               &aFrame.mInfo.mRxInfo.mTimestamp, &receiveError);
+    otError            error        = OT_ERROR_NONE;
+    uint16_t           flags        = 0;
+    int8_t             noiseFloor   = -128;
+    unsigned int       receiveError = 0;
+    const uint8_t *    psdu;
+    uint16_t           size;
+    Ncp::SpinelDecoder decoder;
 
-    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+    decoder.Init(aBuffer, aLength);
+
+    // Frame, RSSI, noise floor and flags.
+    SuccessOrExit(error = decoder.ReadDataWithLen(psdu, size));
+    VerifyOrExit(size <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
+    SuccessOrExit(error = decoder.ReadInt8(aFrame.mInfo.mRxInfo.mRssi));
+    SuccessOrExit(error = decoder.ReadInt8(noiseFloor));
+    SuccessOrExit(error = decoder.ReadUint16(flags));
+
+    // PHY-data: 802.15.4 channel, 802.15.4 LQI and timestamp (us).
+    SuccessOrExit(error = decoder.OpenStruct());
+    SuccessOrExit(error = decoder.ReadUint8(aFrame.mChannel));
+    SuccessOrExit(error = decoder.ReadUint8(aFrame.mInfo.mRxInfo.mLqi));
+    SuccessOrExit(error = decoder.ReadUint64(aFrame.mInfo.mRxInfo.mTimestamp));
+    SuccessOrExit(error = decoder.CloseStruct());
+
+    // Vendor-data: receive error.
+    SuccessOrExit(error = decoder.OpenStruct());
+    SuccessOrExit(error = decoder.ReadUintPacked(receiveError));
+    SuccessOrExit(error = decoder.CloseStruct());
+
+    memcpy(aFrame.mPsdu, psdu, size);
 
     if (receiveError == OT_ERROR_NONE)
     {
@@ -942,7 +1110,35 @@ void RadioSpinel::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMax
         }
     }
 
-    if (mRxFrameBuffer.HasSavedFrame() || (mState == kStateTransmitDone))
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        uint64_t now;
+
+        if (mAsyncRequests[tid].mHandler == NULL)
+        {
+            continue;
+        }
+
+        now = platformGetTime();
+
+        if (now < mAsyncRequests[tid].mTimeout)
+        {
+            uint64_t remain = mAsyncRequests[tid].mTimeout - now;
+
+            if (remain < static_cast<uint64_t>(aTimeout.tv_sec * US_PER_S + aTimeout.tv_usec))
+            {
+                aTimeout.tv_sec  = static_cast<time_t>(remain / US_PER_S);
+                aTimeout.tv_usec = static_cast<suseconds_t>(remain % US_PER_S);
+            }
+        }
+        else
+        {
+            aTimeout.tv_sec  = 0;
+            aTimeout.tv_usec = 0;
+        }
+    }
+
+    if (mRxFrameBuffer.HasSavedFrame() || (mState == kStateTransmitDone) || mSrcMatchFailed)
     {
         aTimeout.tv_sec  = 0;
         aTimeout.tv_usec = 0;
@@ -964,6 +1160,8 @@ void RadioSpinel::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet)
         ProcessFrameQueue();
     }
 
+    ProcessAsyncRequests();
+
     if (mState == kStateTransmitDone)
     {
         mState        = kStateReceive;
@@ -1032,37 +1230,37 @@ exit:
 
 otError RadioSpinel::EnableSrcMatch(bool aEnable)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
+    return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, aEnable);
 }
 
 otError RadioSpinel::AddSrcMatchShortEntry(const uint16_t aShortAddress)
 {
-    return Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress);
+    return InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, &RadioSpinel::HandleSrcMatchResponse, aShortAddress);
 }
 
 otError RadioSpinel::AddSrcMatchExtEntry(const otExtAddress &aExtAddress)
 {
-    return Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8);
+    return InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, &RadioSpinel::HandleSrcMatchResponse, aExtAddress);
 }
 
 otError RadioSpinel::ClearSrcMatchShortEntry(const uint16_t aShortAddress)
 {
-    return Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress);
+    return RemoveAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, &RadioSpinel::HandleSrcMatchResponse, aShortAddress);
 }
 
 otError RadioSpinel::ClearSrcMatchExtEntry(const otExtAddress &aExtAddress)
 {
-    return Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8);
+    return RemoveAsync(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, &RadioSpinel::HandleSrcMatchResponse, aExtAddress);
 }
 
 otError RadioSpinel::ClearSrcMatchShortEntries(void)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, NULL);
+    return Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, EmptyValue());
 }
 
 otError RadioSpinel::ClearSrcMatchExtEntries(void)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, NULL);
+    return Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, EmptyValue());
 }
 
 otError RadioSpinel::GetTransmitPower(int8_t &aPower)
@@ -1203,6 +1401,19 @@ otError RadioSpinel::Set(spinel_prop_key_t aKey, const char *aFormat, ...)
     return error;
 }
 
+template <typename ValueType> otError RadioSpinel::Set(spinel_prop_key_t aKey, const ValueType &aValue)
+{
+    otError error;
+
+    assert(mWaitingTid == 0);
+
+    mExpectedCommand = SPINEL_CMD_PROP_VALUE_IS;
+    error            = Request(true, SPINEL_CMD_PROP_VALUE_SET, aKey, aValue);
+    mExpectedCommand = SPINEL_CMD_NOOP;
+
+    return error;
+}
+
 otError RadioSpinel::Insert(spinel_prop_key_t aKey, const char *aFormat, ...)
 {
     otError error;
@@ -1233,6 +1444,18 @@ otError RadioSpinel::Remove(spinel_prop_key_t aKey, const char *aFormat, ...)
     return error;
 }
 
+template <typename ValueType>
+otError RadioSpinel::InsertAsync(spinel_prop_key_t aKey, AsyncResponseHandler aHandler, const ValueType &aValue)
+{
+    return RequestAsync(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_CMD_PROP_VALUE_INSERTED, aKey, aHandler, aValue);
+}
+
+template <typename ValueType>
+otError RadioSpinel::RemoveAsync(spinel_prop_key_t aKey, AsyncResponseHandler aHandler, const ValueType &aValue)
+{
+    return RequestAsync(SPINEL_CMD_PROP_VALUE_REMOVE, SPINEL_CMD_PROP_VALUE_REMOVED, aKey, aHandler, aValue);
+}
+
 otError RadioSpinel::WaitResponse(void)
 {
     uint64_t       now     = platformGetTime();
@@ -1285,6 +1508,28 @@ spinel_tid_t RadioSpinel::GetNextTid(void)
     return tid;
 }
 
+otError RadioSpinel::AllocateTid(spinel_tid_t &aTid)
+{
+    otError error = OT_ERROR_NONE;
+
+    while ((aTid = GetNextTid()) == 0)
+    {
+        struct timeval timeout = {kMaxWaitTime / 1000, (kMaxWaitTime % 1000) * 1000};
+
+        // Transaction ids are allocated in order, so the next one is held by the oldest request in flight. Only an
+        // asynchronous request is worth waiting for, as its response is handled while receiving.
+        VerifyOrExit(mAsyncRequests[mCmdNextTid].mHandler != NULL, error = OT_ERROR_BUSY);
+
+        if (mSpinelInterface.WaitForFrame(timeout) == OT_ERROR_RESPONSE_TIMEOUT)
+        {
+            ExpireAsyncRequests();
+        }
+    }
+
+exit:
+    return error;
+}
+
 otError RadioSpinel::SendReset(void)
 {
     otError        error = OT_ERROR_NONE;
@@ -1311,18 +1556,18 @@ otError RadioSpinel::SendCommand(uint32_t          aCommand,
                                  const char *      aFormat,
                                  va_list           args)
 {
-    otError        error = OT_ERROR_NONE;
-    uint8_t        buffer[kMaxSpinelFrame];
-    spinel_ssize_t packed;
-    uint16_t       offset;
+    otError                  error = OT_ERROR_NONE;
+    uint8_t                  buffer[kMaxSpinelFrame];
+    Ncp::SpinelBufferEncoder encoder(buffer, sizeof(buffer));
+    spinel_ssize_t           packed;
+    uint16_t                 offset;
 
     // Pack the header, command and key
-    packed = spinel_datatype_pack(buffer, sizeof(buffer), "Cii", SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid,
-                                  aCommand, aKey);
+    SuccessOrExit(error = encoder.WriteUint8(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid));
+    SuccessOrExit(error = encoder.WriteUintPacked(aCommand));
+    SuccessOrExit(error = encoder.WriteUintPacked(aKey));
 
-    VerifyOrExit(packed > 0 && static_cast<size_t>(packed) <= sizeof(buffer), error = OT_ERROR_NO_BUFS);
-
-    offset = static_cast<uint16_t>(packed);
+    offset = encoder.GetLength();
 
     // Pack the data (if any)
     if (aFormat)
@@ -1339,27 +1584,117 @@ exit:
     return error;
 }
 
+template <typename ValueType>
+otError RadioSpinel::SendCommand(uint32_t aCommand, spinel_prop_key_t aKey, spinel_tid_t aTid, const ValueType &aValue)
+{
+    otError                  error = OT_ERROR_NONE;
+    uint8_t                  buffer[kMaxSpinelFrame];
+    Ncp::SpinelBufferEncoder encoder(buffer, sizeof(buffer));
+
+    SuccessOrExit(error = encoder.WriteUint8(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | aTid));
+    SuccessOrExit(error = encoder.WriteUintPacked(aCommand));
+    SuccessOrExit(error = encoder.WriteUintPacked(aKey));
+    SuccessOrExit(error = EncodeValue(encoder, aValue));
+
+    error = mSpinelInterface.SendFrame(buffer, encoder.GetLength());
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, const EmptyValue &aValue)
+{
+    OT_UNUSED_VARIABLE(aEncoder);
+    OT_UNUSED_VARIABLE(aValue);
+
+    return OT_ERROR_NONE;
+}
+
+otError RadioSpinel::EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, bool aValue)
+{
+    return aEncoder.WriteBool(aValue);
+}
+
+otError RadioSpinel::EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, uint8_t aValue)
+{
+    return aEncoder.WriteUint8(aValue);
+}
+
+otError RadioSpinel::EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, uint16_t aValue)
+{
+    return aEncoder.WriteUint16(aValue);
+}
+
+otError RadioSpinel::EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, const otExtAddress &aValue)
+{
+    return aEncoder.WriteEui64(aValue);
+}
+
+otError RadioSpinel::EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, const otRadioFrame &aValue)
+{
+    otError error = OT_ERROR_NONE;
+
+    // Frame data, channel, MaxCsmaBackoffs, MaxFrameRetries and CsmaCaEnabled.
+    SuccessOrExit(error = aEncoder.WriteDataWithLen(aValue.mPsdu, aValue.mLength));
+    SuccessOrExit(error = aEncoder.WriteUint8(aValue.mChannel));
+    SuccessOrExit(error = aEncoder.WriteUint8(aValue.mInfo.mTxInfo.mMaxCsmaBackoffs));
+    SuccessOrExit(error = aEncoder.WriteUint8(aValue.mInfo.mTxInfo.mMaxFrameRetries));
+    SuccessOrExit(error = aEncoder.WriteBool(aValue.mInfo.mTxInfo.mCsmaCaEnabled));
+
+exit:
+    return error;
+}
+
 otError RadioSpinel::RequestV(bool aWait, uint32_t command, spinel_prop_key_t aKey, const char *aFormat, va_list aArgs)
 {
     otError      error = OT_ERROR_NONE;
-    spinel_tid_t tid   = (aWait ? GetNextTid() : 0);
+    spinel_tid_t tid   = 0;
 
-    VerifyOrExit(!aWait || tid > 0, error = OT_ERROR_BUSY);
+    if (aWait)
+    {
+        SuccessOrExit(error = AllocateTid(tid));
+    }
 
-    error = SendCommand(command, aKey, tid, aFormat, aArgs);
-    VerifyOrExit(error == OT_ERROR_NONE);
+    SuccessOrExit(error = SendCommand(command, aKey, tid, aFormat, aArgs));
+    error = HandleRequestSent(aWait, aKey, tid);
+
+exit:
+    return error;
+}
+
+template <typename ValueType>
+otError RadioSpinel::Request(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const ValueType &aValue)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid   = 0;
+
+    if (aWait)
+    {
+        SuccessOrExit(error = AllocateTid(tid));
+    }
+
+    SuccessOrExit(error = SendCommand(aCommand, aKey, tid, aValue));
+    error = HandleRequestSent(aWait, aKey, tid);
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::HandleRequestSent(bool aWait, spinel_prop_key_t aKey, spinel_tid_t aTid)
+{
+    otError error = OT_ERROR_NONE;
 
     if (aKey == SPINEL_PROP_STREAM_RAW)
     {
         // not allowed to send another frame before the last frame is done.
         assert(mTxRadioTid == 0);
         VerifyOrExit(mTxRadioTid == 0, error = OT_ERROR_BUSY);
-        mTxRadioTid = tid;
+        mTxRadioTid = aTid;
     }
     else if (aWait)
     {
         mWaitingKey = aKey;
-        mWaitingTid = tid;
+        mWaitingTid = aTid;
         error       = WaitResponse();
     }
 
@@ -1367,13 +1702,36 @@ exit:
     return error;
 }
 
-otError RadioSpinel::Request(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, ...)
+template <typename ValueType>
+otError RadioSpinel::RequestAsync(uint32_t             aCommand,
+                                  uint32_t             aExpectedCommand,
+                                  spinel_prop_key_t    aKey,
+                                  AsyncResponseHandler aHandler,
+                                  const ValueType &    aValue)
 {
-    va_list args;
-    va_start(args, aFormat);
-    otError status = RequestV(aWait, aCommand, aKey, aFormat, args);
-    va_end(args);
-    return status;
+    otError      error;
+    spinel_tid_t tid;
+
+    assert(aHandler != NULL);
+
+    SuccessOrExit(error = AllocateTid(tid));
+
+    error = SendCommand(aCommand, aKey, tid, aValue);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mAsyncRequests[tid].mHandler         = aHandler;
+    mAsyncRequests[tid].mCommand         = aCommand;
+    mAsyncRequests[tid].mExpectedCommand = aExpectedCommand;
+    mAsyncRequests[tid].mKey             = aKey;
+    mAsyncRequests[tid].mTimeout         = platformGetTime() + kMaxWaitTime * US_PER_MS;
+
+exit:
+    return error;
 }
 
 void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
@@ -1381,31 +1739,26 @@ void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
                                      const uint8_t *   aBuffer,
                                      uint16_t          aLength)
 {
-    otError         error  = OT_ERROR_NONE;
-    spinel_status_t status = SPINEL_STATUS_OK;
-    spinel_ssize_t  unpacked;
+    otError            error  = OT_ERROR_NONE;
+    unsigned int       status = SPINEL_STATUS_OK;
+    Ncp::SpinelDecoder decoder;
 
     VerifyOrExit(aCommand == SPINEL_CMD_PROP_VALUE_IS && aKey == SPINEL_PROP_LAST_STATUS, error = OT_ERROR_FAILED);
 
-    unpacked = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_UINT_PACKED_S, &status);
-    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
-
-    aBuffer += unpacked;
-    aLength -= static_cast<uint16_t>(unpacked);
+    decoder.Init(aBuffer, aLength);
+    SuccessOrExit(error = decoder.ReadUintPacked(status));
 
     if (status == SPINEL_STATUS_OK)
     {
         bool framePending = false;
-        unpacked          = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_BOOL_S, &framePending);
-        OT_UNUSED_VARIABLE(framePending);
-        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
 
-        aBuffer += unpacked;
-        aLength -= static_cast<spinel_size_t>(unpacked);
+        SuccessOrExit(error = decoder.ReadBool(framePending));
+        OT_UNUSED_VARIABLE(framePending);
 
-        if (aLength > 0)
+        if (!decoder.IsAllRead())
         {
-            SuccessOrExit(error = ParseRadioFrame(mAckRadioFrame, aBuffer, aLength));
+            SuccessOrExit(error = ParseRadioFrame(mAckRadioFrame, aBuffer + decoder.GetReadLength(),
+                                                  decoder.GetRemainingLength()));
         }
         else
         {
@@ -1414,7 +1767,7 @@ void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
     }
     else
     {
-        error = SpinelStatusToOtError(status);
+        error = SpinelStatusToOtError(static_cast<spinel_status_t>(status));
     }
 
 exit:
@@ -1434,15 +1787,7 @@ otError RadioSpinel::Transmit(otRadioFrame &aFrame)
     // `otPlatRadioTxStarted()` is triggered immediately for now, which may be earlier than real started time.
     otPlatRadioTxStarted(mInstance, mTransmitFrame);
 
-    error = Request(true, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW,
-                    SPINEL_DATATYPE_DATA_WLEN_S             // Frame data
-                                    SPINEL_DATATYPE_UINT8_S // Channel
-                                    SPINEL_DATATYPE_UINT8_S // MaxCsmaBackoffs
-                                    SPINEL_DATATYPE_UINT8_S // MaxFrameRetries
-                                    SPINEL_DATATYPE_BOOL_S, // CsmaCaEnabled
-                    mTransmitFrame->mPsdu, mTransmitFrame->mLength, mTransmitFrame->mChannel,
-                    mTransmitFrame->mInfo.mTxInfo.mMaxCsmaBackoffs, mTransmitFrame->mInfo.mTxInfo.mMaxFrameRetries,
-                    mTransmitFrame->mInfo.mTxInfo.mCsmaCaEnabled);
+    error = Request(true, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW, *mTransmitFrame);
 
     if (error == OT_ERROR_NONE)
     {
@@ -1463,14 +1808,14 @@ otError RadioSpinel::Receive(uint8_t aChannel)
 
     if (mChannel != aChannel)
     {
-        error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
+        error = Set(SPINEL_PROP_PHY_CHAN, aChannel);
         VerifyOrExit(error == OT_ERROR_NONE);
         mChannel = aChannel;
     }
 
     if (mState == kStateSleep)
     {
-        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, true);
         VerifyOrExit(error == OT_ERROR_NONE);
     }
 
@@ -1493,7 +1838,7 @@ otError RadioSpinel::Sleep(void)
     switch (mState)
     {
     case kStateReceive:
-        error = sRadioSpinel.Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
+        error = sRadioSpinel.Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, false);
         VerifyOrExit(error == OT_ERROR_NONE);
 
         mState = kStateSleep;
@@ -1875,6 +2220,8 @@ void ot::PosixApp::RadioSpinel::Process(const Event &aEvent)
         ProcessFrameQueue();
     }
 
+    ProcessAsyncRequests();
+
     if (mState == kStateTransmitDone)
     {
         mState        = kStateReceive;
@@ -47,6 +47,7 @@
 #include "spinel_interface.hpp"
 #include "ncp/ncp_config.h"
 #include "ncp/spinel.h"
+#include "ncp/spinel_buffer_encoder.hpp"
 
 namespace ot {
 namespace PosixApp {
@@ -535,9 +536,12 @@ public:
     void HandleReceivedFrame(void);
 
 private:
+    friend class TestRadioSpinel;
+
     enum
     {
         kMaxSpinelFrame        = SpinelInterface::kMaxFrameSize,
+        kMaxTids               = SPINEL_HEADER_TID_MASK + 1,
         kMaxWaitTime           = 2000, ///< Max time to wait for response in milliseconds.
         kVersionStringSize     = 128,  ///< Max size of version string.
         kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
@@ -555,6 +559,29 @@ private:
 
     typedef otError (RadioSpinel::*ResponseHandler)(const uint8_t *aBuffer, uint16_t aLength);
 
+    /**
+     * This type represents the handler called when an asynchronous request completes.
+     *
+     * @param[in]  aCommand  The spinel command of the request.
+     * @param[in]  aKey      The spinel property key of the request.
+     * @param[in]  aError    The result of the request, OT_ERROR_RESPONSE_TIMEOUT if no response was received.
+     *
+     */
+    typedef void (RadioSpinel::*AsyncResponseHandler)(uint32_t aCommand, spinel_prop_key_t aKey, otError aError);
+
+    /**
+     * This structure represents an asynchronous request waiting for its response.
+     *
+     */
+    struct AsyncRequest
+    {
+        AsyncResponseHandler mHandler;         ///< The completion handler, NULL if the transaction id is not used.
+        uint32_t             mCommand;         ///< The spinel command of the request.
+        uint32_t             mExpectedCommand; ///< The expected response command.
+        spinel_prop_key_t    mKey;             ///< The spinel property key of the request.
+        uint64_t             mTimeout;         ///< The time by which a response is expected, in microseconds.
+    };
+
     otError CheckSpinelVersion(void);
     otError CheckCapabilities(bool &aIsRcp);
     otError CheckRadioCapabilities(void);
@@ -588,6 +615,22 @@ private:
      */
     otError Set(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * This method tries to update a spinel property of OpenThread transceiver.
+     *
+     * The spinel data type of the property value is selected at compile time from the type of @p aValue (see
+     * `EncodeValue()`).
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aValue      The property value.
+     *
+     * @retval  OT_ERROR_NONE               Successfully set the property.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    template <typename ValueType> otError Set(spinel_prop_key_t aKey, const ValueType &aValue);
+
     /**
      * This method tries to insert a item into a spinel list property of OpenThread transceiver.
      *
@@ -616,11 +659,35 @@ private:
      */
     otError Remove(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    template <typename ValueType>
+    otError InsertAsync(spinel_prop_key_t aKey, AsyncResponseHandler aHandler, const ValueType &aValue);
+
+    template <typename ValueType>
+    otError RemoveAsync(spinel_prop_key_t aKey, AsyncResponseHandler aHandler, const ValueType &aValue);
+
     spinel_tid_t GetNextTid(void);
+    otError      AllocateTid(spinel_tid_t &aTid);
     void         FreeTid(spinel_tid_t tid) { mCmdTidsInUse &= ~(1 << tid); }
 
     otError RequestV(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, va_list aArgs);
-    otError Request(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, ...);
+    template <typename ValueType>
+    otError Request(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const ValueType &aValue);
+    otError HandleRequestSent(bool aWait, spinel_prop_key_t aKey, spinel_tid_t aTid);
+
+    /**
+     * This method sends a request without waiting for its response.
+     *
+     * Up to `kMaxTids - 1` requests may be in flight at once, and the RCP handles them in order. @p aHandler is
+     * called from the receive path once the response arrives, or from `Process()` if none arrives within
+     * `kMaxWaitTime`, and must not issue synchronous requests.
+     *
+     */
+    template <typename ValueType>
+    otError RequestAsync(uint32_t             aCommand,
+                         uint32_t             aExpectedCommand,
+                         spinel_prop_key_t    aKey,
+                         AsyncResponseHandler aHandler,
+                         const ValueType &    aValue);
     otError WaitResponse(void);
     otError SendReset(void);
     otError SendCommand(uint32_t          command,
@@ -628,6 +695,31 @@ private:
                         spinel_tid_t      tid,
                         const char *      pack_format,
                         va_list           args);
+    template <typename ValueType>
+    otError SendCommand(uint32_t aCommand, spinel_prop_key_t aKey, spinel_tid_t aTid, const ValueType &aValue);
+
+    /**
+     * This type represents an empty property value, e.g., to clear a spinel list property.
+     *
+     */
+    struct EmptyValue
+    {
+    };
+
+    /**
+     * These methods encode a property value for the typed requests.
+     *
+     * The overload (and so the spinel data type) is selected by the compiler from the C++ type of the value. Passing
+     * a value of a type without an overload is a compile error.
+     *
+     */
+    static otError EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, const EmptyValue &aValue);
+    static otError EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, bool aValue);
+    static otError EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, uint8_t aValue);
+    static otError EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, uint16_t aValue);
+    static otError EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, const otExtAddress &aValue);
+    static otError EncodeValue(Ncp::SpinelBufferEncoder &aEncoder, const otRadioFrame &aValue);
+
     otError ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffer, uint16_t aLength);
     otError ThreadDatasetHandler(const uint8_t *aBuffer, uint16_t aLength);
 
@@ -647,13 +739,33 @@ private:
         return !(aKey == SPINEL_PROP_STREAM_RAW || aKey == SPINEL_PROP_MAC_ENERGY_SCAN_RESULT);
     }
 
-    void HandleNotification(SpinelInterface::RxFrameBuffer &aFrameBuffer);
-    void HandleNotification(const uint8_t *aBuffer, uint16_t aLength);
-    void HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    /**
+     * This method checks whether all properties in a `SPINEL_CMD_PROP_VALUES_ARE` frame are safe to be handled now.
+     *
+     * @param[in] aBuffer   A pointer to the property values (a sequence of `t(iD)` structs).
+     * @param[in] aLength   The length of @p aBuffer.
+     *
+     * @returns Whether all the properties are safe to be handled now.
+     *
+     */
+    bool IsSafeToHandleNow(const uint8_t *aBuffer, uint16_t aLength) const;
+
+    void    HandleNotification(SpinelInterface::RxFrameBuffer &aFrameBuffer);
+    void    HandleNotification(const uint8_t *aBuffer, uint16_t aLength);
+    void    HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    otError HandleValuesAre(const uint8_t *aBuffer, uint16_t aLength);
 
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandleAsyncResponse(spinel_tid_t      aTid,
+                             uint32_t          aCommand,
+                             spinel_prop_key_t aKey,
+                             const uint8_t *   aBuffer,
+                             uint16_t          aLength);
+    void ExpireAsyncRequests(void);
+    void ProcessAsyncRequests(void);
+    void HandleSrcMatchResponse(uint32_t aCommand, spinel_prop_key_t aKey, otError aError);
 
     void RadioReceive(void);
 
@@ -692,6 +804,8 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+    AsyncRequest mAsyncRequests[kMaxTids]; ///< Asynchronous requests in flight, indexed by transaction id.
+
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -713,6 +827,7 @@ private:
     bool  mIsPromiscuous : 1;     ///< Promiscuous mode.
     bool  mIsReady : 1;           ///< NCP ready.
     bool  mSupportsLogStream : 1; ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
+    bool  mSrcMatchFailed : 1;    ///< An asynchronous source match table update failed.
 
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
     bool   mDiagMode;
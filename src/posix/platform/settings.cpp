@@ -39,9 +39,12 @@
 #include <fcntl.h>
 #include <inttypes.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <openthread/platform/misc.h>
@@ -51,9 +54,48 @@
 
 static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
 
-static int sSettingsFd = -1;
+/*
+ * The settings file is an append-only log. It starts with `kLogMagic`, followed by records each made of a
+ * `LogRecord` header and `mLength` bytes of payload. The current settings are kept in an in-memory index which is
+ * rebuilt at init by replaying the log, and the log is rewritten through the swap file once stale records take up
+ * more space than the live ones.
+ *
+ * Since records are only ever appended, every prefix of the log made of whole records is a consistent state. A
+ * record torn by a crash or power failure fails its checksum and is truncated at init.
+ */
+static const uint32_t kLogMagic       = 0x4c53544f; ///< "OTSL"
+static const off_t    kCompactMinSize = 4096;       ///< Minimum stale bytes before compacting the log.
+
+enum
+{
+    kOperationAdd    = 1, ///< Append a value to a key.
+    kOperationSet    = 2, ///< Replace all values of a key.
+    kOperationDelete = 3, ///< Remove a value of a key, the payload is an `int16_t` index (-1 for all values).
+};
 
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd);
+struct LogRecord
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t  mOperation;
+    uint8_t  mReserved;
+    uint16_t mChecksum;
+};
+
+struct SettingsEntry
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t *mValue;
+};
+
+static int            sSettingsFd  = -1;
+static SettingsEntry *sEntries     = NULL;
+static size_t         sNumEntries  = 0;
+static size_t         sMaxEntries  = 0;
+static off_t          sLogSize     = 0; ///< Size of the log file.
+static off_t          sLiveSize    = 0; ///< Size of the log once compacted.
+static unsigned       sPendingSync = 0; ///< Number of records appended since the last fsync().
 
 static void getSettingsFileName(char aFileName[kMaxFileNameSize], bool aSwap)
 {
@@ -76,32 +118,6 @@ static int swapOpen(void)
     return fd;
 }
 
-/**
- * This function reads @p aLength bytes from the data file and appends to the swap file.
- *
- * @param[in]   aFd     The file descriptor of the current swap file.
- * @param[in]   aLength Number of bytes to copy.
- *
- */
-static void swapWrite(int aFd, uint16_t aLength)
-{
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
-
-    while (aLength > 0)
-    {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
-
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        assert(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
-    }
-}
-
 static void swapPersist(int aFd)
 {
     char swapFile[kMaxFileNameSize];
@@ -117,278 +133,435 @@ static void swapPersist(int aFd)
     sSettingsFd = aFd;
 }
 
-static void swapDiscard(int aFd)
+/**
+ * This function computes a CRC16-CCITT over @p aBuffer.
+ *
+ * The checksum is seeded with 0xffff, so that zero-filled blocks left by a power failure never pass the check.
+ *
+ */
+static uint16_t checksumUpdate(uint16_t aChecksum, const void *aBuffer, size_t aLength)
 {
-    char swapFileName[kMaxFileNameSize];
+    const uint8_t *bytes = static_cast<const uint8_t *>(aBuffer);
+
+    while (aLength-- > 0)
+    {
+        aChecksum ^= static_cast<uint16_t>(*bytes++ << 8);
+
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            aChecksum = static_cast<uint16_t>((aChecksum & 0x8000) ? ((aChecksum << 1) ^ 0x1021) : (aChecksum << 1));
+        }
+    }
 
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    getSettingsFileName(swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
+    return aChecksum;
 }
 
-void otPlatSettingsInit(otInstance *aInstance)
+static uint16_t recordChecksum(const LogRecord &aRecord, const void *aPayload)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    uint16_t checksum = checksumUpdate(0xffff, &aRecord, offsetof(LogRecord, mChecksum));
 
-    otError error = OT_ERROR_NONE;
+    return checksumUpdate(checksum, aPayload, aRecord.mLength);
+}
 
-    {
-        struct stat st;
+static bool readFully(void *aBuffer, size_t aLength)
+{
+    return read(sSettingsFd, aBuffer, aLength) == static_cast<ssize_t>(aLength);
+}
 
-        if (stat(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, &st) == -1)
+/**
+ * This function finds the position in the index of the @p aIndex th value of @p aKey.
+ *
+ * @returns The position of the value, or -1 if not found.
+ *
+ */
+static int indexFind(uint16_t aKey, int aIndex)
+{
+    int position = -1;
+
+    VerifyOrExit(aIndex >= 0);
+
+    for (size_t i = 0; i < sNumEntries; i++)
+    {
+        if (sEntries[i].mKey == aKey && aIndex-- == 0)
         {
-            mkdir(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, 0755);
+            position = static_cast<int>(i);
+            break;
         }
     }
 
+exit:
+    return position;
+}
+
+static void indexAdd(uint16_t aKey, const uint8_t *aValue, uint16_t aLength)
+{
+    SettingsEntry *entry;
+
+    if (sNumEntries == sMaxEntries)
     {
-        char fileName[kMaxFileNameSize];
+        size_t         maxEntries = (sMaxEntries == 0 ? 16 : sMaxEntries * 2);
+        SettingsEntry *entries    = static_cast<SettingsEntry *>(realloc(sEntries, maxEntries * sizeof(*entries)));
 
-        getSettingsFileName(fileName, false);
-        sSettingsFd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        VerifyOrDie(entries != NULL, OT_EXIT_FAILURE);
+        sEntries    = entries;
+        sMaxEntries = maxEntries;
     }
 
-    VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
+    entry          = &sEntries[sNumEntries++];
+    entry->mKey    = aKey;
+    entry->mLength = aLength;
+    entry->mValue  = static_cast<uint8_t *>(malloc(aLength > 0 ? aLength : 1));
+    VerifyOrDie(entry->mValue != NULL, OT_EXIT_FAILURE);
+    memcpy(entry->mValue, aValue, aLength);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    sLiveSize += sizeof(LogRecord) + aLength;
+}
+
+static void indexRemove(size_t aPosition)
+{
+    sLiveSize -= sizeof(LogRecord) + sEntries[aPosition].mLength;
+    free(sEntries[aPosition].mValue);
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    sNumEntries--;
+    memmove(&sEntries[aPosition], &sEntries[aPosition + 1], (sNumEntries - aPosition) * sizeof(*sEntries));
+}
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+/**
+ * This function removes values of @p aKey from the index.
+ *
+ * @param[in]  aKey    The key associated with the values.
+ * @param[in]  aIndex  The index of the value to be removed. If set to -1, all values of @p aKey are removed.
+ *
+ * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
+ * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the index.
+ *
+ */
+static otError indexDelete(uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NOT_FOUND;
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+    if (aIndex != -1)
+    {
+        int position = indexFind(aKey, aIndex);
+
+        VerifyOrExit(position >= 0);
+        indexRemove(static_cast<size_t>(position));
+        ExitNow(error = OT_ERROR_NONE);
+    }
+
+    for (size_t i = 0; i < sNumEntries;)
+    {
+        if (sEntries[i].mKey == aKey)
+        {
+            indexRemove(i);
+            error = OT_ERROR_NONE;
+        }
+        else
+        {
+            i++;
+        }
     }
 
 exit:
-    if (error == OT_ERROR_PARSE)
+    return error;
+}
+
+static void indexClear(void)
+{
+    for (size_t i = 0; i < sNumEntries; i++)
     {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
+        free(sEntries[i].mValue);
     }
+
+    sNumEntries = 0;
+    sLiveSize   = sizeof(kLogMagic);
 }
 
-void otPlatSettingsDeinit(otInstance *aInstance)
+static void logWrite(int aFd, uint8_t aOperation, uint16_t aKey, const void *aPayload, uint16_t aLength)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    LogRecord    record;
+    struct iovec iov[2];
+
+    record.mKey       = aKey;
+    record.mLength    = aLength;
+    record.mOperation = aOperation;
+    record.mReserved  = 0;
+    record.mChecksum  = recordChecksum(record, aPayload);
+
+    iov[0].iov_base = &record;
+    iov[0].iov_len  = sizeof(record);
+    iov[1].iov_base = const_cast<void *>(aPayload);
+    iov[1].iov_len  = aLength;
+
+    // Header and payload go out in a single write, so that a crash never leaves a valid header without its payload.
+    VerifyOrDie(writev(aFd, iov, 2) == static_cast<ssize_t>(sizeof(record) + aLength), OT_EXIT_FAILURE);
+}
 
-    assert(sSettingsFd != -1);
-    VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+static void logSync(void)
+{
+    VerifyOrExit(sPendingSync > 0);
+    VerifyOrDie(0 == fsync(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+    sPendingSync = 0;
+
+exit:
+    return;
 }
 
-otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+static void logAppend(uint8_t aOperation, uint16_t aKey, const void *aPayload, uint16_t aLength)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    logWrite(sSettingsFd, aOperation, aKey, aPayload, aLength);
+    sLogSize += sizeof(LogRecord) + aLength;
+
+    if (++sPendingSync >= OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_BATCH)
+    {
+        logSync();
+    }
+}
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+/**
+ * This function rewrites the log with only the values in the index.
+ *
+ * The compacted log is written to the swap file, synced and then renamed over the data file, so that either the old
+ * or the new log survives a crash.
+ *
+ */
+static void logCompact(void)
+{
+    int swapFd = swapOpen();
 
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    VerifyOrDie(write(swapFd, &kLogMagic, sizeof(kLogMagic)) == sizeof(kLogMagic), OT_EXIT_FAILURE);
 
-    while (offset < size)
+    for (size_t i = 0; i < sNumEntries; i++)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        logWrite(swapFd, kOperationAdd, sEntries[i].mKey, sEntries[i].mValue, sEntries[i].mLength);
+    }
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    swapPersist(swapFd);
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+    sLogSize     = sLiveSize;
+    sPendingSync = 0;
+}
 
-        if (key == aKey)
-        {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
+static void logCompactIfNeeded(void)
+{
+    off_t staleSize = sLogSize - sLiveSize;
 
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
+    if (staleSize >= kCompactMinSize && staleSize >= sLiveSize)
+    {
+        logCompact();
+    }
+}
 
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
+/**
+ * This function rebuilds the index by replaying the log, and truncates any torn or corrupted tail.
+ *
+ */
+static void logReplay(void)
+{
+    off_t    offset  = sizeof(kLogMagic);
+    uint8_t *payload = static_cast<uint8_t *>(malloc(UINT16_MAX));
 
-                    *aValueLength = length;
-                }
+    VerifyOrDie(payload != NULL, OT_EXIT_FAILURE);
 
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+    while (offset < sLogSize)
+    {
+        LogRecord record;
+        int16_t   index;
+
+        VerifyOrExit(readFully(&record, sizeof(record)));
+        VerifyOrExit(readFully(payload, record.mLength));
+        VerifyOrExit(record.mChecksum == recordChecksum(record, payload));
+
+        switch (record.mOperation)
+        {
+        case kOperationAdd:
+            indexAdd(record.mKey, payload, record.mLength);
+            break;
+
+        case kOperationSet:
+            IgnoreReturnValue(indexDelete(record.mKey, -1));
+            indexAdd(record.mKey, payload, record.mLength);
+            break;
+
+        case kOperationDelete:
+            VerifyOrExit(record.mLength == sizeof(index));
+            memcpy(&index, payload, sizeof(index));
+            IgnoreReturnValue(indexDelete(record.mKey, index));
+            break;
+
+        default:
+            ExitNow();
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        offset += sizeof(record) + record.mLength;
     }
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
-    return error;
+    free(payload);
+
+    if (offset < sLogSize)
+    {
+        VerifyOrDie(0 == ftruncate(sSettingsFd, offset), OT_EXIT_ERROR_ERRNO);
+        sLogSize = offset;
+    }
+
+    VerifyOrDie(offset == lseek(sSettingsFd, offset, SEEK_SET), OT_EXIT_ERROR_ERRNO);
 }
 
-otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+/**
+ * This function loads a settings file written by the former non-log format, made of `[key][length][value]` records.
+ *
+ */
+static void legacyLoad(void)
 {
-    int swapFd = -1;
+    uint8_t *payload = static_cast<uint8_t *>(malloc(UINT16_MAX));
 
-    switch (platformSettingsDelete(aInstance, aKey, -1, &swapFd))
-    {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
+    VerifyOrDie(payload != NULL, OT_EXIT_FAILURE);
 
-    default:
-        assert(false);
-        break;
-    }
+    for (off_t offset = 0; offset < sLogSize;)
+    {
+        uint16_t key;
+        uint16_t length;
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
+        VerifyOrExit(readFully(&key, sizeof(key)) && readFully(&length, sizeof(length)));
+        VerifyOrExit(readFully(payload, length));
 
-    swapPersist(swapFd);
+        indexAdd(key, payload, length);
+        offset += sizeof(key) + sizeof(length) + length;
+    }
 
-    return OT_ERROR_NONE;
+exit:
+    free(payload);
 }
 
-otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+void otPlatSettingsInit(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    int   swapFd = swapOpen();
+    uint32_t magic;
 
-    if (size > 0)
     {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        swapWrite(swapFd, static_cast<uint16_t>(size));
+        struct stat st;
+
+        if (stat(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, &st) == -1)
+        {
+            mkdir(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, 0755);
+        }
     }
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
+    {
+        char fileName[kMaxFileNameSize];
 
-    swapPersist(swapFd);
+        getSettingsFileName(fileName, false);
+        sSettingsFd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    }
 
-    return OT_ERROR_NONE;
+    VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
+
+    indexClear();
+    sPendingSync = 0;
+    sLogSize     = lseek(sSettingsFd, 0, SEEK_END);
+    VerifyOrDie(sLogSize != -1 && 0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
+
+    if (sLogSize >= static_cast<off_t>(sizeof(magic)) && readFully(&magic, sizeof(magic)) && magic == kLogMagic)
+    {
+        logReplay();
+    }
+    else
+    {
+        // Empty file or the former format, convert it to a log.
+        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
+        legacyLoad();
+        logCompact();
+    }
 }
 
-otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+void otPlatSettingsDeinit(otInstance *aInstance)
 {
-    return platformSettingsDelete(aInstance, aKey, aIndex, NULL);
+    OT_UNUSED_VARIABLE(aInstance);
+
+    assert(sSettingsFd != -1);
+    logSync();
+    VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSettingsFd = -1;
+
+    indexClear();
+    free(sEntries);
+    sEntries    = NULL;
+    sMaxEntries = 0;
 }
 
-/**
- * This function removes a setting either from swap file or persisted file.
- *
- * @param[in]  aInstance  The OpenThread instance structure.
- * @param[in]  aKey       The key associated with the requested setting.
- * @param[in]  aIndex     The index of the value to be removed. If set to -1, all values for this aKey will be removed.
- * @param[out] aSwapFd    A optional pointer to receive file descriptor of the generated swap file descriptor.
- *
- * @note
- *   If @p aSwapFd is null, operate deleting on the setting file.
- *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
- *
- * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
- * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
- *
- */
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen();
+    otError              error    = OT_ERROR_NONE;
+    int                  position = indexFind(aKey, aIndex);
+    const SettingsEntry *entry;
 
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    VerifyOrExit(position >= 0, error = OT_ERROR_NOT_FOUND);
+    entry = &sEntries[position];
 
-    while (offset < size)
+    if (aValueLength)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        if (aValue)
+        {
+            memcpy(aValue, entry->mValue, (entry->mLength <= *aValueLength ? entry->mLength : *aValueLength));
+        }
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+        *aValueLength = entry->mLength;
+    }
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+exit:
+    return error;
+}
 
-        offset += sizeof(key) + sizeof(length) + length;
+otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
 
-        if (aKey == key)
-        {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
-        }
+    logAppend(kOperationSet, aKey, aValue, aValueLength);
+    IgnoreReturnValue(indexDelete(aKey, -1));
+    indexAdd(aKey, aValue, aValueLength);
+    logCompactIfNeeded();
 
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key), OT_EXIT_FAILURE);
+    return OT_ERROR_NONE;
+}
 
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length), OT_EXIT_FAILURE);
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
 
-        swapWrite(swapFd, length);
-    }
+    logAppend(kOperationAdd, aKey, aValue, aValueLength);
+    indexAdd(aKey, aValue, aValueLength);
 
-exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
+    return OT_ERROR_NONE;
+}
 
-    if (aSwapFd != NULL)
-    {
-        *aSwapFd = swapFd;
-    }
-    else if (error == OT_ERROR_NONE)
-    {
-        swapPersist(swapFd);
-    }
-    else if (error == OT_ERROR_NOT_FOUND)
-    {
-        swapDiscard(swapFd);
-    }
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
+    int16_t index = static_cast<int16_t>(aIndex);
 
+    VerifyOrExit(aIndex >= -1 && aIndex <= INT16_MAX, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(indexFind(aKey, (aIndex == -1 ? 0 : aIndex)) >= 0, error = OT_ERROR_NOT_FOUND);
+
+    logAppend(kOperationDelete, aKey, &index, sizeof(index));
+    IgnoreReturnValue(indexDelete(aKey, aIndex));
+    logCompactIfNeeded();
+
+exit:
     return error;
 }
 
 void otPlatSettingsWipe(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
-    VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+
+    indexClear();
+    logCompact();
 }
 
 #ifndef SELF_TEST
@@ -399,6 +572,42 @@ void otPlatSettingsWipe(otInstance *aInstance)
 
 uint64_t gNodeId = 1;
 
+enum
+{
+    kTestKeys       = 2,
+    kTestIndices    = 3,
+    kTestOperations = 6,
+};
+
+static void getTestState(otInstance *aInstance, uint16_t aState[kTestKeys][kTestIndices])
+{
+    for (uint16_t key = 0; key < kTestKeys; key++)
+    {
+        for (int index = 0; index < kTestIndices; index++)
+        {
+            uint16_t length = 0;
+
+            aState[key][index] = (otPlatSettingsGet(aInstance, key, index, NULL, &length) == OT_ERROR_NONE) ? length
+                                                                                                           : 0xffff;
+        }
+    }
+}
+
+static void writeTestFile(const uint8_t *aBuffer, size_t aLength, size_t aZeroLength)
+{
+    char    fileName[kMaxFileNameSize];
+    uint8_t zeros[64] = {0};
+    int     fd;
+
+    assert(aZeroLength <= sizeof(zeros));
+    getSettingsFileName(fileName, false);
+    fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    assert(fd != -1);
+    assert(write(fd, aBuffer, aLength) == static_cast<ssize_t>(aLength));
+    assert(write(fd, zeros, aZeroLength) == static_cast<ssize_t>(aZeroLength));
+    assert(close(fd) == 0);
+}
+
 int main()
 {
     otInstance *instance = NULL;
@@ -444,7 +653,7 @@ int main()
         // verify length becomes the actual length of the record
         assert(length == sizeof(data) / 2);
         // verify this byte is not changed
-        assert(value[length] == 0);
+        assert(value[length - 1] == 0);
 
         // wrong index
         assert(otPlatSettingsGet(instance, 0, 1, NULL, NULL) == OT_ERROR_NOT_FOUND);
@@ -534,6 +743,160 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, NULL, NULL) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    // verify settings are restored after reinitialization
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, NULL, NULL) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a write torn at any byte rolls back to the state before that write
+    {
+        uint16_t states[kTestOperations + 1][kTestKeys][kTestIndices];
+        off_t    sizes[kTestOperations + 1];
+        uint8_t  log[512];
+
+        getTestState(instance, states[0]);
+        sizes[0] = sLogSize;
+
+        for (int i = 0; i < kTestOperations; i++)
+        {
+            switch (i)
+            {
+            case 0:
+                assert(otPlatSettingsAdd(instance, 0, data, 10) == OT_ERROR_NONE);
+                break;
+            case 1:
+                assert(otPlatSettingsAdd(instance, 0, data, 20) == OT_ERROR_NONE);
+                break;
+            case 2:
+                assert(otPlatSettingsSet(instance, 1, data, 30) == OT_ERROR_NONE);
+                break;
+            case 3:
+                assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+                break;
+            case 4:
+                assert(otPlatSettingsSet(instance, 0, data, 40) == OT_ERROR_NONE);
+                break;
+            case 5:
+                assert(otPlatSettingsDelete(instance, 1, -1) == OT_ERROR_NONE);
+                break;
+            }
+
+            getTestState(instance, states[i + 1]);
+            sizes[i + 1] = sLogSize;
+        }
+
+        assert(sizes[kTestOperations] <= static_cast<off_t>(sizeof(log)));
+        assert(pread(sSettingsFd, log, sizeof(log), 0) == sizes[kTestOperations]);
+        otPlatSettingsDeinit(instance);
+
+        for (off_t length = sizes[0]; length <= sizes[kTestOperations]; length++)
+        {
+            uint16_t state[kTestKeys][kTestIndices];
+            int      operation = 0;
+
+            while (operation < kTestOperations && sizes[operation + 1] <= length)
+            {
+                operation++;
+            }
+
+            writeTestFile(log, static_cast<size_t>(length), 0);
+            otPlatSettingsInit(instance);
+            getTestState(instance, state);
+            assert(0 == memcmp(state, states[operation], sizeof(state)));
+            assert(sLogSize == sizes[operation]);
+            otPlatSettingsDeinit(instance);
+        }
+
+        // zero-filled blocks after the last record
+        writeTestFile(log, static_cast<size_t>(sizes[kTestOperations]), 64);
+        otPlatSettingsInit(instance);
+        {
+            uint16_t state[kTestKeys][kTestIndices];
+
+            getTestState(instance, state);
+            assert(0 == memcmp(state, states[kTestOperations], sizeof(state)));
+            assert(sLogSize == sizes[kTestOperations]);
+            assert(lseek(sSettingsFd, 0, SEEK_END) == sizes[kTestOperations]);
+        }
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the log is compacted
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    for (int i = 0; i < 1000; i++)
+    {
+        assert(otPlatSettingsSet(instance, 0, data, static_cast<uint16_t>(i % sizeof(data))) == OT_ERROR_NONE);
+        assert(sLogSize <= sLiveSize + kCompactMinSize + static_cast<off_t>(sizeof(LogRecord) + sizeof(data)));
+    }
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == 999 % sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, NULL, NULL) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a settings file of the former format is converted to a log
+    otPlatSettingsDeinit(instance);
+    {
+        uint8_t  legacy[2 * (sizeof(uint16_t) + sizeof(uint16_t)) + 6];
+        uint8_t *cur = legacy;
+        uint16_t key = 3;
+        uint16_t length;
+        uint32_t magic;
+
+        length = 4;
+        memcpy(cur, &key, sizeof(key));
+        memcpy(cur + sizeof(key), &length, sizeof(length));
+        memcpy(cur + sizeof(key) + sizeof(length), data, length);
+        cur += sizeof(key) + sizeof(length) + length;
+
+        length = 2;
+        memcpy(cur, &key, sizeof(key));
+        memcpy(cur + sizeof(key), &length, sizeof(length));
+        memcpy(cur + sizeof(key) + sizeof(length), data, length);
+
+        writeTestFile(legacy, sizeof(legacy), 0);
+        otPlatSettingsInit(instance);
+
+        length = 0;
+        assert(otPlatSettingsGet(instance, 3, 0, NULL, &length) == OT_ERROR_NONE);
+        assert(length == 4);
+        assert(otPlatSettingsGet(instance, 3, 1, NULL, &length) == OT_ERROR_NONE);
+        assert(length == 2);
+        assert(pread(sSettingsFd, &magic, sizeof(magic), 0) == sizeof(magic));
+        assert(magic == kLogMagic);
+    }
+    otPlatSettingsWipe(instance);
     otPlatSettingsDeinit(instance);
 
     return 0;
@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+
+static ot::Instance *sInstance;
+
+enum
+{
+    kCacheEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES,
+    kNumEids      = 4 * kCacheEntries, // Enough EIDs to get hash collisions and long probe sequences.
+    kNumRouters   = 4,
+};
+
+static Ip6::Address GetEid(uint16_t aIndex)
+{
+    Ip6::Address eid;
+
+    memset(&eid, 0, sizeof(eid));
+    eid.mFields.m8[0]  = 0xfd;
+    eid.mFields.m8[14] = static_cast<uint8_t>(aIndex >> 8);
+    eid.mFields.m8[15] = static_cast<uint8_t>(aIndex & 0xff);
+
+    return eid;
+}
+
+static uint16_t GetRloc16(uint16_t aIndex)
+{
+    // Spread the entries over `kNumRouters` routers (Router ID in the top 6 bits of the RLOC16), keeping the child
+    // IDs of each router distinct so that every EID gets its own RLOC16.
+    return static_cast<uint16_t>(((aIndex % kNumRouters) << 10) | (aIndex / kNumRouters + 1));
+}
+
+static bool IsCached(AddressResolver &aResolver, uint16_t aIndex)
+{
+    // Updating an entry with its current RLOC16 is a pure lookup.
+    return aResolver.UpdateCacheEntry(GetEid(aIndex), GetRloc16(aIndex)) == OT_ERROR_NONE;
+}
+
+static void VerifyCache(AddressResolver &aResolver, const bool *aCached)
+{
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        VerifyOrQuit(IsCached(aResolver, i) == aCached[i], "cache lookup does not match the expected content");
+    }
+}
+
+void TestAddressResolverLookup(void)
+{
+    AddressResolver *resolver;
+    uint16_t         rloc16;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    resolver = &sInstance->Get<AddressResolver>();
+
+    printf("TestAddressResolverLookup");
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        SuccessOrQuit(resolver->AddCacheEntry(GetEid(i), GetRloc16(i)), "AddCacheEntry() failed");
+    }
+
+    resolver->ResetCounters();
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        rloc16 = Mac::kShortAddrInvalid;
+        SuccessOrQuit(resolver->Resolve(GetEid(i), rloc16), "Resolve() failed for a cached EID");
+        VerifyOrQuit(rloc16 == GetRloc16(i), "Resolve() returned wrong RLOC16");
+    }
+
+    VerifyOrQuit(resolver->GetCounters().mHits == kCacheEntries, "hit counter is wrong");
+    VerifyOrQuit(resolver->GetCounters().mMisses == 0, "miss counter is wrong");
+
+    for (uint16_t i = kCacheEntries; i < kNumEids; i++)
+    {
+        VerifyOrQuit(!IsCached(*resolver, i), "found an EID which was never added");
+    }
+
+    SuccessOrQuit(resolver->UpdateCacheEntry(GetEid(0), 0x1234), "UpdateCacheEntry() failed");
+    SuccessOrQuit(resolver->Resolve(GetEid(0), rloc16), "Resolve() failed after UpdateCacheEntry()");
+    VerifyOrQuit(rloc16 == 0x1234, "Resolve() did not return the updated RLOC16");
+
+    resolver->Clear();
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        VerifyOrQuit(!IsCached(*resolver, i), "found an EID after Clear()");
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestAddressResolverEviction(void)
+{
+    AddressResolver *resolver;
+    otEidCacheEntry  entry;
+    uint16_t         rloc16;
+    bool             foundNewest = false;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    resolver = &sInstance->Get<AddressResolver>();
+
+    printf("TestAddressResolverEviction");
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        SuccessOrQuit(resolver->AddCacheEntry(GetEid(i), GetRloc16(i)), "AddCacheEntry() failed");
+    }
+
+    VerifyOrQuit(resolver->GetCounters().mEvictions == 0, "evicted an entry while the cache was not full");
+
+    // Using the oldest entry moves it to the front, so the next oldest one is evicted instead.
+    SuccessOrQuit(resolver->Resolve(GetEid(0), rloc16), "Resolve() failed for a cached EID");
+    SuccessOrQuit(resolver->AddCacheEntry(GetEid(kCacheEntries), GetRloc16(kCacheEntries)), "AddCacheEntry() failed");
+
+    VerifyOrQuit(resolver->GetCounters().mEvictions == 1, "eviction counter is wrong");
+    VerifyOrQuit(IsCached(*resolver, 0), "evicted the most recently used entry");
+    VerifyOrQuit(!IsCached(*resolver, 1), "did not evict the least recently used entry");
+    VerifyOrQuit(IsCached(*resolver, kCacheEntries), "new entry is not cached");
+
+    for (uint16_t i = 2; i < kCacheEntries; i++)
+    {
+        VerifyOrQuit(IsCached(*resolver, i), "evicted an entry which was not the least recently used");
+    }
+
+    for (uint16_t index = 0; index < kCacheEntries; index++)
+    {
+        SuccessOrQuit(resolver->GetEntry(index, entry), "GetEntry() failed");
+
+        if (entry.mAge == 0)
+        {
+            VerifyOrQuit(static_cast<Ip6::Address &>(entry.mTarget) == GetEid(kCacheEntries),
+                         "newest entry is not at the front of the LRU list");
+            VerifyOrQuit(entry.mValid, "newest entry is not valid");
+            foundNewest = true;
+        }
+    }
+
+    VerifyOrQuit(foundNewest, "no entry with age zero");
+
+    // A removed entry is reused before any valid entry is evicted.
+    resolver->Remove(GetEid(kCacheEntries - 1));
+    SuccessOrQuit(resolver->AddCacheEntry(GetEid(kCacheEntries + 1), GetRloc16(kCacheEntries + 1)),
+                  "AddCacheEntry() failed");
+    VerifyOrQuit(resolver->GetCounters().mEvictions == 1, "evicted a valid entry while an invalid one was free");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestAddressResolverRemove(void)
+{
+    AddressResolver *resolver;
+    bool             cached[kNumEids];
+    uint16_t         numCached = 0;
+    uint32_t         random    = 1;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    resolver = &sInstance->Get<AddressResolver>();
+
+    printf("TestAddressResolverRemove");
+
+    memset(cached, 0, sizeof(cached));
+
+    // Randomly add and remove EIDs without ever evicting, checking after every step that deleting
+    // from the middle of a probe sequence keeps all remaining entries reachable.
+    for (uint16_t step = 0; step < 2000; step++)
+    {
+        uint16_t index;
+
+        random = random * 1103515245u + 12345u;
+        index  = static_cast<uint16_t>((random >> 16) % kNumEids);
+
+        if (cached[index])
+        {
+            resolver->Remove(GetEid(index));
+            cached[index] = false;
+            numCached--;
+        }
+        else if (numCached < kCacheEntries)
+        {
+            SuccessOrQuit(resolver->AddCacheEntry(GetEid(index), GetRloc16(index)), "AddCacheEntry() failed");
+            cached[index] = true;
+            numCached++;
+        }
+
+        VerifyCache(*resolver, cached);
+    }
+
+    VerifyOrQuit(resolver->GetCounters().mEvictions == 0, "evicted an entry while the cache was not full");
+
+    // Removing by Router ID and by RLOC16 deletes several entries at once.
+    resolver->Remove(static_cast<uint8_t>(1));
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        if (i % kNumRouters == 1)
+        {
+            cached[i] = false;
+        }
+    }
+
+    VerifyCache(*resolver, cached);
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        if (cached[i])
+        {
+            resolver->Remove(GetRloc16(i));
+            cached[i] = false;
+            VerifyCache(*resolver, cached);
+        }
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestAddressResolverLookup();
+    ot::TestAddressResolverEviction();
+    ot::TestAddressResolverRemove();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
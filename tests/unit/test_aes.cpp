@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sys/time.h>
+
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
@@ -133,10 +135,137 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed\n");
 }
 
+/**
+ * Verifies that a reused key schedule gives the same result as setting the key for each frame.
+ */
+void TestMacCommandFrameKeySchedule(void)
+{
+    uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    uint8_t encrypted[] = {
+        0x2B, 0xDC, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC,
+        0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC, 0x06, 0x05, 0x00,
+        0x00, 0x00, 0x01, 0xD8, 0x4F, 0xDE, 0x52, 0x90, 0x61, 0xF9, 0xC6, 0xF1,
+    };
+
+    uint8_t nonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    uint32_t           headerLength = 29, payloadLength = 1;
+    uint8_t            tagLength;
+    uint8_t            test[sizeof(encrypted)];
+    ot::Crypto::AesEcb keySchedule;
+
+    keySchedule.SetKey(key, 8 * sizeof(key));
+
+    // Each frame uses its own `AesCcm` object, as the MAC and MLE layers do.
+    for (int i = 0; i < 3; i++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+
+        memcpy(test, encrypted, sizeof(test));
+        test[headerLength] = 0xCE;
+        tagLength          = 8;
+
+        aesCcm.SetKey(keySchedule);
+        aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(test, headerLength);
+        aesCcm.Payload(test + headerLength, test + headerLength, payloadLength, true);
+        aesCcm.Finalize(test + headerLength + payloadLength, &tagLength);
+
+        VerifyOrQuit(memcmp(test, encrypted, sizeof(encrypted)) == 0, "TestMacCommandFrameKeySchedule failed\n");
+    }
+}
+
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+static void BenchmarkEncryptFrame(ot::Crypto::AesEcb *aKeySchedule, const uint8_t *aKey, uint8_t *aFrame)
+{
+    const uint32_t kHeaderLength  = 23;
+    const uint32_t kPayloadLength = 96;
+    const uint8_t  kNonce[]       = {0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05};
+
+    ot::Crypto::AesCcm aesCcm;
+    uint8_t            tagLength = 4;
+
+    if (aKeySchedule != NULL)
+    {
+        aesCcm.SetKey(*aKeySchedule);
+    }
+    else
+    {
+        aesCcm.SetKey(aKey, 16);
+    }
+
+    aesCcm.Init(kHeaderLength, kPayloadLength, tagLength, kNonce, sizeof(kNonce));
+    aesCcm.Header(aFrame, kHeaderLength);
+    aesCcm.Payload(aFrame + kHeaderLength, aFrame + kHeaderLength, kPayloadLength, true);
+    aesCcm.Finalize(aFrame + kHeaderLength + kPayloadLength, &tagLength);
+}
+
+/**
+ * Measure AES-CCM throughput for MAC data frames, expanding the key for each frame versus reusing a key schedule.
+ */
+void TestAesCcmBenchmark(void)
+{
+    const uint32_t kNumFrames = 50000;
+
+    uint8_t            key[16];
+    uint8_t            frame[127];
+    uint8_t            expected[sizeof(frame)];
+    ot::Crypto::AesEcb keySchedule;
+    struct timeval     start;
+    uint32_t           perFrameKeyUsec;
+    uint32_t           keyScheduleUsec;
+
+    for (unsigned i = 0; i < sizeof(key); i++)
+    {
+        key[i] = static_cast<uint8_t>(0xc0 + i);
+    }
+
+    memset(frame, 0x5a, sizeof(frame));
+    memcpy(expected, frame, sizeof(expected));
+    keySchedule.SetKey(key, 8 * sizeof(key));
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kNumFrames; n++)
+    {
+        BenchmarkEncryptFrame(NULL, key, frame);
+    }
+
+    perFrameKeyUsec = BenchmarkElapsedUsec(start);
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kNumFrames; n++)
+    {
+        BenchmarkEncryptFrame(&keySchedule, key, expected);
+    }
+
+    keyScheduleUsec = BenchmarkElapsedUsec(start);
+
+    VerifyOrQuit(memcmp(frame, expected, sizeof(frame)) == 0, "TestAesCcmBenchmark: results differ\n");
+    printf("TestAesCcmBenchmark(): key set per frame %u frames/s, key schedule reused %u frames/s\n",
+           static_cast<unsigned int>((static_cast<uint64_t>(kNumFrames) * 1000000) / (perFrameKeyUsec + 1)),
+           static_cast<unsigned int>((static_cast<uint64_t>(kNumFrames) * 1000000) / (keyScheduleUsec + 1)));
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestMacCommandFrameKeySchedule();
+    TestAesCcmBenchmark();
     printf("All tests passed\n");
     return 0;
 }
@@ -28,12 +28,16 @@
 
 #include "test_platform.h"
 
+#include <sys/time.h>
+
 #include <openthread/config.h>
 
 #include "test_util.h"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/settings.hpp"
 #include "thread/child_table.hpp"
+#include "thread/mle_router.hpp"
 
 namespace ot {
 
@@ -340,8 +344,8 @@ void TestChildTable(void)
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
         child->SetState(testChildList[i].mState);
-        child->SetRloc16(testChildList[i].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress)));
+        table->SetChildRloc16(*child, testChildList[i].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress));
 
         VerifyChildTableContent(*table, i + 1, testChildList);
     }
@@ -362,12 +366,40 @@ void TestChildTable(void)
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
         child->SetState(testChildList[i - 1].mState);
-        child->SetRloc16(testChildList[i - 1].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress)));
+        table->SetChildRloc16(*child, testChildList[i - 1].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress));
 
         VerifyChildTableContent(*table, testListLength - i + 1, &testChildList[i - 1]);
     }
 
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test SetChildRloc16/SetChildExtAddress");
+
+    {
+        Child *         child = table->FindChild(testChildList[0].mRloc16, Child::kInStateAnyExceptInvalid);
+        Mac::ExtAddress extAddress;
+
+        VerifyOrQuit(child != NULL, "FindChild(rloc) failed");
+
+        extAddress = child->GetExtAddress();
+        extAddress.m8[0] ^= 0xff;
+
+        table->SetChildRloc16(*child, 0x8101);
+        table->SetChildExtAddress(*child, extAddress);
+
+        VerifyOrQuit(table->FindChild(0x8101, Child::kInStateAnyExceptInvalid) == child,
+                     "FindChild(rloc) failed after SetChildRloc16()");
+        VerifyOrQuit(table->FindChild(extAddress, Child::kInStateAnyExceptInvalid) == child,
+                     "FindChild(ExtAddress) failed after SetChildExtAddress()");
+        VerifyOrQuit(table->FindChild(testChildList[0].mRloc16, Child::kInStateAnyExceptInvalid) == NULL,
+                     "FindChild(rloc) found child by its old RLOC16");
+        VerifyOrQuit(table->FindChild(static_cast<const Mac::ExtAddress &>(testChildList[0].mExtAddress),
+                                      Child::kInStateAnyExceptInvalid) == NULL,
+                     "FindChild(ExtAddress) found child by its old extended address");
+    }
+
+    printf(" -- PASS\n");
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     printf("Test Get/SetMaxChildrenAllowed");
 
@@ -397,6 +429,236 @@ void TestChildTable(void)
 
     printf(" -- PASS\n");
 
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test index after Clear");
+
+    table->Clear();
+
+    {
+        Child *child = table->GetNewChild();
+
+        VerifyOrQuit(child != NULL, "GetNewChild() failed");
+        child->SetState(Child::kStateValid);
+
+        // A cleared entry is indexed by its cleared (all zero) addresses.
+        VerifyOrQuit(table->FindChild(0, Child::kInStateValid) == child, "FindChild(rloc) failed after Clear()");
+        VerifyOrQuit(table->FindChild(child->GetExtAddress(), Child::kInStateValid) == child,
+                     "FindChild(ExtAddress) failed after Clear()");
+
+        for (uint16_t i = 0; i < testListLength; i++)
+        {
+            VerifyOrQuit(table->FindChild(testChildList[i].mRloc16, Child::kInStateAnyExceptInvalid) == NULL,
+                         "FindChild(rloc) found a child after Clear()");
+        }
+
+        child->SetState(Child::kStateInvalid);
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+static const Settings::ChildInfo *sStoredChildren;
+static uint16_t                   sNumStoredChildren;
+
+static otError HandleSettingsGet(otInstance *aInstance,
+                                 uint16_t    aKey,
+                                 int         aIndex,
+                                 uint8_t *   aValue,
+                                 uint16_t *  aValueLength)
+{
+    otError  error  = OT_ERROR_NOT_FOUND;
+    uint16_t length = sizeof(Settings::ChildInfo);
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    VerifyOrExit(aKey == Settings::kKeyChildInfo && aIndex >= 0 && aIndex < sNumStoredChildren);
+
+    if (aValue != NULL)
+    {
+        memcpy(aValue, &sStoredChildren[aIndex], (length < *aValueLength) ? length : *aValueLength);
+    }
+
+    *aValueLength = length;
+    error         = OT_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+void TestChildTableRestore(void)
+{
+    Settings::ChildInfo storedChildren[4];
+    ChildTable *        table;
+    Child *             child;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("Test index after RestoreChildren");
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(storedChildren); i++)
+    {
+        storedChildren[i].Clear();
+        storedChildren[i].mExtAddress.m8[0] = 0x12;
+        storedChildren[i].mExtAddress.m8[7] = static_cast<uint8_t>(i);
+        storedChildren[i].mRloc16           = 0x0401 + i;
+        storedChildren[i].mTimeout          = 240;
+    }
+
+    // The last entry duplicates the extended address of the first one with another RLOC16, so the restore
+    // overwrites the first child and it must only be found by its new RLOC16.
+    storedChildren[3].mExtAddress = storedChildren[0].mExtAddress;
+    storedChildren[3].mRloc16     = 0x0410;
+
+    sStoredChildren       = storedChildren;
+    sNumStoredChildren    = OT_ARRAY_LENGTH(storedChildren);
+    g_testPlatSettingsGet = HandleSettingsGet;
+
+    sInstance->Get<Mle::MleRouter>().RestoreChildren();
+
+    g_testPlatSettingsGet = NULL;
+
+    VerifyOrQuit(table->GetNumChildren(Child::kInStateValidOrRestoring) == 3, "RestoreChildren() failed");
+
+    for (uint16_t i = 1; i < 4; i++)
+    {
+        child = table->FindChild(storedChildren[i].mRloc16, Child::kInStateValidOrRestoring);
+        VerifyOrQuit(child != NULL, "FindChild(rloc) failed after RestoreChildren()");
+        VerifyOrQuit(child->GetExtAddress() == storedChildren[i].mExtAddress, "FindChild(rloc) found wrong child");
+        VerifyOrQuit(table->FindChild(storedChildren[i].mExtAddress, Child::kInStateValidOrRestoring) == child,
+                     "FindChild(ExtAddress) failed after RestoreChildren()");
+    }
+
+    VerifyOrQuit(table->FindChild(storedChildren[0].mRloc16, Child::kInStateAnyExceptInvalid) == NULL,
+                 "FindChild(rloc) found restored child by its overwritten RLOC16");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+static uint64_t GetNowUs(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+}
+
+// Reference for the benchmark: the linear scan `FindChild()` used before the table was indexed.
+static Child *FindChildLinear(ChildTable &aTable, uint16_t aRloc16, Child::StateFilter aFilter)
+{
+    Child *child = NULL;
+
+    for (uint16_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *entry = aTable.GetChildAtIndex(index);
+
+        if (entry->MatchesFilter(aFilter) && (entry->GetRloc16() == aRloc16))
+        {
+            ExitNow(child = entry);
+        }
+    }
+
+exit:
+    return child;
+}
+
+// Doubles the number of children for each benchmark run, ending with a full table.
+static uint16_t NextBenchmarkSize(uint16_t aNumChildren)
+{
+    uint16_t next = 0;
+
+    if (aNumChildren < kMaxChildren)
+    {
+        next = (2 * aNumChildren < kMaxChildren) ? 2 * aNumChildren : kMaxChildren;
+    }
+
+    return next;
+}
+
+void TestChildTableLookupBenchmark(void)
+{
+    enum
+    {
+        kNumLookups = 200000,
+    };
+
+    ChildTable *table;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    // Every received frame looks up its source with `FindChild()`, mostly for a child which is in the table.
+    printf("Benchmark FindChild() per-frame lookup cost (ns per lookup)\n");
+    printf("  children |   rloc16 | ext addr |   linear\n");
+
+    for (uint16_t numChildren = 1; numChildren != 0; numChildren = NextBenchmarkSize(numChildren))
+    {
+        uint64_t        start;
+        uint64_t        rlocTime;
+        uint64_t        extTime;
+        uint64_t        linearTime;
+        uint32_t        found = 0;
+        Mac::ExtAddress extAddress;
+
+        table->Clear();
+        memset(&extAddress, 0, sizeof(extAddress));
+        extAddress.m8[0] = 0x12;
+
+        for (uint16_t i = 0; i < numChildren; i++)
+        {
+            Child *child = table->GetNewChild();
+
+            VerifyOrQuit(child != NULL, "GetNewChild() failed");
+            extAddress.m8[6] = static_cast<uint8_t>(i >> 8);
+            extAddress.m8[7] = static_cast<uint8_t>(i);
+            child->SetState(Child::kStateValid);
+            table->SetChildRloc16(*child, 0x0401 + i);
+            table->SetChildExtAddress(*child, extAddress);
+        }
+
+        start = GetNowUs();
+
+        for (uint32_t n = 0; n < kNumLookups; n++)
+        {
+            found += (table->FindChild(0x0401 + (n % numChildren), Child::kInStateValidOrRestoring) != NULL);
+        }
+
+        rlocTime = GetNowUs() - start;
+        start    = GetNowUs();
+
+        for (uint32_t n = 0; n < kNumLookups; n++)
+        {
+            extAddress.m8[6] = static_cast<uint8_t>((n % numChildren) >> 8);
+            extAddress.m8[7] = static_cast<uint8_t>(n % numChildren);
+            found += (table->FindChild(extAddress, Child::kInStateValidOrRestoring) != NULL);
+        }
+
+        extTime = GetNowUs() - start;
+        start   = GetNowUs();
+
+        for (uint32_t n = 0; n < kNumLookups; n++)
+        {
+            found += (FindChildLinear(*table, 0x0401 + (n % numChildren), Child::kInStateValidOrRestoring) != NULL);
+        }
+
+        linearTime = GetNowUs() - start;
+
+        VerifyOrQuit(found == 3 * kNumLookups, "FindChild() failed in benchmark");
+
+        printf("  %8u | %8u | %8u | %8u\n", numChildren, static_cast<unsigned int>(rlocTime * 1000 / kNumLookups),
+               static_cast<unsigned int>(extTime * 1000 / kNumLookups),
+               static_cast<unsigned int>(linearTime * 1000 / kNumLookups));
+    }
+
     testFreeInstance(sInstance);
 }
 
@@ -405,6 +667,8 @@ void TestChildTable(void)
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableRestore();
+    ot::TestChildTableLookupBenchmark();
     printf("\nAll tests passed.\n");
     return 0;
 }
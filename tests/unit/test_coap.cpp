@@ -0,0 +1,1041 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "coap/coap.hpp"
+#include "common/instance.hpp"
+#include "thread/thread_uri_paths.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kIndexSize   = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE,
+    kNumRequests = kIndexSize + 4,
+    kPeerPort    = 5683,
+};
+
+// A CoAP agent recording the messages it sends instead of passing them to UDP.
+class TestCoap : public Coap::CoapBase
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : Coap::CoapBase(aInstance, &TestCoap::Send)
+        , mNumSent(0)
+        , mLastType(OT_COAP_TYPE_CONFIRMABLE)
+        , mLastMessageId(0)
+        , mLastTokenLength(0)
+        , mLastObserve(0)
+        , mLastMessage(NULL)
+        , mKeepLastMessage(false)
+    {
+        memset(mLastToken, 0, sizeof(mLastToken));
+    }
+
+    // Provide the `protected` `Receive()` as `public` so that responses can be injected.
+    void Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        Coap::CoapBase::Receive(aMessage, aMessageInfo);
+    }
+
+    uint16_t GetNumPendingRequests(void) const
+    {
+        uint16_t messageCount;
+        uint16_t bufferCount;
+
+        GetRequestMessages().GetInfo(messageCount, bufferCount);
+
+        return messageCount;
+    }
+
+    uint16_t            mNumSent;
+    Coap::Message::Type mLastType;
+    uint16_t            mLastMessageId;
+    uint8_t             mLastToken[OT_COAP_MAX_TOKEN_LENGTH];
+    uint8_t             mLastTokenLength;
+    uint32_t            mLastObserve;
+    Ip6::Address        mLastPeer;
+    Ip6::Address        mFailingPeer;
+    Coap::Message *     mLastMessage;
+    bool                mKeepLastMessage;
+
+private:
+    static otError Send(Coap::CoapBase &aCoapBase, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        return static_cast<TestCoap &>(aCoapBase).Send(static_cast<Coap::Message &>(aMessage), aMessageInfo);
+    }
+
+    otError Send(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        if (aMessageInfo.GetPeerAddr() == mFailingPeer)
+        {
+            return OT_ERROR_NO_BUFS;
+        }
+
+        mNumSent++;
+        mLastType        = aMessage.GetType();
+        mLastMessageId   = aMessage.GetMessageId();
+        mLastTokenLength = aMessage.GetTokenLength();
+        memcpy(mLastToken, aMessage.GetToken(), mLastTokenLength);
+        mLastPeer = aMessageInfo.GetPeerAddr();
+
+        if (aMessage.ReadUintOption(OT_COAP_OPTION_OBSERVE, mLastObserve) != OT_ERROR_NONE)
+        {
+            mLastObserve = 0;
+        }
+
+        if (mKeepLastMessage)
+        {
+            VerifyOrQuit(mLastMessage == NULL, "previous message was not delivered");
+            mLastMessage = &aMessage;
+        }
+        else
+        {
+            aMessage.Free();
+        }
+
+        return OT_ERROR_NONE;
+    }
+};
+
+static uint32_t sNow;
+
+static uint32_t GetNow(void)
+{
+    return sNow;
+}
+
+static void AdvanceTime(Instance &aInstance, uint32_t aDuration)
+{
+    uint32_t end = sNow + aDuration;
+
+    while (g_testPlatAlarmSet && g_testPlatAlarmNext <= end)
+    {
+        sNow = g_testPlatAlarmNext;
+        otPlatAlarmMilliFired(&aInstance);
+    }
+
+    sNow = end;
+}
+
+struct Request
+{
+    uint16_t mMessageId;
+    uint8_t  mToken[OT_COAP_MAX_TOKEN_LENGTH];
+    uint8_t  mTokenLength;
+    bool     mHandled;
+    otError  mResult;
+};
+
+static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aResult)
+{
+    Request *request = static_cast<Request *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(!request->mHandled, "response handler called more than once");
+    request->mHandled = true;
+    request->mResult  = aResult;
+}
+
+static void SendRequest(TestCoap &aCoap, const Ip6::MessageInfo &aMessageInfo, Request &aRequest)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    SuccessOrQuit(message->SetToken(Coap::Message::kDefaultTokenLength), "SetToken() failed");
+    SuccessOrQuit(aCoap.SendMessage(*message, aMessageInfo, HandleResponse, &aRequest), "SendMessage() failed");
+
+    aRequest.mMessageId   = aCoap.mLastMessageId;
+    aRequest.mTokenLength = aCoap.mLastTokenLength;
+    memcpy(aRequest.mToken, aCoap.mLastToken, aRequest.mTokenLength);
+    aRequest.mHandled = false;
+    aRequest.mResult  = OT_ERROR_FAILED;
+}
+
+static void ReceiveResponse(TestCoap &              aCoap,
+                            const Ip6::MessageInfo &aMessageInfo,
+                            Coap::Message::Type     aType,
+                            Coap::Message::Code     aCode,
+                            uint16_t                aMessageId,
+                            const Request &         aRequest)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(aType, aCode);
+    message->SetMessageId(aMessageId);
+
+    if (aCode != OT_COAP_CODE_EMPTY)
+    {
+        SuccessOrQuit(message->SetToken(aRequest.mToken, aRequest.mTokenLength), "SetToken() failed");
+    }
+
+    message->Finish();
+    aCoap.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+void TestCoapPendingRequests(void)
+{
+    Instance *       instance = testInitInstance();
+    TestCoap         coap(*instance);
+    Ip6::MessageInfo messageInfo;
+    Ip6::MessageInfo otherPeer;
+    Request          requests[kNumRequests];
+    Request          unknown;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    messageInfo.GetPeerAddr().FromString("fd00::1");
+    messageInfo.SetPeerPort(kPeerPort);
+    otherPeer.GetPeerAddr().FromString("fd00::2");
+    otherPeer.SetPeerPort(kPeerPort);
+
+    // More requests than the index holds are accepted, the overflow is only matched by walking the queue.
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        SendRequest(coap, messageInfo, requests[i]);
+    }
+
+    VerifyOrQuit(coap.mNumSent == kNumRequests, "requests were not sent");
+    VerifyOrQuit(coap.GetNumPendingRequests() == kNumRequests, "requests were not kept pending");
+
+    // An empty ACK matched by Message ID keeps a request with a response handler pending.
+    ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_EMPTY, requests[0].mMessageId,
+                    requests[0]);
+    ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_EMPTY,
+                    requests[kNumRequests - 1].mMessageId, requests[kNumRequests - 1]);
+    VerifyOrQuit(!requests[0].mHandled && !requests[kNumRequests - 1].mHandled, "empty ACK finished a request");
+    VerifyOrQuit(coap.GetNumPendingRequests() == kNumRequests, "empty ACK removed a request");
+
+    // Piggybacked responses are matched by Message ID, for indexed and for overflowed requests.
+    for (uint16_t i = 1; i < kNumRequests; i += 2)
+    {
+        ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED,
+                        requests[i].mMessageId, requests[i]);
+        VerifyOrQuit(requests[i].mHandled && requests[i].mResult == OT_ERROR_NONE, "piggybacked response failed");
+    }
+
+    VerifyOrQuit(coap.GetNumPendingRequests() == kNumRequests / 2, "responses did not remove requests");
+
+    // A response from another peer does not match.
+    ReceiveResponse(coap, otherPeer, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_CHANGED, 0, requests[0]);
+    VerifyOrQuit(!requests[0].mHandled, "response from another peer matched");
+    VerifyOrQuit(coap.mLastType == OT_COAP_TYPE_RESET, "response from another peer was not reset");
+
+    // Separate responses are matched by token.
+    for (uint16_t i = 0; i < kNumRequests; i += 2)
+    {
+        ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_CHANGED,
+                        static_cast<uint16_t>(requests[i].mMessageId + 0x8000), requests[i]);
+        VerifyOrQuit(requests[i].mHandled && requests[i].mResult == OT_ERROR_NONE, "separate response failed");
+    }
+
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "requests were not removed");
+
+    // A response relating to no request is reset.
+    unknown = requests[0];
+    ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_CHANGED, 0x1234, unknown);
+    VerifyOrQuit(coap.mLastType == OT_COAP_TYPE_RESET && coap.mLastMessageId == 0x1234,
+                 "unrelated response was not reset");
+
+    // Freed index entries are reused, and overflowed requests are aborted like the others.
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        SendRequest(coap, messageInfo, requests[i]);
+    }
+
+    ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_RESET, OT_COAP_CODE_EMPTY, requests[kNumRequests - 1].mMessageId,
+                    requests[kNumRequests - 1]);
+    VerifyOrQuit(requests[kNumRequests - 1].mHandled && requests[kNumRequests - 1].mResult == OT_ERROR_ABORT,
+                 "reset did not abort the request");
+
+    SuccessOrQuit(coap.AbortTransaction(HandleResponse, &requests[kIndexSize]), "AbortTransaction() failed");
+    VerifyOrQuit(requests[kIndexSize].mResult == OT_ERROR_ABORT, "AbortTransaction() did not call the handler");
+
+    coap.ClearRequestsAndResponses();
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "ClearRequestsAndResponses() failed");
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        VerifyOrQuit(requests[i].mHandled && requests[i].mResult == OT_ERROR_ABORT, "request was not aborted");
+    }
+
+    testFreeInstance(instance);
+}
+
+void TestCoapRetransmissions(void)
+{
+    Instance *       instance = testInitInstance();
+    TestCoap         coap(*instance);
+    Ip6::MessageInfo messageInfo;
+    Request          requests[2];
+    uint16_t         numSent;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+    g_testPlatAlarmGetNow = GetNow;
+
+    messageInfo.GetPeerAddr().FromString("fd00::1");
+    messageInfo.SetPeerPort(kPeerPort);
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(requests); i++)
+    {
+        SendRequest(coap, messageInfo, requests[i]);
+    }
+
+    // An acknowledged request awaits its response without being retransmitted.
+    ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_EMPTY, requests[1].mMessageId,
+                    requests[1]);
+    numSent = coap.mNumSent;
+
+    AdvanceTime(*instance, Time::SecToMsec(Coap::kAckTimeout) - 1);
+    VerifyOrQuit(coap.mNumSent == numSent, "request was retransmitted before its timeout");
+
+    AdvanceTime(*instance, Time::SecToMsec(Coap::kAckTimeout) * Coap::kAckRandomFactorNumerator /
+                               Coap::kAckRandomFactorDenominator);
+    VerifyOrQuit(coap.mNumSent == numSent + 1 && coap.mLastMessageId == requests[0].mMessageId,
+                 "request was not retransmitted");
+
+    AdvanceTime(*instance, 1000000);
+    VerifyOrQuit(coap.mNumSent == numSent + Coap::kMaxRetransmit, "wrong number of retransmissions");
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(requests); i++)
+    {
+        VerifyOrQuit(requests[i].mHandled && requests[i].mResult == OT_ERROR_RESPONSE_TIMEOUT,
+                     "request did not time out");
+    }
+
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "requests are still pending");
+
+    // Aborting finds the request by its response handler and context.
+    SendRequest(coap, messageInfo, requests[0]);
+    SendRequest(coap, messageInfo, requests[1]);
+    SuccessOrQuit(coap.AbortTransaction(HandleResponse, &requests[1]), "AbortTransaction() failed");
+    VerifyOrQuit(requests[1].mHandled && requests[1].mResult == OT_ERROR_ABORT, "request was not aborted");
+    VerifyOrQuit(!requests[0].mHandled, "wrong request was aborted");
+    VerifyOrQuit(coap.AbortTransaction(HandleResponse, &requests[1]) == OT_ERROR_NOT_FOUND,
+                 "request was aborted twice");
+
+    coap.ClearRequestsAndResponses();
+    testFreeInstance(instance);
+}
+
+static void HandleResourceRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    (*static_cast<uint16_t *>(aContext))++;
+}
+
+static void ReceiveRequest(TestCoap &aCoap, const Ip6::MessageInfo &aMessageInfo, const char *aUriPath)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST);
+    SuccessOrQuit(message->AppendUriPathOptions(aUriPath), "AppendUriPathOptions() failed");
+    message->Finish();
+    aCoap.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+void TestCoapResources(void)
+{
+    static const char *const kUriPaths[] = {
+        OT_URI_PATH_RELAY_RX, // Dispatched through the well-known URI path table.
+        "app/rx",             // Dispatched through the resource list.
+    };
+
+    Instance *       instance = testInitInstance();
+    TestCoap         coap(*instance);
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    messageInfo.GetPeerAddr().FromString("fd00::1");
+    messageInfo.SetPeerPort(kPeerPort);
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        uint16_t       numRequests[3] = {0, 0, 0};
+        Coap::Resource first(kUriPaths[i], HandleResourceRequest, &numRequests[0]);
+        Coap::Resource second(kUriPaths[i], HandleResourceRequest, &numRequests[1]);
+        Coap::Resource third(kUriPaths[i], HandleResourceRequest, &numRequests[2]);
+
+        // The latest resource added for a URI path handles its requests.
+        SuccessOrQuit(coap.AddResource(first), "AddResource() failed");
+        SuccessOrQuit(coap.AddResource(second), "AddResource() failed");
+        VerifyOrQuit(coap.AddResource(first) == OT_ERROR_ALREADY, "resource was added twice");
+        VerifyOrQuit(coap.AddResource(second) == OT_ERROR_ALREADY, "resource was added twice");
+        SuccessOrQuit(coap.AddResource(third), "AddResource() failed");
+
+        ReceiveRequest(coap, messageInfo, kUriPaths[i]);
+        VerifyOrQuit(numRequests[0] == 0 && numRequests[1] == 0 && numRequests[2] == 1, "wrong resource handled");
+
+        // Removing a resource which does not handle requests does not change dispatching.
+        coap.RemoveResource(second);
+        ReceiveRequest(coap, messageInfo, kUriPaths[i]);
+        VerifyOrQuit(numRequests[0] == 0 && numRequests[1] == 0 && numRequests[2] == 2, "wrong resource handled");
+
+        // Removing the latest resource hands the URI path back to the one added before it.
+        SuccessOrQuit(coap.AddResource(second), "AddResource() failed");
+        coap.RemoveResource(third);
+        ReceiveRequest(coap, messageInfo, kUriPaths[i]);
+        VerifyOrQuit(numRequests[0] == 0 && numRequests[1] == 1 && numRequests[2] == 2, "wrong resource handled");
+
+        coap.RemoveResource(second);
+        ReceiveRequest(coap, messageInfo, kUriPaths[i]);
+        VerifyOrQuit(numRequests[0] == 1 && numRequests[1] == 1 && numRequests[2] == 2, "wrong resource handled");
+
+        coap.RemoveResource(first);
+        ReceiveRequest(coap, messageInfo, kUriPaths[i]);
+        VerifyOrQuit(numRequests[0] == 1 && numRequests[1] == 1 && numRequests[2] == 2, "removed resource handled");
+    }
+
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+enum
+{
+    kPayloadLength = 300, // Not a multiple of the block sizes, so the last block is shorter.
+    kMaxExchanges  = 32,
+};
+
+static uint8_t sPayload[kPayloadLength];
+
+struct Transfer
+{
+    TestCoap *      mServer;
+    otCoapBlockSize mBlockSize;
+    uint32_t        mFailPosition;
+    uint16_t        mNumBlocks;
+    uint16_t        mLastBlockLength;
+    uint8_t         mReceived[kPayloadLength];
+    uint16_t        mReceivedLength;
+    bool            mHandled;
+    otError         mResult;
+};
+
+static void InitTransfer(Transfer &aTransfer, TestCoap *aServer, otCoapBlockSize aBlockSize)
+{
+    memset(&aTransfer, 0, sizeof(aTransfer));
+    aTransfer.mServer       = aServer;
+    aTransfer.mBlockSize    = aBlockSize;
+    aTransfer.mFailPosition = kPayloadLength;
+    aTransfer.mResult       = OT_ERROR_FAILED;
+}
+
+static otError TransmitBlock(void *     aContext,
+                             otMessage *aMessage,
+                             uint32_t   aPosition,
+                             uint16_t   aBlockLength,
+                             bool *     aMore)
+{
+    Transfer *transfer = static_cast<Transfer *>(aContext);
+    uint16_t  length   = kPayloadLength - static_cast<uint16_t>(aPosition);
+
+    VerifyOrQuit(aPosition < kPayloadLength, "block requested beyond the payload");
+
+    if (aPosition >= transfer->mFailPosition)
+    {
+        return OT_ERROR_FAILED;
+    }
+
+    if (length > aBlockLength)
+    {
+        length = aBlockLength;
+    }
+
+    SuccessOrQuit(static_cast<ot::Message *>(aMessage)->Append(&sPayload[aPosition], length), "Append() failed");
+    *aMore = (aPosition + length < kPayloadLength);
+
+    transfer->mNumBlocks++;
+    transfer->mLastBlockLength = aBlockLength;
+
+    return OT_ERROR_NONE;
+}
+
+static otError ReceiveBlock(void *           aContext,
+                            const otMessage *aMessage,
+                            uint32_t         aPosition,
+                            uint16_t         aBlockLength,
+                            bool             aMore)
+{
+    Transfer *         transfer = static_cast<Transfer *>(aContext);
+    const ot::Message &message  = *static_cast<const ot::Message *>(aMessage);
+
+    VerifyOrQuit(aPosition == transfer->mReceivedLength, "block received out of order");
+    VerifyOrQuit(aPosition + aBlockLength <= kPayloadLength, "received more than the payload");
+    VerifyOrQuit(aMore == (aPosition + aBlockLength < kPayloadLength), "wrong more flag");
+
+    message.Read(message.GetOffset(), aBlockLength, &transfer->mReceived[aPosition]);
+    transfer->mReceivedLength += aBlockLength;
+    transfer->mNumBlocks++;
+    transfer->mLastBlockLength = aBlockLength;
+
+    return OT_ERROR_NONE;
+}
+
+static void HandleBlockwiseRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    Transfer *              transfer = static_cast<Transfer *>(aContext);
+    const Coap::Message &   request  = *static_cast<const Coap::Message *>(aMessage);
+    const Ip6::MessageInfo &info     = *static_cast<const Ip6::MessageInfo *>(aMessageInfo);
+    Coap::Message *         response = transfer->mServer->NewMessage();
+    uint32_t                size;
+
+    VerifyOrQuit(response != NULL, "NewMessage() failed");
+    SuccessOrQuit(response->SetDefaultResponseHeader(request), "SetDefaultResponseHeader() failed");
+    transfer->mHandled = true;
+
+    if (request.GetCode() == OT_COAP_CODE_GET)
+    {
+        // The request options following Block2 were kept in order.
+        SuccessOrQuit(request.ReadUintOption(OT_COAP_OPTION_SIZE2, size), "Size2 option is missing");
+        VerifyOrQuit(size == 0, "wrong Size2 option");
+
+        response->SetCode(OT_COAP_CODE_CONTENT);
+        SuccessOrQuit(
+            transfer->mServer->SendResponseBlockWise(*response, info, transfer, transfer->mBlockSize, TransmitBlock),
+            "SendResponseBlockWise() failed");
+    }
+    else
+    {
+        SuccessOrQuit(transfer->mServer->SendMessage(*response, info), "SendMessage() failed");
+    }
+}
+
+static void Deliver(TestCoap &aFrom, TestCoap &aTo, const Ip6::MessageInfo &aMessageInfo)
+{
+    Coap::Message *message = aFrom.mLastMessage;
+
+    VerifyOrQuit(message != NULL, "no message was sent");
+    aFrom.mLastMessage = NULL;
+
+    message->SetOffset(0);
+    aTo.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+static void RunTransfer(TestCoap &              aClient,
+                        TestCoap &              aServer,
+                        const Ip6::MessageInfo &aClientInfo,
+                        const Ip6::MessageInfo &aServerInfo,
+                        const Transfer &        aTransfer)
+{
+    for (uint16_t i = 0; !aTransfer.mHandled; i++)
+    {
+        VerifyOrQuit(i < kMaxExchanges, "transfer did not end");
+        Deliver(aClient, aServer, aClientInfo);
+        Deliver(aServer, aClient, aServerInfo);
+    }
+}
+
+static void HandleTransferResponse(void *               aContext,
+                                   otMessage *          aMessage,
+                                   const otMessageInfo *aMessageInfo,
+                                   otError              aResult)
+{
+    Transfer *transfer = static_cast<Transfer *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(!transfer->mHandled, "response handler called more than once");
+    transfer->mHandled = true;
+    transfer->mResult  = aResult;
+}
+
+static otError SendUpload(TestCoap &aClient, const Ip6::MessageInfo &aServerInfo, Transfer &aTransfer)
+{
+    Coap::Message *message = aClient.NewMessage();
+    otError        error;
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    SuccessOrQuit(message->SetToken(Coap::Message::kDefaultTokenLength), "SetToken() failed");
+    SuccessOrQuit(message->AppendUriPathOptions("blk"), "AppendUriPathOptions() failed");
+
+    // Size1 is numbered above Block1, which has to be inserted before it.
+    SuccessOrQuit(message->AppendUintOption(OT_COAP_OPTION_SIZE1, kPayloadLength), "AppendUintOption() failed");
+
+    error = aClient.SendMessageBlockWise(*message, aServerInfo, HandleTransferResponse, &aTransfer,
+                                         aTransfer.mBlockSize, TransmitBlock, NULL);
+
+    if (error != OT_ERROR_NONE)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+static otError ReceiveUploadBlock(void *           aContext,
+                                  const otMessage *aMessage,
+                                  uint32_t         aPosition,
+                                  uint16_t         aBlockLength,
+                                  bool             aMore)
+{
+    uint32_t size;
+
+    SuccessOrQuit(static_cast<const Coap::Message *>(aMessage)->ReadUintOption(OT_COAP_OPTION_SIZE1, size),
+                  "Size1 option is missing");
+    VerifyOrQuit(size == kPayloadLength, "wrong Size1 option");
+
+    return ReceiveBlock(aContext, aMessage, aPosition, aBlockLength, aMore);
+}
+
+void TestCoapBlockwiseUpload(void)
+{
+    Instance *              instance = testInitInstance();
+    TestCoap                client(*instance);
+    TestCoap                server(*instance);
+    Ip6::MessageInfo        clientInfo;
+    Ip6::MessageInfo        serverInfo;
+    Transfer                clientTransfer;
+    Transfer                serverTransfer;
+    Coap::BlockwiseResource resource("blk", HandleBlockwiseRequest, ReceiveUploadBlock, NULL, &serverTransfer);
+    Coap::Message *         response;
+    uint32_t                number;
+    bool                    more;
+    otCoapBlockSize         size;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    clientInfo.GetPeerAddr().FromString("fd00::2");
+    clientInfo.SetPeerPort(kPeerPort);
+    serverInfo.GetPeerAddr().FromString("fd00::1");
+    serverInfo.SetPeerPort(kPeerPort);
+
+    client.mKeepLastMessage = true;
+    server.mKeepLastMessage = true;
+    SuccessOrQuit(server.AddBlockWiseResource(resource), "AddBlockWiseResource() failed");
+
+    // A payload spanning several blocks is sent one block at a time.
+    InitTransfer(clientTransfer, &server, OT_COAP_BLOCK_SIZE_64);
+    InitTransfer(serverTransfer, &server, OT_COAP_BLOCK_SIZE_64);
+    SuccessOrQuit(SendUpload(client, serverInfo, clientTransfer), "SendMessageBlockWise() failed");
+    RunTransfer(client, server, clientInfo, serverInfo, serverTransfer);
+
+    VerifyOrQuit(clientTransfer.mHandled && clientTransfer.mResult == OT_ERROR_NONE, "upload failed");
+    VerifyOrQuit(clientTransfer.mNumBlocks == (kPayloadLength + 63) / 64, "wrong number of blocks sent");
+    VerifyOrQuit(serverTransfer.mReceivedLength == kPayloadLength &&
+                     memcmp(serverTransfer.mReceived, sPayload, kPayloadLength) == 0,
+                 "uploaded payload differs");
+    VerifyOrQuit(client.GetNumPendingRequests() == 0, "upload is still pending");
+
+    // The server may ask for smaller blocks in its response to the first one (RFC 7959, section 2.5).
+    InitTransfer(clientTransfer, &server, OT_COAP_BLOCK_SIZE_128);
+    InitTransfer(serverTransfer, &server, OT_COAP_BLOCK_SIZE_128);
+    SuccessOrQuit(SendUpload(client, serverInfo, clientTransfer), "SendMessageBlockWise() failed");
+    Deliver(client, server, clientInfo);
+    VerifyOrQuit(serverTransfer.mReceivedLength == 128, "first block was not received");
+
+    response            = server.mLastMessage;
+    server.mLastMessage = NULL;
+    SuccessOrQuit(response->ReadBlockOption(OT_COAP_OPTION_BLOCK1, number, more, size), "Block1 option is missing");
+    VerifyOrQuit(number == 0 && more && size == OT_COAP_BLOCK_SIZE_128, "wrong Block1 option");
+    response->Free();
+
+    response = server.NewMessage();
+    VerifyOrQuit(response != NULL, "NewMessage() failed");
+    response->Init(OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CONTINUE);
+    response->SetMessageId(client.mLastMessageId);
+    SuccessOrQuit(response->SetToken(client.mLastToken, client.mLastTokenLength), "SetToken() failed");
+    SuccessOrQuit(response->AppendBlockOption(OT_COAP_OPTION_BLOCK1, 0, true, OT_COAP_BLOCK_SIZE_32),
+                  "AppendBlockOption() failed");
+    response->Finish();
+    client.Receive(*response, serverInfo);
+    response->Free();
+
+    VerifyOrQuit(clientTransfer.mLastBlockLength == 32, "smaller block size was not used");
+    SuccessOrQuit(client.mLastMessage->ReadBlockOption(OT_COAP_OPTION_BLOCK1, number, more, size),
+                  "Block1 option is missing");
+    VerifyOrQuit(number == 4 && more && size == OT_COAP_BLOCK_SIZE_32, "block number was not converted");
+
+    RunTransfer(client, server, clientInfo, serverInfo, serverTransfer);
+
+    VerifyOrQuit(clientTransfer.mHandled && clientTransfer.mResult == OT_ERROR_NONE, "upload failed");
+    VerifyOrQuit(serverTransfer.mReceivedLength == kPayloadLength &&
+                     memcmp(serverTransfer.mReceived, sPayload, kPayloadLength) == 0,
+                 "uploaded payload differs");
+
+    // A failing transmit hook ends the transfer with its error.
+    InitTransfer(clientTransfer, &server, OT_COAP_BLOCK_SIZE_64);
+    clientTransfer.mFailPosition = 0;
+    VerifyOrQuit(SendUpload(client, serverInfo, clientTransfer) == OT_ERROR_FAILED, "first block did not fail");
+    VerifyOrQuit(!clientTransfer.mHandled && client.GetNumPendingRequests() == 0, "failed request is pending");
+
+    InitTransfer(clientTransfer, &server, OT_COAP_BLOCK_SIZE_64);
+    InitTransfer(serverTransfer, &server, OT_COAP_BLOCK_SIZE_64);
+    clientTransfer.mFailPosition = 128;
+    SuccessOrQuit(SendUpload(client, serverInfo, clientTransfer), "SendMessageBlockWise() failed");
+
+    for (uint16_t i = 0; !clientTransfer.mHandled; i++)
+    {
+        VerifyOrQuit(i < kMaxExchanges, "transfer did not end");
+        Deliver(client, server, clientInfo);
+        Deliver(server, client, serverInfo);
+    }
+
+    VerifyOrQuit(clientTransfer.mResult == OT_ERROR_FAILED, "transmit hook error was not reported");
+    VerifyOrQuit(clientTransfer.mNumBlocks == 2 && serverTransfer.mReceivedLength == 128, "wrong blocks were sent");
+    VerifyOrQuit(!serverTransfer.mHandled, "incomplete request was handled");
+    VerifyOrQuit(client.GetNumPendingRequests() == 0, "failed transfer is still pending");
+    VerifyOrQuit(client.mLastMessage == NULL, "a block was sent after the failure");
+
+    server.RemoveBlockWiseResource(resource);
+    testFreeInstance(instance);
+}
+
+void TestCoapBlockwiseDownload(void)
+{
+    Instance *              instance = testInitInstance();
+    TestCoap                client(*instance);
+    TestCoap                server(*instance);
+    Ip6::MessageInfo        clientInfo;
+    Ip6::MessageInfo        serverInfo;
+    Transfer                clientTransfer;
+    Transfer                serverTransfer;
+    Coap::BlockwiseResource resource("blk", HandleBlockwiseRequest, NULL, TransmitBlock, &serverTransfer);
+    Coap::Message *         message;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    clientInfo.GetPeerAddr().FromString("fd00::2");
+    clientInfo.SetPeerPort(kPeerPort);
+    serverInfo.GetPeerAddr().FromString("fd00::1");
+    serverInfo.SetPeerPort(kPeerPort);
+
+    client.mKeepLastMessage = true;
+    server.mKeepLastMessage = true;
+    SuccessOrQuit(server.AddBlockWiseResource(resource), "AddBlockWiseResource() failed");
+
+    InitTransfer(clientTransfer, &server, OT_COAP_BLOCK_SIZE_128);
+    InitTransfer(serverTransfer, &server, OT_COAP_BLOCK_SIZE_64);
+
+    message = client.NewMessage();
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_GET);
+    SuccessOrQuit(message->SetToken(Coap::Message::kDefaultTokenLength), "SetToken() failed");
+    SuccessOrQuit(message->AppendUriPathOptions("blk"), "AppendUriPathOptions() failed");
+
+    // Size2 is numbered above Block2, which has to be inserted before it.
+    SuccessOrQuit(message->AppendUintOption(OT_COAP_OPTION_SIZE2, 0), "AppendUintOption() failed");
+    SuccessOrQuit(client.SendMessageBlockWise(*message, serverInfo, HandleTransferResponse, &clientTransfer,
+                                              clientTransfer.mBlockSize, NULL, ReceiveBlock),
+                  "SendMessageBlockWise() failed");
+
+    // The server answers with the block size of its choice, the client follows it.
+    for (uint16_t i = 0; !clientTransfer.mHandled; i++)
+    {
+        VerifyOrQuit(i < kMaxExchanges, "transfer did not end");
+        Deliver(client, server, clientInfo);
+        Deliver(server, client, serverInfo);
+    }
+
+    VerifyOrQuit(clientTransfer.mResult == OT_ERROR_NONE, "download failed");
+    VerifyOrQuit(clientTransfer.mReceivedLength == kPayloadLength &&
+                     memcmp(clientTransfer.mReceived, sPayload, kPayloadLength) == 0,
+                 "downloaded payload differs");
+    VerifyOrQuit(serverTransfer.mNumBlocks == (kPayloadLength + 63) / 64, "wrong number of blocks served");
+    VerifyOrQuit(client.GetNumPendingRequests() == 0, "download is still pending");
+
+    server.RemoveBlockWiseResource(resource);
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+static void HandleObserveRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    (*static_cast<uint16_t *>(aContext))++;
+}
+
+static void HandleNotification(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aResult)
+{
+    Request *request = static_cast<Request *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(!request->mHandled, "notification handled after the observation ended");
+    request->mResult = aResult;
+
+    if (aResult != OT_ERROR_NONE || aMessage == NULL)
+    {
+        request->mHandled = true;
+    }
+}
+
+static void ReceiveObserveRequest(TestCoap &aCoap, const Ip6::MessageInfo &aMessageInfo, Request &aRequest)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_GET);
+    message->SetMessageId(aRequest.mMessageId);
+    SuccessOrQuit(message->SetToken(Coap::Message::kDefaultTokenLength), "SetToken() failed");
+    SuccessOrQuit(message->AppendObserveOption(0), "AppendObserveOption() failed");
+    SuccessOrQuit(message->AppendUriPathOptions("obs"), "AppendUriPathOptions() failed");
+    message->Finish();
+
+    aRequest.mTokenLength = message->GetTokenLength();
+    memcpy(aRequest.mToken, message->GetToken(), aRequest.mTokenLength);
+
+    aCoap.Receive(*message, aMessageInfo);
+    VerifyOrQuit(aCoap.IsObserverRegistered(*message, aMessageInfo), "observer was not registered");
+    message->Free();
+}
+
+static Coap::Message *NewNotification(TestCoap &aCoap, Coap::Message::Type aType)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(aType, OT_COAP_CODE_CONTENT);
+    SuccessOrQuit(message->AppendObserveOption(0), "AppendObserveOption() failed");
+    message->Finish();
+
+    return message;
+}
+
+static void SendObserveRequest(TestCoap &              aCoap,
+                               const Ip6::MessageInfo &aMessageInfo,
+                               Request &               aRequest,
+                               uint32_t                aObserve)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_GET);
+
+    if (aObserve == 0)
+    {
+        SuccessOrQuit(message->SetToken(Coap::Message::kDefaultTokenLength), "SetToken() failed");
+    }
+    else
+    {
+        SuccessOrQuit(message->SetToken(aRequest.mToken, aRequest.mTokenLength), "SetToken() failed");
+    }
+
+    SuccessOrQuit(message->AppendObserveOption(aObserve), "AppendObserveOption() failed");
+    SuccessOrQuit(message->AppendUriPathOptions("obs"), "AppendUriPathOptions() failed");
+    SuccessOrQuit(aCoap.SendMessage(*message, aMessageInfo, HandleNotification, &aRequest), "SendMessage() failed");
+
+    aRequest.mMessageId   = aCoap.mLastMessageId;
+    aRequest.mTokenLength = aCoap.mLastTokenLength;
+    memcpy(aRequest.mToken, aCoap.mLastToken, aRequest.mTokenLength);
+    aRequest.mHandled = false;
+    aRequest.mResult  = OT_ERROR_FAILED;
+}
+
+static void ReceiveNotification(TestCoap &              aCoap,
+                                const Ip6::MessageInfo &aMessageInfo,
+                                Coap::Message::Type     aType,
+                                uint16_t                aMessageId,
+                                const Request &         aRequest,
+                                uint32_t                aObserve)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "NewMessage() failed");
+    message->Init(aType, OT_COAP_CODE_CONTENT);
+    message->SetMessageId(aMessageId);
+    SuccessOrQuit(message->SetToken(aRequest.mToken, aRequest.mTokenLength), "SetToken() failed");
+    SuccessOrQuit(message->AppendObserveOption(aObserve), "AppendObserveOption() failed");
+    message->Finish();
+    aCoap.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+void TestCoapObserveServer(void)
+{
+    Instance *       instance = testInitInstance();
+    TestCoap         coap(*instance);
+    uint16_t         numRequests = 0;
+    Coap::Resource   resource("obs", HandleObserveRequest, &numRequests);
+    Ip6::MessageInfo peerA;
+    Ip6::MessageInfo peerB;
+    Request          observerA;
+    Request          observerB;
+    Coap::Message *  notification;
+    uint16_t         numSent;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+    g_testPlatAlarmGetNow = GetNow;
+
+    peerA.GetPeerAddr().FromString("fd00::1");
+    peerA.SetPeerPort(kPeerPort);
+    peerB.GetPeerAddr().FromString("fd00::2");
+    peerB.SetPeerPort(kPeerPort);
+
+    SuccessOrQuit(coap.AddResource(resource), "AddResource() failed");
+
+    observerA.mMessageId = 0x100;
+    observerB.mMessageId = 0x200;
+    ReceiveObserveRequest(coap, peerA, observerA);
+    ReceiveObserveRequest(coap, peerB, observerB);
+    VerifyOrQuit(numRequests == 2, "registration was not passed to the resource");
+
+    notification = NewNotification(coap, OT_COAP_TYPE_NON_CONFIRMABLE);
+
+    // A failure to notify one observer is reported, the other observers are still notified.
+    coap.mFailingPeer = peerB.GetPeerAddr();
+    numSent           = coap.mNumSent;
+    VerifyOrQuit(coap.NotifyObservers(resource, *notification) == OT_ERROR_NO_BUFS, "NotifyObservers() succeeded");
+    VerifyOrQuit(coap.mNumSent == numSent + 1 && coap.mLastPeer == peerA.GetPeerAddr(), "observer was skipped");
+    VerifyOrQuit(coap.mLastObserve == 1, "wrong sequence number");
+    VerifyOrQuit(coap.mLastTokenLength == observerA.mTokenLength &&
+                     memcmp(coap.mLastToken, observerA.mToken, observerA.mTokenLength) == 0,
+                 "wrong token");
+
+    // The sequence number is only advanced for notifications which were sent.
+    coap.mFailingPeer.Clear();
+    SuccessOrQuit(coap.NotifyObservers(resource, *notification), "NotifyObservers() failed");
+    VerifyOrQuit(coap.mLastPeer == peerB.GetPeerAddr() && coap.mLastObserve == 1, "wrong sequence number");
+
+    // An observer rejecting the last notification is removed.
+    coap.mFailingPeer = peerB.GetPeerAddr();
+    VerifyOrQuit(coap.NotifyObservers(resource, *notification) == OT_ERROR_NO_BUFS, "NotifyObservers() succeeded");
+    VerifyOrQuit(coap.mLastPeer == peerA.GetPeerAddr() && coap.mLastObserve == 3, "wrong sequence number");
+    coap.mFailingPeer.Clear();
+
+    ReceiveResponse(coap, peerA, OT_COAP_TYPE_RESET, OT_COAP_CODE_EMPTY, coap.mLastMessageId, observerA);
+    notification->Free();
+
+    // An observer not acknowledging a confirmable notification is removed.
+    notification = NewNotification(coap, OT_COAP_TYPE_CONFIRMABLE);
+    numSent      = coap.mNumSent;
+    SuccessOrQuit(coap.NotifyObservers(resource, *notification), "NotifyObservers() failed");
+    VerifyOrQuit(coap.mNumSent == numSent + 1 && coap.mLastPeer == peerB.GetPeerAddr(), "reset observer notified");
+    VerifyOrQuit(coap.mLastObserve == 2, "wrong sequence number");
+
+    AdvanceTime(*instance, 1000000);
+    VerifyOrQuit(coap.mNumSent == numSent + 1 + Coap::kMaxRetransmit, "notification was not retransmitted");
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "notification is still pending");
+
+    numSent = coap.mNumSent;
+    SuccessOrQuit(coap.NotifyObservers(resource, *notification), "NotifyObservers() failed");
+    VerifyOrQuit(coap.mNumSent == numSent, "observer was not removed");
+    notification->Free();
+
+    coap.RemoveResource(resource);
+    testFreeInstance(instance);
+}
+
+void TestCoapObserveClient(void)
+{
+    Instance *       instance = testInitInstance();
+    TestCoap         coap(*instance);
+    Ip6::MessageInfo messageInfo;
+    Request          observation;
+    Request          cancellation;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+    g_testPlatAlarmGetNow = GetNow;
+
+    messageInfo.GetPeerAddr().FromString("fd00::1");
+    messageInfo.SetPeerPort(kPeerPort);
+
+    SendObserveRequest(coap, messageInfo, observation, 0);
+
+    // The response establishes the observation, which outlives the retransmission timeout.
+    ReceiveNotification(coap, messageInfo, OT_COAP_TYPE_ACKNOWLEDGMENT, observation.mMessageId, observation, 5);
+    VerifyOrQuit(!observation.mHandled && observation.mResult == OT_ERROR_NONE, "response was not handled");
+
+    AdvanceTime(*instance, 1000000);
+    VerifyOrQuit(coap.GetNumPendingRequests() == 1, "observation timed out");
+
+    // Notifications are passed to the handler, reordered ones are dropped.
+    observation.mResult = OT_ERROR_FAILED;
+    ReceiveNotification(coap, messageInfo, OT_COAP_TYPE_NON_CONFIRMABLE, 0x1000, observation, 6);
+    VerifyOrQuit(observation.mResult == OT_ERROR_NONE, "notification was not handled");
+
+    observation.mResult = OT_ERROR_FAILED;
+    ReceiveNotification(coap, messageInfo, OT_COAP_TYPE_NON_CONFIRMABLE, 0x1001, observation, 4);
+    VerifyOrQuit(observation.mResult == OT_ERROR_FAILED, "reordered notification was handled");
+
+    // A confirmable notification is acknowledged.
+    ReceiveNotification(coap, messageInfo, OT_COAP_TYPE_CONFIRMABLE, 0x1002, observation, 7);
+    VerifyOrQuit(observation.mResult == OT_ERROR_NONE, "notification was not handled");
+    VerifyOrQuit(coap.mLastType == OT_COAP_TYPE_ACKNOWLEDGMENT && coap.mLastMessageId == 0x1002,
+                 "notification was not acknowledged");
+
+    // Cancelling the observation ends it with OT_ERROR_ABORT.
+    cancellation = observation;
+    SendObserveRequest(coap, messageInfo, cancellation, 1);
+    VerifyOrQuit(observation.mHandled && observation.mResult == OT_ERROR_ABORT, "cancellation was not handled");
+    VerifyOrQuit(coap.GetNumPendingRequests() == 1, "observation is still pending");
+
+    ReceiveResponse(coap, messageInfo, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CONTENT, cancellation.mMessageId,
+                    cancellation);
+    VerifyOrQuit(cancellation.mResult == OT_ERROR_NONE, "response was not handled");
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "cancellation is still pending");
+
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestCoapPendingRequests();
+    ot::TestCoapRetransmissions();
+    ot::TestCoapResources();
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    for (uint16_t i = 0; i < ot::kPayloadLength; i++)
+    {
+        ot::sPayload[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    ot::TestCoapBlockwiseUpload();
+    ot::TestCoapBlockwiseDownload();
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    ot::TestCoapObserveServer();
+    ot::TestCoapObserveClient();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,353 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <sys/time.h>
+
+#include <openthread/config.h>
+
+#include "common/debug.hpp"
+#include "crypto/accel.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "crypto/aes_ecb.hpp"
+#include "crypto/hmac_sha256.hpp"
+#include "crypto/sha256.hpp"
+
+#include "test_util.h"
+
+static const char *BackendName(bool aAccel)
+{
+    return aAccel ? "accelerated" : "portable";
+}
+
+/**
+ * Selects the crypto backend, returns false if @p aAccel is requested but not available.
+ */
+static bool SelectBackend(bool aAccel)
+{
+#if OPENTHREAD_CONFIG_CRYPTO_ACCEL_ENABLE
+    ot::Crypto::Accel::SetEnabled(aAccel);
+    return !aAccel || (ot::Crypto::Accel::IsAesSupported() && ot::Crypto::Accel::IsSha256Supported());
+#else
+    return !aAccel;
+#endif
+}
+
+/**
+ * Verifies AES-128 test vectors from FIPS-197 Appendix C.1 and NIST SP 800-38A F.1.1.
+ */
+void TestAesEcb(bool aAccel)
+{
+    static const struct
+    {
+        uint8_t key[16];
+        uint8_t plain[16];
+        uint8_t cipher[16];
+    } tests[] = {
+        {
+            {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f},
+            {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff},
+            {0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a},
+        },
+        {
+            {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c},
+            {0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a},
+            {0x3a, 0xd7, 0x7b, 0xb4, 0x0d, 0x7a, 0x36, 0x60, 0xa8, 0x9e, 0xca, 0xf3, 0x24, 0x66, 0xef, 0x97},
+        },
+    };
+
+    ot::Crypto::AesEcb aesEcb;
+    uint8_t            block[ot::Crypto::AesEcb::kBlockSize];
+
+    for (unsigned i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+    {
+        aesEcb.SetKey(tests[i].key, 8 * sizeof(tests[i].key));
+        aesEcb.Encrypt(tests[i].plain, block);
+        VerifyOrQuit(memcmp(block, tests[i].cipher, sizeof(block)) == 0, "TestAesEcb: encrypt failed\n");
+
+        // in place
+        memcpy(block, tests[i].plain, sizeof(block));
+        aesEcb.Encrypt(block, block);
+        VerifyOrQuit(memcmp(block, tests[i].cipher, sizeof(block)) == 0, "TestAesEcb: in place encrypt failed\n");
+    }
+
+    printf("TestAesEcb(%s) passed\n", BackendName(aAccel));
+}
+
+/**
+ * Verifies AES-CCM with RFC 3610 Packet Vector #1.
+ */
+void TestAesCcm(bool aAccel)
+{
+    const uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    const uint8_t nonce[] = {
+        0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+    };
+
+    const uint8_t plain[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e,
+    };
+
+    const uint8_t encrypted[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2,
+        0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84, 0x17,
+        0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0,
+    };
+
+    const uint32_t headerLength  = 8;
+    const uint32_t payloadLength = sizeof(plain) - headerLength;
+
+    uint8_t test[sizeof(encrypted)];
+    uint8_t tagLength;
+
+    {
+        ot::Crypto::AesCcm aesCcm;
+
+        memcpy(test, plain, sizeof(plain));
+        tagLength = sizeof(encrypted) - sizeof(plain);
+
+        aesCcm.SetKey(key, sizeof(key));
+        aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(test, headerLength);
+        aesCcm.Payload(test + headerLength, test + headerLength, payloadLength, true);
+        aesCcm.Finalize(test + sizeof(plain), &tagLength);
+
+        VerifyOrQuit(memcmp(test, encrypted, sizeof(encrypted)) == 0, "TestAesCcm: encrypt failed\n");
+    }
+
+    {
+        ot::Crypto::AesCcm aesCcm;
+        uint8_t            tag[sizeof(encrypted) - sizeof(plain)];
+
+        aesCcm.SetKey(key, sizeof(key));
+        aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(test, headerLength);
+        aesCcm.Payload(test + headerLength, test + headerLength, payloadLength, false);
+        aesCcm.Finalize(tag, &tagLength);
+
+        VerifyOrQuit(memcmp(test, plain, sizeof(plain)) == 0, "TestAesCcm: decrypt failed\n");
+        VerifyOrQuit(memcmp(tag, encrypted + sizeof(plain), sizeof(tag)) == 0, "TestAesCcm: tag failed\n");
+    }
+
+    printf("TestAesCcm(%s) passed\n", BackendName(aAccel));
+}
+
+/**
+ * Verifies SHA-256 test vectors from FIPS 180-2 and the empty message, fed in pieces of every size.
+ */
+void TestSha256(bool aAccel)
+{
+    static const struct
+    {
+        const char *data;
+        uint8_t     hash[ot::Crypto::Sha256::kHashSize];
+    } tests[] = {
+        {
+            "",
+            {
+                0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+                0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55,
+            },
+        },
+        {
+            "abc",
+            {
+                0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+                0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+            },
+        },
+        {
+            "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+            {
+                0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+                0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1,
+            },
+        },
+        {
+            "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrs"
+            "tnopqrstu",
+            {
+                0xcf, 0x5b, 0x16, 0xa7, 0x78, 0xaf, 0x83, 0x80, 0x03, 0x6c, 0xe5, 0x9e, 0x7b, 0x04, 0x92, 0x37,
+                0x0b, 0x24, 0x9b, 0x11, 0xe8, 0xf0, 0x7a, 0x51, 0xaf, 0xac, 0x45, 0x03, 0x7a, 0xfe, 0xe9, 0xd1,
+            },
+        },
+    };
+
+    ot::Crypto::Sha256 sha256;
+    uint8_t            hash[ot::Crypto::Sha256::kHashSize];
+
+    for (unsigned i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+    {
+        const uint8_t *data   = reinterpret_cast<const uint8_t *>(tests[i].data);
+        uint16_t       length = static_cast<uint16_t>(strlen(tests[i].data));
+
+        for (uint16_t step = 1; step <= length + 1; step++)
+        {
+            sha256.Start();
+
+            for (uint16_t offset = 0; offset < length; offset += step)
+            {
+                sha256.Update(data + offset, (length - offset < step) ? length - offset : step);
+            }
+
+            sha256.Finish(hash);
+            VerifyOrQuit(memcmp(hash, tests[i].hash, sizeof(hash)) == 0, "TestSha256: hash failed\n");
+        }
+    }
+
+    printf("TestSha256(%s) passed\n", BackendName(aAccel));
+}
+
+/**
+ * Verifies HMAC-SHA-256 test cases 2 and 6 from RFC 4231.
+ */
+void TestHmacSha256(bool aAccel)
+{
+    static const char kLongKeyData[] = "Test Using Larger Than Block-Size Key - Hash Key First";
+
+    const uint8_t shortKeyHash[] = {
+        0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+        0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43,
+    };
+
+    const uint8_t longKeyHash[] = {
+        0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f, 0x0d, 0x8a, 0x26, 0xaa, 0xcb, 0xf5, 0xb7, 0x7f,
+        0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28, 0xc5, 0x14, 0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3, 0x7f, 0x54,
+    };
+
+    ot::Crypto::HmacSha256 hmac;
+    uint8_t                longKey[131];
+    uint8_t                hash[ot::Crypto::HmacSha256::kHashSize];
+
+    hmac.Start(reinterpret_cast<const uint8_t *>("Jefe"), 4);
+    hmac.Update(reinterpret_cast<const uint8_t *>("what do ya want "), 16);
+    hmac.Update(reinterpret_cast<const uint8_t *>("for nothing?"), 12);
+    hmac.Finish(hash);
+    VerifyOrQuit(memcmp(hash, shortKeyHash, sizeof(hash)) == 0, "TestHmacSha256: short key failed\n");
+
+    memset(longKey, 0xaa, sizeof(longKey));
+    hmac.Start(longKey, sizeof(longKey));
+    hmac.Update(reinterpret_cast<const uint8_t *>(kLongKeyData), sizeof(kLongKeyData) - 1);
+    hmac.Finish(hash);
+    VerifyOrQuit(memcmp(hash, longKeyHash, sizeof(hash)) == 0, "TestHmacSha256: long key failed\n");
+
+    printf("TestHmacSha256(%s) passed\n", BackendName(aAccel));
+}
+
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+/**
+ * Measures AES-CCM frames per second and SHA-256 throughput of the selected backend.
+ */
+void TestCryptoBenchmark(bool aAccel)
+{
+    const uint32_t kNumFrames     = 50000;
+    const uint32_t kHeaderLength  = 23;
+    const uint32_t kPayloadLength = 96;
+    const uint32_t kNumHashUpdates = 1000;
+    const uint8_t  kNonce[]       = {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05};
+
+    uint8_t            key[16];
+    uint8_t            frame[127];
+    uint8_t            hash[ot::Crypto::Sha256::kHashSize];
+    ot::Crypto::AesEcb keySchedule;
+    ot::Crypto::Sha256 sha256;
+    struct timeval     start;
+    uint32_t           aesCcmUsec;
+    uint32_t           sha256Usec;
+
+    memset(key, 0xc0, sizeof(key));
+    memset(frame, 0x5a, sizeof(frame));
+    keySchedule.SetKey(key, 8 * sizeof(key));
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kNumFrames; n++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+        uint8_t            tagLength = 4;
+
+        aesCcm.SetKey(keySchedule);
+        aesCcm.Init(kHeaderLength, kPayloadLength, tagLength, kNonce, sizeof(kNonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, true);
+        aesCcm.Finalize(frame + kHeaderLength + kPayloadLength, &tagLength);
+    }
+
+    aesCcmUsec = BenchmarkElapsedUsec(start);
+    gettimeofday(&start, NULL);
+
+    sha256.Start();
+
+    for (uint32_t n = 0; n < kNumHashUpdates; n++)
+    {
+        sha256.Update(frame, sizeof(frame));
+    }
+
+    sha256.Finish(hash);
+    sha256Usec = BenchmarkElapsedUsec(start);
+
+    printf("TestCryptoBenchmark(%s): AES-CCM %u frames/s, SHA-256 %u KB/s\n", BackendName(aAccel),
+           static_cast<unsigned int>((static_cast<uint64_t>(kNumFrames) * 1000000) / (aesCcmUsec + 1)),
+           static_cast<unsigned int>((static_cast<uint64_t>(kNumHashUpdates) * sizeof(frame) * 1000000) /
+                                     (sha256Usec + 1) / 1024));
+}
+
+int main(void)
+{
+    for (int accel = 0; accel < 2; accel++)
+    {
+        if (!SelectBackend(accel != 0))
+        {
+            printf("Skipping accelerated backend, not available\n");
+            continue;
+        }
+
+        TestAesEcb(accel != 0);
+        TestAesCcm(accel != 0);
+        TestSha256(accel != 0);
+        TestHmacSha256(accel != 0);
+        TestCryptoBenchmark(accel != 0);
+    }
+
+    SelectBackend(true);
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -27,6 +27,7 @@
  */
 
 #include <ctype.h>
+#include <sys/time.h>
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
@@ -523,11 +524,14 @@ uint32_t GetRandom(uint32_t max)
 void TestFuzzEncoderDecoder(void)
 {
     uint16_t                       length;
+    uint16_t                       offset;
     uint8_t                        frame[kMaxFrameLength];
     Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> byteEncoderBuffer;
     Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
     DecoderContext                 decoderContext;
     Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Encoder                  byteEncoder(byteEncoderBuffer);
     Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
 
     printf("Testing Hdlc::Encoder and Hdlc::Decoder with randomly generated frames");
@@ -554,8 +558,31 @@ void TestFuzzEncoderDecoder(void)
         VerifyOrQuit(!encoderBuffer.IsEmpty(), "Encoded frame is empty");
         VerifyOrQuit(encoderBuffer.GetLength() > length, "Encoded frame is too short");
 
+        // The block encoder must produce the same frame as encoding one byte at a time.
+        byteEncoderBuffer.Clear();
+        SuccessOrQuit(byteEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            SuccessOrQuit(byteEncoder.Encode(frame[i]), "Encoder::Encode() failed");
+        }
+
+        SuccessOrQuit(byteEncoder.EndFrame(), "Encoder::EndFrame() failed");
+        VerifyOrQuit(byteEncoderBuffer.GetLength() == encoderBuffer.GetLength() &&
+                         memcmp(byteEncoderBuffer.GetFrame(), encoderBuffer.GetFrame(), encoderBuffer.GetLength()) == 0,
+                     "Encoded frame does not match frame encoded one byte at a time");
+
+        // Feed the encoded frame to the decoder in randomly sized chunks.
         decoderContext.mWasCalled = false;
-        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+
+        for (offset = 0; offset < encoderBuffer.GetLength();)
+        {
+            uint16_t chunkLength = static_cast<uint16_t>(GetRandom(encoderBuffer.GetLength() - offset) + 1);
+
+            decoder.Decode(encoderBuffer.GetFrame() + offset, chunkLength);
+            offset += chunkLength;
+        }
+
         VerifyOrQuit(decoderContext.mWasCalled, "Decoder::Decode() failed");
         VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
 
@@ -568,6 +595,70 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+/**
+ * Measure the encoder and decoder throughput for a typical radio frame payload.
+ */
+void TestEncoderDecoderBenchmark(void)
+{
+    const uint16_t kFrameLength   = 127;
+    const uint32_t kNumIterations = 100000;
+
+    uint8_t                        frame[kFrameLength];
+    Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    struct timeval                 start;
+    uint32_t                       elapsed;
+
+    for (uint16_t i = 0; i < kFrameLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kNumIterations; n++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(encoder.Encode(frame, kFrameLength), "Encoder::Encode() failed");
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+    }
+
+    elapsed = BenchmarkElapsedUsec(start);
+    printf("TestEncoderDecoderBenchmark() encode: %u MB/s\n",
+           static_cast<unsigned int>(elapsed ? (static_cast<uint64_t>(kFrameLength) * kNumIterations) / elapsed : 0));
+
+    decoderContext.mWasCalled = false;
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kNumIterations; n++)
+    {
+        decoderBuffer.Clear();
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+    }
+
+    elapsed = BenchmarkElapsedUsec(start);
+    printf("TestEncoderDecoderBenchmark() decode: %u MB/s\n",
+           static_cast<unsigned int>(elapsed ? (static_cast<uint64_t>(kFrameLength) * kNumIterations) / elapsed : 0));
+
+    VerifyOrQuit(decoderContext.mWasCalled && decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() failed");
+    VerifyOrQuit(decoderBuffer.GetLength() == kFrameLength, "Decoded frame length does not match original frame");
+    VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, kFrameLength) == 0,
+                 "Decoded frame content does not match original frame");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -577,6 +668,7 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestEncoderDecoderBenchmark();
     printf("\nAll tests passed.\n");
     return 0;
 }
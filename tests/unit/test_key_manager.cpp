@@ -0,0 +1,227 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <sys/time.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "crypto/aes_ecb.hpp"
+#include "crypto/hmac_sha256.hpp"
+#include "thread/key_manager.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+static const uint8_t kThreadString[] = {'T', 'h', 'r', 'e', 'a', 'd'};
+
+static void ReferenceKey(const MasterKey &aMasterKey, uint32_t aKeySequence, uint8_t *aKey)
+{
+    Crypto::HmacSha256 hmac;
+    uint8_t            keySequenceBytes[sizeof(uint32_t)];
+
+    keySequenceBytes[0] = static_cast<uint8_t>(aKeySequence >> 24);
+    keySequenceBytes[1] = static_cast<uint8_t>(aKeySequence >> 16);
+    keySequenceBytes[2] = static_cast<uint8_t>(aKeySequence >> 8);
+    keySequenceBytes[3] = static_cast<uint8_t>(aKeySequence >> 0);
+
+    hmac.Start(aMasterKey.m8, sizeof(aMasterKey.m8));
+    hmac.Update(keySequenceBytes, sizeof(keySequenceBytes));
+    hmac.Update(kThreadString, sizeof(kThreadString));
+    hmac.Finish(aKey);
+}
+
+static void VerifyKeySchedule(Crypto::AesEcb *aKeySchedule, const uint8_t *aKey)
+{
+    static const uint8_t kBlock[Crypto::AesEcb::kBlockSize] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                                               0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+    Crypto::AesEcb       reference;
+    uint8_t              expected[Crypto::AesEcb::kBlockSize];
+    uint8_t              output[Crypto::AesEcb::kBlockSize];
+
+    VerifyOrQuit(aKeySchedule != NULL, "key schedule was not cached");
+
+    reference.SetKey(aKey, 128);
+    reference.Encrypt(kBlock, expected);
+    aKeySchedule->Encrypt(kBlock, output);
+
+    VerifyOrQuit(memcmp(output, expected, sizeof(output)) == 0, "cached key schedule does not match the key");
+}
+
+static void VerifyTemporaryKeys(KeyManager &aKeyManager, const MasterKey &aMasterKey, uint32_t aKeySequence)
+{
+    uint8_t key[Crypto::HmacSha256::kHashSize];
+
+    ReferenceKey(aMasterKey, aKeySequence, key);
+
+    VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMleKey(aKeySequence), key, 16) == 0, "GetTemporaryMleKey() failed");
+    VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMacKey(aKeySequence), key + 16, 16) == 0,
+                 "GetTemporaryMacKey() failed");
+
+    // The previous and next key sequences also have their key schedules cached.
+    if (aKeySequence == aKeyManager.GetCurrentKeySequence() - 1 ||
+        aKeySequence == aKeyManager.GetCurrentKeySequence() + 1)
+    {
+        VerifyKeySchedule(aKeyManager.GetTemporaryMleKeySchedule(aKeySequence), key);
+        VerifyKeySchedule(aKeyManager.GetTemporaryMacKeySchedule(aKeySequence), key + 16);
+    }
+    else
+    {
+        VerifyOrQuit(aKeyManager.GetTemporaryMleKeySchedule(aKeySequence) == NULL, "other key schedule was cached");
+        VerifyOrQuit(aKeyManager.GetTemporaryMacKeySchedule(aKeySequence) == NULL, "other key schedule was cached");
+    }
+}
+
+void TestKeyManagerKeyCache(void)
+{
+    Instance *  instance   = testInitInstance();
+    KeyManager &keyManager = instance->Get<KeyManager>();
+    MasterKey   masterKey;
+    uint8_t     key[Crypto::HmacSha256::kHashSize];
+    uint32_t    misses;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    for (uint8_t i = 0; i < sizeof(masterKey.m8); i++)
+    {
+        masterKey.m8[i] = static_cast<uint8_t>(0xa0 + i);
+    }
+
+    SuccessOrQuit(keyManager.SetMasterKey(masterKey), "SetMasterKey() failed");
+    keyManager.SetCurrentKeySequence(10);
+
+    ReferenceKey(masterKey, 10, key);
+    VerifyOrQuit(memcmp(keyManager.GetCurrentMleKey(), key, 16) == 0, "GetCurrentMleKey() failed");
+    VerifyOrQuit(memcmp(keyManager.GetCurrentMacKey(), key + 16, 16) == 0, "GetCurrentMacKey() failed");
+
+    // The previous and next keys are derived once and then cached.
+    misses = keyManager.GetKeyCacheMissCount();
+    VerifyTemporaryKeys(keyManager, masterKey, 9);
+    VerifyTemporaryKeys(keyManager, masterKey, 11);
+    VerifyOrQuit(keyManager.GetKeyCacheMissCount() == misses + 2, "previous/next keys were not cached");
+    VerifyTemporaryKeys(keyManager, masterKey, 9);
+    VerifyTemporaryKeys(keyManager, masterKey, 11);
+    VerifyOrQuit(keyManager.GetKeyCacheMissCount() == misses + 2, "cached keys were derived again");
+
+    // Other key sequences are derived on every request.
+    VerifyTemporaryKeys(keyManager, masterKey, 20);
+    VerifyOrQuit(keyManager.GetKeyCacheMissCount() == misses + 4, "other key sequence was cached");
+    VerifyTemporaryKeys(keyManager, masterKey, 11);
+    VerifyOrQuit(keyManager.GetKeyCacheMissCount() == misses + 4, "next key was overwritten");
+
+    // On key rotation the cached keys move along with the current key sequence.
+    keyManager.SetCurrentKeySequence(11);
+    ReferenceKey(masterKey, 11, key);
+    VerifyOrQuit(memcmp(keyManager.GetCurrentMleKey(), key, 16) == 0, "rotated current key is wrong");
+    VerifyTemporaryKeys(keyManager, masterKey, 10);
+    VerifyOrQuit(keyManager.GetKeyCacheMissCount() == misses + 4, "previous key was not kept on rotation");
+    VerifyTemporaryKeys(keyManager, masterKey, 12);
+    VerifyOrQuit(keyManager.GetKeyCacheMissCount() == misses + 5, "stale next key was used");
+
+    // Any other change of key sequence or master key invalidates the cache.
+    keyManager.SetCurrentKeySequence(13);
+    VerifyTemporaryKeys(keyManager, masterKey, 12);
+    VerifyTemporaryKeys(keyManager, masterKey, 14);
+    VerifyOrQuit(keyManager.GetKeyCacheMissCount() == misses + 7, "cache was not invalidated");
+
+    masterKey.m8[0] ^= 0xff;
+    SuccessOrQuit(keyManager.SetMasterKey(masterKey), "SetMasterKey() failed");
+    VerifyOrQuit(keyManager.GetCurrentKeySequence() == 0, "SetMasterKey() did not reset the key sequence");
+    VerifyTemporaryKeys(keyManager, masterKey, 1);
+    VerifyTemporaryKeys(keyManager, masterKey, 0xffffffff);
+
+    testFreeInstance(instance);
+
+    printf("TestKeyManagerKeyCache() passed\n");
+}
+
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+/**
+ * Measure the cost of looking up the MAC key of a frame secured with the next key sequence, as during a key switch,
+ * against a key sequence which is not cached.
+ */
+void TestKeyManagerKeyCacheBenchmark(void)
+{
+    const uint32_t kNumLookups = 20000;
+
+    Instance *     instance   = testInitInstance();
+    KeyManager &   keyManager = instance->Get<KeyManager>();
+    struct timeval start;
+    uint32_t       cachedUsec;
+    uint32_t       uncachedUsec;
+    uint32_t       sum = 0;
+
+    keyManager.SetCurrentKeySequence(100);
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kNumLookups; n++)
+    {
+        sum += keyManager.GetTemporaryMacKey(101)[n % 16];
+    }
+
+    cachedUsec = BenchmarkElapsedUsec(start);
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kNumLookups; n++)
+    {
+        sum += keyManager.GetTemporaryMacKey(200)[n % 16];
+    }
+
+    uncachedUsec = BenchmarkElapsedUsec(start);
+
+    printf("TestKeyManagerKeyCacheBenchmark() (checksum %u): next key %u ns, uncached key %u ns per lookup\n",
+           static_cast<unsigned int>(sum),
+           static_cast<unsigned int>((static_cast<uint64_t>(cachedUsec) * 1000) / kNumLookups),
+           static_cast<unsigned int>((static_cast<uint64_t>(uncachedUsec) * 1000) / kNumLookups));
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestKeyManagerKeyCache();
+    ot::TestKeyManagerKeyCacheBenchmark();
+    printf("All tests passed\n");
+    return 0;
+}
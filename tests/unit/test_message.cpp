@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sys/time.h>
+
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
@@ -62,9 +64,311 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageCursor(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          writeBuffer[1024];
+    uint8_t          readBuffer[1024];
+    uint16_t         offset;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // Use a reserved header so that the head buffer offset is not zero.
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 17)) != NULL, "Message::New failed");
+    SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed");
+
+    // Sequential writes of varying chunk sizes.
+    {
+        ot::Message::WritableCursor cursor(*message, 0);
+
+        for (offset = 0; offset < sizeof(writeBuffer);)
+        {
+            uint16_t length = (offset % 7) + 1;
+
+            if (offset + length > sizeof(writeBuffer))
+            {
+                length = sizeof(writeBuffer) - offset;
+            }
+
+            VerifyOrQuit(cursor.Write(writeBuffer + offset, length) == length, "WritableCursor::Write failed");
+            offset += length;
+            VerifyOrQuit(cursor.GetOffset() == offset, "WritableCursor::GetOffset failed after Write");
+        }
+
+        VerifyOrQuit(cursor.GetBytesRemaining() == 0, "WritableCursor::GetBytesRemaining failed");
+        VerifyOrQuit(cursor.Write(writeBuffer, 1) == 0, "WritableCursor::Write beyond message end");
+    }
+
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Cursor write compare failed");
+
+    // Sequential reads and skips.
+    {
+        ot::Message::Cursor cursor(*message, 0);
+
+        for (offset = 0; offset < sizeof(writeBuffer);)
+        {
+            uint16_t length = (offset % 11) + 1;
+            uint16_t expected;
+
+            expected = (offset + length > sizeof(writeBuffer)) ? sizeof(writeBuffer) - offset : length;
+
+            memset(readBuffer, 0, sizeof(readBuffer));
+            VerifyOrQuit(cursor.Read(readBuffer, length) == expected, "Cursor::Read failed");
+            VerifyOrQuit(memcmp(readBuffer, writeBuffer + offset, expected) == 0, "Cursor read compare failed");
+            offset += expected;
+
+            offset += cursor.Skip(3);
+            VerifyOrQuit(cursor.GetOffset() == offset, "Cursor::Skip failed");
+        }
+    }
+
+    // Seeking forward and backward.
+    {
+        ot::Message::Cursor cursor(*message, 500);
+        static const uint16_t kOffsets[] = {510, 505, 0, 1023, 100, 99, 300, 1024};
+
+        for (unsigned i = 0; i < OT_ARRAY_LENGTH(kOffsets); i++)
+        {
+            SuccessOrQuit(cursor.Seek(kOffsets[i]), "Cursor::Seek failed");
+            VerifyOrQuit(cursor.GetOffset() == kOffsets[i], "Cursor::GetOffset failed after Seek");
+
+            if (kOffsets[i] < sizeof(writeBuffer))
+            {
+                VerifyOrQuit(cursor.Read(readBuffer, 1) == 1 && readBuffer[0] == writeBuffer[kOffsets[i]],
+                             "Cursor::Read after Seek failed");
+            }
+        }
+
+        VerifyOrQuit(cursor.Seek(sizeof(writeBuffer) + 1) == OT_ERROR_INVALID_ARGS, "Cursor::Seek beyond end");
+    }
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+void TestMessageAppend(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    ot::Message *    reference;
+    ot::Message *    copy;
+    uint8_t          writeBuffer[1024];
+    uint8_t          readBuffer[1024];
+    uint16_t         offset;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // Appends of varying chunk sizes, crossing buffer boundaries.
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 17)) != NULL, "Message::New failed");
+
+    for (offset = 0; offset < sizeof(writeBuffer);)
+    {
+        uint16_t length = (offset % 37) + 1;
+
+        if (offset + length > sizeof(writeBuffer))
+        {
+            length = sizeof(writeBuffer) - offset;
+        }
+
+        SuccessOrQuit(message->Append(writeBuffer + offset, length), "Message::Append failed");
+        offset += length;
+        VerifyOrQuit(message->GetLength() == offset, "Message::GetLength failed after Append");
+    }
+
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Append compare failed");
+
+    VerifyOrQuit((reference = messagePool->New(ot::Message::kTypeIp6, 17)) != NULL, "Message::New failed");
+    SuccessOrQuit(reference->SetLength(sizeof(writeBuffer)), "Message::SetLength failed");
+    VerifyOrQuit(message->GetBufferCount() == reference->GetBufferCount(), "Append allocated extra buffers");
+    reference->Free();
+
+    // Appends after shrinking the message and prepending a header.
+    SuccessOrQuit(message->SetLength(100), "Message::SetLength failed");
+    SuccessOrQuit(message->Prepend(writeBuffer, 200), "Message::Prepend failed");
+    SuccessOrQuit(message->Append(writeBuffer + 300, 300), "Message::Append failed");
+    VerifyOrQuit(message->GetLength() == 600, "Message::GetLength failed after Append");
+    VerifyOrQuit(message->Read(0, 600, readBuffer) == 600, "Message::Read failed");
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, 200) == 0, "Prepend compare failed");
+    VerifyOrQuit(memcmp(readBuffer + 200, writeBuffer, 100) == 0, "Append compare failed after SetLength");
+    VerifyOrQuit(memcmp(readBuffer + 300, writeBuffer + 300, 300) == 0, "Append compare failed after Prepend");
+
+    // Appends from another message and from the message itself.
+    VerifyOrQuit((copy = messagePool->New(ot::Message::kTypeIp6, 3)) != NULL, "Message::New failed");
+    SuccessOrQuit(copy->Append(writeBuffer, 5), "Message::Append failed");
+    SuccessOrQuit(copy->AppendFrom(*message, 123, 400), "Message::AppendFrom failed");
+    SuccessOrQuit(copy->AppendFrom(*copy, 5, 400), "Message::AppendFrom failed");
+    VerifyOrQuit(copy->GetLength() == 805, "Message::GetLength failed after AppendFrom");
+    VerifyOrQuit(copy->Read(0, 805, readBuffer) == 805, "Message::Read failed");
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, 5) == 0, "AppendFrom compare failed");
+    VerifyOrQuit(memcmp(readBuffer + 5, readBuffer + 405, 400) == 0, "AppendFrom self compare failed");
+    VerifyOrQuit(memcmp(readBuffer + 5, writeBuffer + 123, 77) == 0, "AppendFrom compare failed");
+    VerifyOrQuit(memcmp(readBuffer + 82, writeBuffer, 100) == 0, "AppendFrom compare failed");
+    VerifyOrQuit(memcmp(readBuffer + 182, writeBuffer + 300, 223) == 0, "AppendFrom compare failed");
+    VerifyOrQuit(copy->AppendFrom(*message, 500, 101) == OT_ERROR_INVALID_ARGS, "AppendFrom beyond message end");
+    VerifyOrQuit(copy->GetLength() == 805, "Message::GetLength changed after failed AppendFrom");
+
+    copy->Free();
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+/**
+ * Reference one's complement sum, one byte at a time.
+ */
+static uint16_t ReferenceChecksum(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aChecksum = ot::Message::UpdateChecksum(aChecksum, (i & 1) ? aBuf[i] : static_cast<uint16_t>(aBuf[i] << 8));
+    }
+
+    return aChecksum;
+}
+
+void TestMessageChecksum(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          writeBuffer[1024];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // Every alignment and tail length of a flat buffer.
+    for (uint16_t start = 0; start < 8; start++)
+    {
+        for (uint16_t length = 0; length <= 70; length++)
+        {
+            VerifyOrQuit(ot::Message::UpdateChecksum(0x1234, writeBuffer + start, length) ==
+                             ReferenceChecksum(0x1234, writeBuffer + start, length),
+                         "Message::UpdateChecksum(buffer) failed");
+        }
+    }
+
+    VerifyOrQuit(ot::Message::UpdateChecksum(0, writeBuffer, sizeof(writeBuffer)) ==
+                     ReferenceChecksum(0, writeBuffer, sizeof(writeBuffer)),
+                 "Message::UpdateChecksum(buffer) failed");
+
+    // Ranges crossing buffer boundaries at odd and even positions.
+    for (uint16_t reserved = 0; reserved < 2; reserved++)
+    {
+        VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, reserved)) != NULL, "Message::New failed");
+        SuccessOrQuit(message->Append(writeBuffer, sizeof(writeBuffer)), "Message::Append failed");
+
+        for (uint16_t offset = 0; offset < 300; offset += 7)
+        {
+            for (uint16_t length = 0; offset + length <= sizeof(writeBuffer); length += 61)
+            {
+                VerifyOrQuit(message->UpdateChecksum(0, offset, length) ==
+                                 ReferenceChecksum(0, writeBuffer + offset, length),
+                             "Message::UpdateChecksum(message) failed");
+            }
+        }
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+/**
+ * Measure the checksum cost over a message buffer chain for a range of payload sizes.
+ */
+void TestMessageChecksumBenchmark(void)
+{
+    const uint16_t kPayloadSizes[] = {16, 64, 256, 1024};
+    const uint32_t kNumIterations  = 100000;
+
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          writeBuffer[1024];
+    uint16_t         checksum = 0;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed");
+    SuccessOrQuit(message->Append(writeBuffer, sizeof(writeBuffer)), "Message::Append failed");
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kPayloadSizes); i++)
+    {
+        struct timeval start;
+        uint32_t       elapsed;
+
+        gettimeofday(&start, NULL);
+
+        for (uint32_t n = 0; n < kNumIterations; n++)
+        {
+            checksum = message->UpdateChecksum(checksum, message->GetOffset(), kPayloadSizes[i]);
+        }
+
+        elapsed = BenchmarkElapsedUsec(start);
+
+        printf("TestMessageChecksumBenchmark() with %u bytes: %u ns per checksum\n", kPayloadSizes[i],
+               static_cast<unsigned int>((static_cast<uint64_t>(elapsed) * 1000) / kNumIterations));
+    }
+
+    VerifyOrQuit(checksum != 0, "TestMessageChecksumBenchmark: checksum of non-zero data is zero");
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 int main(void)
 {
     TestMessage();
+    TestMessageCursor();
+    TestMessageAppend();
+    TestMessageChecksum();
+    TestMessageChecksumBenchmark();
     printf("All tests passed\n");
     return 0;
 }
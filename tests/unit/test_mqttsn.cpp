@@ -30,6 +30,7 @@
 
 #include <openthread/mqttsn.h>
 #include "common/code_utils.hpp"
+#include "common/timer.hpp"
 #include "mqttsn/mqttsn_gateway_list.hpp"
 
 #include "test_platform.h"
@@ -280,6 +281,27 @@ void TestActiveGatewayListInfoRemovedAfterKeepaliveTimeout(void)
     VerifyOrQuit(list.GetList().Size() == 0, "GatewayInfo not removed");
 }
 
+void TestActiveGatewayListReportsNextExpiration(void)
+{
+    GatewayInfo gateway1 = CreateGatewayInfo1();
+    uint32_t duration = 900000;
+    ActiveGatewayList list = ActiveGatewayList();
+    ot::TimeMilli nextTime;
+
+    printf("\nTest 10: Test ActiveGatewayList reports time of the next gateway expiration\n");
+    SetNow(TIMER_STARTUP_TIME);
+    list.Add(gateway1.GetGatewayId(), gateway1.GetGatewayAddress(), duration);
+    SetNow(TIMER_STARTUP_TIME + 1000);
+    nextTime = ot::TimerMilli::GetNow().GetDistantFuture();
+    SuccessOrQuit(list.HandleTimer(nextTime), "ActiveGatewayList::HandleTimer() failed");
+    VerifyOrQuit(nextTime == ot::TimeMilli(TIMER_STARTUP_TIME + duration + 1), "Next expiration time is incorrect");
+    SetNow(TIMER_STARTUP_TIME + duration + 1);
+    nextTime = ot::TimerMilli::GetNow().GetDistantFuture();
+    SuccessOrQuit(list.HandleTimer(nextTime), "ActiveGatewayList::HandleTimer() failed");
+    VerifyOrQuit(list.GetList().Size() == 0, "GatewayInfo not removed");
+    VerifyOrQuit(nextTime == ot::TimerMilli::GetNow().GetDistantFuture(), "Next expiration time changed for empty list");
+}
+
 int main(void)
 {
     InitTestTimer();
@@ -292,6 +314,7 @@ int main(void)
     TestListAddToFullListAfterRemove();
     TestActiveGatewayListInfoNotRemovedBeforeKeepaliveTimeout();
     TestActiveGatewayListInfoRemovedAfterKeepaliveTimeout();
+    TestActiveGatewayListReportsNextExpiration();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -171,6 +171,30 @@ void ReadAndVerifyContent(NcpFrameBuffer &aNcpBuffer, const uint8_t *aContentBuf
     }
 }
 
+// Reads spans from the ncp buffer, and verifies that they match with the given content buffer.
+void ReadAndVerifyContentBySpans(NcpFrameBuffer &aNcpBuffer, const uint8_t *aContentBuffer, uint16_t aBufferLength)
+{
+    const uint8_t *span;
+    uint16_t       spanLength;
+
+    while (aBufferLength > 0)
+    {
+        spanLength = aNcpBuffer.OutFrameGetSpan(span);
+        VerifyOrQuit(spanLength > 0, "Out frame ended before end of expected content.");
+
+        if (spanLength > aBufferLength)
+        {
+            spanLength = aBufferLength;
+        }
+
+        VerifyOrQuit(memcmp(span, aContentBuffer, spanLength) == 0, "Out frame span does not match expected content");
+
+        aNcpBuffer.OutFrameSkip(spanLength);
+        aContentBuffer += spanLength;
+        aBufferLength -= spanLength;
+    }
+}
+
 void WriteTestFrame1(NcpFrameBuffer &aNcpBuffer, NcpFrameBuffer::Priority aPriority)
 {
     Message *       message;
@@ -858,6 +882,44 @@ void TestNcpFrameBuffer(void)
 
     printf(" -- PASS\n");
 
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\n Test 16: Read frames by spans");
+
+    for (j = 0; j < kTestIterationAttemps; j++)
+    {
+        const uint8_t *          span;
+        NcpFrameBuffer::Priority priority;
+
+        // Move the buffer pointers so that frames wrap around the buffer end at different positions.
+        priority = ((j % 2) == 0) ? NcpFrameBuffer::kPriorityHigh : NcpFrameBuffer::kPriorityLow;
+        ncpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow);
+        SuccessOrQuit(ncpBuffer.InFrameFeedData(sHexText, static_cast<uint16_t>(j % sizeof(sHexText) + 1)),
+                      "InFrameFeedData() failed.");
+        SuccessOrQuit(ncpBuffer.InFrameEnd(), "InFrameEnd() failed.");
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+
+        WriteTestFrame1(ncpBuffer, priority);
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed unexpectedly.");
+
+        if (priority == NcpFrameBuffer::kPriorityLow)
+        {
+            // Low priority segments are read in place.
+            VerifyOrQuit(ncpBuffer.OutFrameGetSpan(span) > 0, "OutFrameGetSpan() failed.");
+            VerifyOrQuit(buffer <= span && span < buffer + sizeof(buffer), "OutFrameGetSpan() span is not in buffer.");
+        }
+
+        ReadAndVerifyContentBySpans(ncpBuffer, sMottoText, sizeof(sMottoText));
+        ReadAndVerifyContentBySpans(ncpBuffer, sMysteryText, sizeof(sMysteryText));
+        ReadAndVerifyContentBySpans(ncpBuffer, sMottoText, sizeof(sMottoText));
+        ReadAndVerifyContentBySpans(ncpBuffer, sHelloText, sizeof(sHelloText));
+        VerifyOrQuit(ncpBuffer.OutFrameHasEnded() == true, "Frame longer than expected.");
+        VerifyOrQuit(ncpBuffer.OutFrameGetSpan(span) == 0, "OutFrameGetSpan() returned a span after end of frame.");
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+        VerifyOrQuit(ncpBuffer.IsEmpty() == true, "IsEmpty() failed.");
+    }
+
+    printf(" -- PASS\n");
+
     testFreeInstance(sInstance);
 }
 
@@ -940,7 +1002,14 @@ otError ReadRandomFrame(uint32_t aLength, NcpFrameBuffer &aNcpBuffer, uint8_t pr
     VerifyOrQuit(aNcpBuffer.OutFrameGetLength() == aLength, "OutFrameGetLength() does not match");
 
     // Read and verify that the content is same as sFrameBuffer values...
-    ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    if (GetRandom(2) == 0)
+    {
+        ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    }
+    else
+    {
+        ReadAndVerifyContentBySpans(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    }
     sExpectedRemovedTag = aNcpBuffer.OutFrameGetTag();
 
     SuccessOrQuit(aNcpBuffer.OutFrameRemove(), "OutFrameRemove failed");
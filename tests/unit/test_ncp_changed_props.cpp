@@ -0,0 +1,461 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/new.hpp"
+#include "ncp/ncp_base.hpp"
+#include "ncp/spinel_decoder.hpp"
+
+#include "test_util.hpp"
+
+namespace ot {
+namespace Ncp {
+
+// This module implements unit-test for batching of the unsolicited property
+// updates (`OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW`) in `NcpBase`.
+
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+
+enum
+{
+    kBatchWindow  = OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW,
+    kMaxFrameSize = OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE,
+    kMaxProps     = 16,
+};
+
+class TestNcp : public NcpBase
+{
+public:
+    explicit TestNcp(Instance *aInstance)
+        : NcpBase(aInstance)
+    {
+    }
+
+    void AddChangedProp(spinel_prop_key_t aPropKey)
+    {
+        mChangedPropsSet.AddProperty(aPropKey);
+        mUpdateChangedPropsTask.Post();
+    }
+
+    void AddChangedLastStatus(spinel_status_t aStatus)
+    {
+        mChangedPropsSet.AddLastStatus(aStatus);
+        mUpdateChangedPropsTask.Post();
+    }
+
+    bool HasChangedProps(void) const { return !mChangedPropsSet.IsEmpty(); }
+
+    bool IsTxBufferEmpty(void) const { return mTxFrameBuffer.IsEmpty(); }
+
+    // Fills the TX buffer with a frame of the given length (not a valid spinel frame).
+    void WriteFillerFrame(uint16_t aLength)
+    {
+        uint8_t filler[kMaxFrameSize];
+
+        memset(filler, 0, sizeof(filler));
+        mTxFrameBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow);
+        SuccessOrQuit(mTxFrameBuffer.InFrameFeedData(filler, aLength), "InFrameFeedData() failed");
+        SuccessOrQuit(mTxFrameBuffer.InFrameEnd(), "InFrameEnd() failed");
+    }
+
+    // Reads and removes the next frame from the TX buffer, returns zero if the buffer is empty.
+    uint16_t ReadFrame(uint8_t *aFrame)
+    {
+        uint16_t length = 0;
+
+        SuccessOrExit(mTxFrameBuffer.OutFrameBegin());
+
+        length = mTxFrameBuffer.OutFrameGetLength();
+        VerifyOrQuit(length <= kMaxFrameSize, "frame is larger than the TX buffer");
+        VerifyOrQuit(mTxFrameBuffer.OutFrameRead(length, aFrame) == length, "OutFrameRead() failed");
+        SuccessOrQuit(mTxFrameBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+
+    exit:
+        return length;
+    }
+};
+
+// The property updates read from a single spinel frame.
+struct ReportedProps
+{
+    unsigned int mCommand;
+    uint8_t      mNumProps;
+    unsigned int mPropKeys[kMaxProps];
+    uint8_t      mChannel;
+    uint16_t     mPanId;
+    uint8_t      mExtPanId[OT_EXT_PAN_ID_SIZE];
+};
+
+static uint32_t sNow;
+
+static uint32_t GetNow(void)
+{
+    return sNow;
+}
+
+static void AdvanceTime(Instance &aInstance, uint32_t aDuration)
+{
+    uint32_t end = sNow + aDuration;
+
+    otTaskletsProcess(&aInstance);
+
+    while (g_testPlatAlarmSet && g_testPlatAlarmNext <= end)
+    {
+        sNow = g_testPlatAlarmNext;
+        otPlatAlarmMilliFired(&aInstance);
+        otTaskletsProcess(&aInstance);
+    }
+
+    sNow = end;
+}
+
+static void ParsePropValue(SpinelDecoder &aDecoder, unsigned int aPropKey, ReportedProps &aProps)
+{
+    const uint8_t *data;
+    uint16_t       dataLen;
+
+    switch (aPropKey)
+    {
+    case SPINEL_PROP_PHY_CHAN:
+        SuccessOrQuit(aDecoder.ReadUint8(aProps.mChannel), "failed to parse PHY_CHAN");
+        break;
+
+    case SPINEL_PROP_MAC_15_4_PANID:
+        SuccessOrQuit(aDecoder.ReadUint16(aProps.mPanId), "failed to parse MAC_15_4_PANID");
+        break;
+
+    case SPINEL_PROP_NET_XPANID:
+        SuccessOrQuit(aDecoder.ReadData(data, dataLen), "failed to parse NET_XPANID");
+        VerifyOrQuit(dataLen == sizeof(aProps.mExtPanId), "NET_XPANID has wrong length");
+        memcpy(aProps.mExtPanId, data, dataLen);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void ParseFrame(const uint8_t *aFrame, uint16_t aLength, ReportedProps &aProps)
+{
+    SpinelDecoder decoder;
+    uint8_t       header;
+    unsigned int  propKey;
+
+    memset(&aProps, 0, sizeof(aProps));
+
+    decoder.Init(aFrame, aLength);
+
+    SuccessOrQuit(decoder.ReadUint8(header), "failed to parse the header");
+    VerifyOrQuit(SPINEL_HEADER_GET_TID(header) == 0, "unsolicited update has a non-zero TID");
+    SuccessOrQuit(decoder.ReadUintPacked(aProps.mCommand), "failed to parse the command");
+
+    if (aProps.mCommand == SPINEL_CMD_PROP_VALUE_IS)
+    {
+        SuccessOrQuit(decoder.ReadUintPacked(propKey), "failed to parse the property key");
+        aProps.mPropKeys[aProps.mNumProps++] = propKey;
+        ParsePropValue(decoder, propKey, aProps);
+    }
+    else
+    {
+        VerifyOrQuit(aProps.mCommand == SPINEL_CMD_PROP_VALUES_ARE, "unexpected spinel command");
+
+        // Each property is in its own `t(iD)` struct.
+
+        while (!decoder.IsAllRead())
+        {
+            VerifyOrQuit(aProps.mNumProps < kMaxProps, "too many properties in VALUES_ARE frame");
+            SuccessOrQuit(decoder.OpenStruct(), "failed to open the property struct");
+            SuccessOrQuit(decoder.ReadUintPacked(propKey), "failed to parse the property key");
+            aProps.mPropKeys[aProps.mNumProps++] = propKey;
+            ParsePropValue(decoder, propKey, aProps);
+            SuccessOrQuit(decoder.CloseStruct(), "failed to close the property struct");
+        }
+    }
+}
+
+static bool ReadReportedProps(TestNcp &aNcp, ReportedProps &aProps)
+{
+    uint8_t  frame[kMaxFrameSize];
+    uint16_t length = aNcp.ReadFrame(frame);
+
+    if (length != 0)
+    {
+        ParseFrame(frame, length, aProps);
+    }
+
+    return (length != 0);
+}
+
+static bool ContainsProp(const ReportedProps &aProps, spinel_prop_key_t aPropKey)
+{
+    bool contains = false;
+
+    for (uint8_t i = 0; i < aProps.mNumProps; i++)
+    {
+        if (aProps.mPropKeys[i] == static_cast<unsigned int>(aPropKey))
+        {
+            contains = true;
+            break;
+        }
+    }
+
+    return contains;
+}
+
+static OT_DEFINE_ALIGNED_VAR(sNcpRaw, sizeof(TestNcp), uint64_t);
+
+static TestNcp *InitTestNcp(Instance &aInstance)
+{
+    ReportedProps props;
+    TestNcp *     ncp;
+
+    sNow                  = 0;
+    g_testPlatAlarmGetNow = GetNow;
+
+    ncp = new (&sNcpRaw) TestNcp(&aInstance);
+
+    // Drain the initial RESET report and any updates from the instance initialization.
+
+    AdvanceTime(aInstance, kBatchWindow);
+
+    while (ReadReportedProps(*ncp, props))
+    {
+        AdvanceTime(aInstance, kBatchWindow);
+    }
+
+    VerifyOrQuit(!ncp->HasChangedProps(), "changed props set is not empty after initialization");
+
+    return ncp;
+}
+
+void TestNcpChangedPropsBatch(void)
+{
+    Instance *    instance;
+    TestNcp *     ncp;
+    ReportedProps props;
+    bool          didReadLastStatus = false;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null instance");
+
+    ncp = InitTestNcp(*instance);
+
+    printf("TestNcpChangedPropsBatch");
+
+    ncp->AddChangedProp(SPINEL_PROP_PHY_CHAN);
+    ncp->AddChangedLastStatus(SPINEL_STATUS_NOMEM);
+    ncp->AddChangedProp(SPINEL_PROP_MAC_15_4_PANID);
+
+    // Nothing is sent until the batching window expires.
+
+    AdvanceTime(*instance, kBatchWindow - 1);
+    VerifyOrQuit(ncp->IsTxBufferEmpty(), "sent an update before the batching window expired");
+
+    ncp->AddChangedProp(SPINEL_PROP_NET_XPANID);
+
+    AdvanceTime(*instance, 1);
+
+    VerifyOrQuit(!ncp->HasChangedProps(), "changed props set is not empty after the batching window");
+
+    // The properties go out in a single `VALUES_ARE` frame, `LAST_STATUS` in a separate `VALUE_IS` frame.
+
+    VerifyOrQuit(ReadReportedProps(*ncp, props), "no frame after the batching window");
+    VerifyOrQuit(props.mCommand == SPINEL_CMD_PROP_VALUES_ARE, "batch is not a VALUES_ARE frame");
+    VerifyOrQuit(props.mNumProps == 3, "VALUES_ARE frame has wrong number of properties");
+    VerifyOrQuit(ContainsProp(props, SPINEL_PROP_PHY_CHAN), "PHY_CHAN is missing from VALUES_ARE frame");
+    VerifyOrQuit(ContainsProp(props, SPINEL_PROP_MAC_15_4_PANID), "MAC_15_4_PANID is missing from VALUES_ARE frame");
+    VerifyOrQuit(ContainsProp(props, SPINEL_PROP_NET_XPANID), "NET_XPANID is missing from VALUES_ARE frame");
+    VerifyOrQuit(!ContainsProp(props, SPINEL_PROP_LAST_STATUS), "LAST_STATUS is in VALUES_ARE frame");
+
+    VerifyOrQuit(props.mChannel == otLinkGetChannel(instance), "PHY_CHAN value is wrong");
+    VerifyOrQuit(props.mPanId == otLinkGetPanId(instance), "MAC_15_4_PANID value is wrong");
+    VerifyOrQuit(memcmp(props.mExtPanId, otThreadGetExtendedPanId(instance), sizeof(props.mExtPanId)) == 0,
+                 "NET_XPANID value is wrong");
+
+    while (ReadReportedProps(*ncp, props))
+    {
+        VerifyOrQuit(props.mCommand == SPINEL_CMD_PROP_VALUE_IS, "unexpected second batch frame");
+        VerifyOrQuit(ContainsProp(props, SPINEL_PROP_LAST_STATUS), "unexpected VALUE_IS frame");
+        didReadLastStatus = true;
+    }
+
+    VerifyOrQuit(didReadLastStatus, "LAST_STATUS was not sent");
+
+    // A single property is sent as a regular `VALUE_IS` frame.
+
+    ncp->AddChangedProp(SPINEL_PROP_PHY_CHAN);
+    AdvanceTime(*instance, kBatchWindow);
+
+    VerifyOrQuit(ReadReportedProps(*ncp, props), "no frame after the batching window");
+    VerifyOrQuit(props.mCommand == SPINEL_CMD_PROP_VALUE_IS, "single property is not sent as VALUE_IS");
+    VerifyOrQuit(ContainsProp(props, SPINEL_PROP_PHY_CHAN), "PHY_CHAN is missing from VALUE_IS frame");
+    VerifyOrQuit(props.mChannel == otLinkGetChannel(instance), "PHY_CHAN value is wrong");
+    VerifyOrQuit(!ReadReportedProps(*ncp, props), "unexpected extra frame");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestNcpChangedPropsBatchWaitsForSpace(void)
+{
+    Instance *    instance;
+    TestNcp *     ncp;
+    ReportedProps props;
+    uint8_t       frame[kMaxFrameSize];
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null instance");
+
+    ncp = InitTestNcp(*instance);
+
+    printf("TestNcpChangedPropsBatchWaitsForSpace");
+
+    // Leave too little space for the batch in a non-empty buffer.
+
+    ncp->WriteFillerFrame(kMaxFrameSize / 2);
+
+    ncp->AddChangedProp(SPINEL_PROP_NET_MASTER_KEY);
+    ncp->AddChangedProp(SPINEL_PROP_NET_PSKC);
+    ncp->AddChangedProp(SPINEL_PROP_NET_XPANID);
+    AdvanceTime(*instance, kBatchWindow);
+
+    VerifyOrQuit(ncp->HasChangedProps(), "changed props were sent while the batch did not fit");
+
+    // Removing the filler frame frees up space and the batch is sent.
+
+    VerifyOrQuit(ncp->ReadFrame(frame) == kMaxFrameSize / 2, "failed to remove the filler frame");
+
+    VerifyOrQuit(!ncp->HasChangedProps(), "changed props were not sent after the buffer space became available");
+    VerifyOrQuit(ReadReportedProps(*ncp, props), "no frame after the buffer space became available");
+    VerifyOrQuit(props.mCommand == SPINEL_CMD_PROP_VALUES_ARE, "batch is not a VALUES_ARE frame");
+    VerifyOrQuit(props.mNumProps == 3, "VALUES_ARE frame has wrong number of properties");
+    VerifyOrQuit(!ReadReportedProps(*ncp, props), "unexpected extra frame");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestNcpChangedPropsBatchFallback(void)
+{
+    static const spinel_prop_key_t kProps[] = {
+        SPINEL_PROP_NET_MASTER_KEY,
+        SPINEL_PROP_NET_PSKC,
+        SPINEL_PROP_PHY_CHAN_SUPPORTED,
+        SPINEL_PROP_NET_XPANID,
+        SPINEL_PROP_NET_NETWORK_NAME,
+        SPINEL_PROP_MAC_15_4_PANID,
+        SPINEL_PROP_PHY_CHAN,
+        SPINEL_PROP_NET_ROLE,
+        SPINEL_PROP_NET_PARTITION_ID,
+        SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER,
+    };
+
+    Instance *    instance;
+    TestNcp *     ncp;
+    ReportedProps props;
+    uint8_t       numReported[OT_ARRAY_LENGTH(kProps)];
+    uint16_t      numFrames = 0;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null instance");
+
+    ncp = InitTestNcp(*instance);
+
+    printf("TestNcpChangedPropsBatchFallback");
+
+    memset(numReported, 0, sizeof(numReported));
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kProps); i++)
+    {
+        ncp->AddChangedProp(kProps[i]);
+    }
+
+    AdvanceTime(*instance, kBatchWindow);
+
+    // The batch does not fit in the empty buffer, so the properties are
+    // sent in separate frames (the ones left over once the buffer drains
+    // may still be batched).
+
+    while (ReadReportedProps(*ncp, props))
+    {
+        if (numFrames == 0)
+        {
+            VerifyOrQuit(props.mCommand == SPINEL_CMD_PROP_VALUE_IS, "did not fall back to separate frames");
+        }
+
+        numFrames++;
+
+        for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kProps); i++)
+        {
+            if (ContainsProp(props, kProps[i]))
+            {
+                numReported[i]++;
+            }
+        }
+
+        otTaskletsProcess(instance);
+    }
+
+    VerifyOrQuit(!ncp->HasChangedProps(), "changed props were not all sent");
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kProps); i++)
+    {
+        VerifyOrQuit(numReported[i] == 1, "property was not reported exactly once");
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+
+} // namespace Ncp
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_BATCH_WINDOW
+    ot::Ncp::TestNcpChangedPropsBatch();
+    ot::Ncp::TestNcpChangedPropsBatchWaitsForSpace();
+    ot::Ncp::TestNcpChangedPropsBatchFallback();
+#endif
+    printf("\nAll tests passed\n");
+    return 0;
+}
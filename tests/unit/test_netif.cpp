@@ -82,6 +82,7 @@ void VerifyMulticastAddressList(const Ip6::Netif &aNetif, Ip6::Address aAddresse
     }
 
     VerifyOrQuit(count == aLength, "Expected address is missing from Netif address list");
+    VerifyOrQuit(aNetif.GetMulticastAddressCount() == aLength, "GetMulticastAddressCount() failed");
 }
 
 void TestNetifMulticastAddresses(void)
@@ -205,11 +206,152 @@ void TestNetifMulticastAddresses(void)
     }
 }
 
+void TestNetifUnicastAddresses(void)
+{
+    const uint8_t kNumAddresses = 64;
+
+    Instance *               instance = testInitInstance();
+    TestNetif                netif(*instance);
+    Ip6::NetifUnicastAddress addresses[kNumAddresses];
+    Ip6::NetifUnicastAddress external;
+    Ip6::Address             address;
+
+    // Use more addresses than the filter has counters, so that lookups also see shared counters.
+    for (uint8_t i = 0; i < kNumAddresses; i++)
+    {
+        addresses[i].Clear();
+        addresses[i].GetAddress().FromString("fd00::1");
+        addresses[i].GetAddress().mFields.m8[15] = i;
+        addresses[i].mPrefixLength               = 64;
+    }
+
+    for (uint8_t i = 0; i < kNumAddresses; i += 2)
+    {
+        SuccessOrQuit(netif.AddUnicastAddress(addresses[i]), "AddUnicastAddress() failed");
+    }
+
+    VerifyOrQuit(netif.GetUnicastAddressCount() == kNumAddresses / 2, "GetUnicastAddressCount() failed");
+
+    for (uint8_t i = 0; i < kNumAddresses; i++)
+    {
+        VerifyOrQuit(netif.IsUnicastAddress(addresses[i].GetAddress()) == ((i % 2) == 0), "IsUnicastAddress() failed");
+    }
+
+    for (uint8_t i = 0; i < kNumAddresses; i += 4)
+    {
+        SuccessOrQuit(netif.RemoveUnicastAddress(addresses[i]), "RemoveUnicastAddress() failed");
+    }
+
+    VerifyOrQuit(netif.GetUnicastAddressCount() == kNumAddresses / 4, "GetUnicastAddressCount() failed");
+
+    for (uint8_t i = 0; i < kNumAddresses; i++)
+    {
+        VerifyOrQuit(netif.IsUnicastAddress(addresses[i].GetAddress()) == ((i % 4) == 2), "IsUnicastAddress() failed");
+    }
+
+    external.Clear();
+    external.GetAddress().FromString("fd00:1234::1");
+    external.mPrefixLength = 64;
+    SuccessOrQuit(netif.AddExternalUnicastAddress(external), "AddExternalUnicastAddress() failed");
+    SuccessOrQuit(netif.AddExternalUnicastAddress(external), "AddExternalUnicastAddress() failed to update");
+    VerifyOrQuit(netif.IsUnicastAddress(external.GetAddress()), "IsUnicastAddress() failed for external address");
+    VerifyOrQuit(netif.GetUnicastAddressCount() == kNumAddresses / 4 + 1, "GetUnicastAddressCount() failed");
+
+    address.FromString("fd00:1234::1");
+    SuccessOrQuit(netif.RemoveExternalUnicastAddress(address), "RemoveExternalUnicastAddress() failed");
+    VerifyOrQuit(!netif.IsUnicastAddress(address), "IsUnicastAddress() failed after removing external address");
+
+    for (uint8_t i = 2; i < kNumAddresses; i += 4)
+    {
+        SuccessOrQuit(netif.RemoveUnicastAddress(addresses[i]), "RemoveUnicastAddress() failed");
+    }
+
+    VerifyOrQuit(netif.GetUnicastAddressCount() == 0, "GetUnicastAddressCount() failed");
+    VerifyOrQuit(netif.GetUnicastAddresses() == NULL, "GetUnicastAddresses() failed");
+
+    testFreeInstance(instance);
+}
+
+void TestNetifAddressChangedInPlace(void)
+{
+    Instance *                 instance = testInitInstance();
+    TestNetif                  netif(*instance);
+    Ip6::NetifUnicastAddress   unicast;
+    Ip6::NetifMulticastAddress multicast;
+    Ip6::Address               oldAddress;
+
+    // Re-adding an entry that was changed in place (e.g., the Border Agent Commissioner ALOC)
+    // must leave the lookup filters in sync with the address lists.
+
+    unicast.Clear();
+    unicast.GetAddress().FromString("fd00::ff:fe00:fc30");
+    unicast.mPrefixLength = 64;
+    oldAddress            = unicast.GetAddress();
+
+    SuccessOrQuit(netif.AddUnicastAddress(unicast), "AddUnicastAddress() failed");
+    unicast.GetAddress().FromString("fd00::ff:fe00:fc35");
+    VerifyOrQuit(netif.AddUnicastAddress(unicast) == OT_ERROR_ALREADY, "AddUnicastAddress() did not fail");
+
+    VerifyOrQuit(netif.IsUnicastAddress(unicast.GetAddress()), "IsUnicastAddress() failed for changed address");
+    VerifyOrQuit(!netif.IsUnicastAddress(oldAddress), "IsUnicastAddress() succeeded for old address");
+    VerifyOrQuit(netif.GetUnicastAddressCount() == 1, "GetUnicastAddressCount() failed");
+
+    SuccessOrQuit(netif.RemoveUnicastAddress(unicast), "RemoveUnicastAddress() failed");
+    VerifyOrQuit(netif.GetUnicastAddressCount() == 0, "GetUnicastAddressCount() failed");
+    VerifyOrQuit(!netif.IsUnicastAddress(unicast.GetAddress()), "IsUnicastAddress() failed after remove");
+
+    multicast.GetAddress().FromString("ff03::114");
+    oldAddress = multicast.GetAddress();
+
+    SuccessOrQuit(netif.SubscribeMulticast(multicast), "SubscribeMulticast() failed");
+    multicast.GetAddress().FromString("ff03::115");
+    VerifyOrQuit(netif.SubscribeMulticast(multicast) == OT_ERROR_ALREADY, "SubscribeMulticast() did not fail");
+
+    VerifyOrQuit(netif.IsMulticastSubscribed(multicast.GetAddress()), "IsMulticastSubscribed() failed");
+    VerifyOrQuit(!netif.IsMulticastSubscribed(oldAddress), "IsMulticastSubscribed() succeeded for old address");
+
+    SuccessOrQuit(netif.UnsubscribeMulticast(multicast), "UnsubscribeMulticast() failed");
+    VerifyOrQuit(netif.GetMulticastAddressCount() == 0, "GetMulticastAddressCount() failed");
+
+    testFreeInstance(instance);
+}
+
+void TestNetifAddressFilter(void)
+{
+    Ip6::NetifAddressFilter filter;
+    Ip6::Address            address;
+
+    address.FromString("fd00::ff:fe00:fc30");
+
+    // Removing an address which was not added asks for a rebuild instead of underflowing.
+    VerifyOrQuit(!filter.Remove(address), "Remove() succeeded on an empty filter");
+    VerifyOrQuit(filter.GetCount() == 0, "GetCount() failed after Remove() on an empty filter");
+    VerifyOrQuit(!filter.MayContain(address), "MayContain() failed after Remove() on an empty filter");
+
+    filter.Add(address);
+    VerifyOrQuit(filter.MayContain(address), "MayContain() failed after Add()");
+    VerifyOrQuit(filter.Remove(address), "Remove() failed");
+    VerifyOrQuit(!filter.MayContain(address), "MayContain() failed after Remove()");
+
+    // A saturated counter keeps reporting the address and asks for a rebuild on removal.
+    for (uint16_t i = 0; i < 300; i++)
+    {
+        filter.Add(address);
+    }
+
+    VerifyOrQuit(filter.GetCount() == 300, "GetCount() failed after saturating a counter");
+    VerifyOrQuit(!filter.Remove(address), "Remove() succeeded on a saturated counter");
+    VerifyOrQuit(filter.MayContain(address), "MayContain() failed after Remove() on a saturated counter");
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestNetifMulticastAddresses();
+    ot::TestNetifUnicastAddresses();
+    ot::TestNetifAddressChangedInPlace();
+    ot::TestNetifAddressFilter();
     printf("All tests passed\n");
     return 0;
 }
@@ -47,6 +47,8 @@ testPlatRadioReceive            g_testPlatRadioReceive            = NULL;
 testPlatRadioTransmit           g_testPlatRadioTransmit           = NULL;
 testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer  = NULL;
 
+testPlatSettingsGet g_testPlatSettingsGet = NULL;
+
 void testPlatResetToDefaults(void)
 {
     g_testPlatAlarmSet     = false;
@@ -65,6 +67,8 @@ void testPlatResetToDefaults(void)
     g_testPlatRadioReceive            = NULL;
     g_testPlatRadioTransmit           = NULL;
     g_testPlatRadioGetTransmitBuffer  = NULL;
+
+    g_testPlatSettingsGet = NULL;
 }
 
 ot::Instance *testInitInstance(void)
@@ -382,6 +386,13 @@ otError otPlatRadioEnergyScan(otInstance *, uint8_t, uint16_t)
     return OT_ERROR_NOT_IMPLEMENTED;
 }
 
+otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aPower);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -389,11 +400,45 @@ otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
     return OT_ERROR_NOT_IMPLEMENTED;
 }
 
+otError otPlatRadioGetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t *aThreshold)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aThreshold);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otPlatRadioSetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t aThreshold)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aThreshold);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
     return 0;
 }
+
+otError otPlatRadioSetCoexEnabled(otInstance *aInstance, bool aEnabled)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aEnabled);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+bool otPlatRadioIsCoexEnabled(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return false;
+}
+
+otError otPlatRadioGetCoexMetrics(otInstance *aInstance, otRadioCoexMetrics *aCoexMetrics)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aCoexMetrics);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
 //
 // Random
 //
@@ -500,13 +545,14 @@ void otPlatSettingsDeinit(otInstance *aInstance)
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-    OT_UNUSED_VARIABLE(aKey);
-    OT_UNUSED_VARIABLE(aIndex);
-    OT_UNUSED_VARIABLE(aValue);
-    OT_UNUSED_VARIABLE(aValueLength);
+    otError error = OT_ERROR_NOT_FOUND;
 
-    return OT_ERROR_NOT_FOUND;
+    if (g_testPlatSettingsGet)
+    {
+        error = g_testPlatSettingsGet(aInstance, aKey, aIndex, aValue, aValueLength);
+    }
+
+    return error;
 }
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
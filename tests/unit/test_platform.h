@@ -83,6 +83,14 @@ extern testPlatRadioReceive            g_testPlatRadioReceive;
 extern testPlatRadioTransmit           g_testPlatRadioTransmit;
 extern testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer;
 
+//
+// Settings Platform
+//
+
+typedef otError (*testPlatSettingsGet)(otInstance *, uint16_t, int, uint8_t *, uint16_t *);
+
+extern testPlatSettingsGet g_testPlatSettingsGet;
+
 ot::Instance *testInitInstance(void);
 void          testFreeInstance(otInstance *aInstance);
 
@@ -0,0 +1,462 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+#include "platform-posix.h"
+
+#include "radio_spinel.hpp"
+
+#include <poll.h>
+#include <pty.h>
+#include <unistd.h>
+
+#include <openthread/platform/misc.h>
+
+#include "common/code_utils.hpp"
+#include "ncp/hdlc.hpp"
+#include "ncp/spinel.h"
+
+#include "test_util.hpp"
+
+namespace ot {
+namespace PosixApp {
+
+// This module implements unit-test for handling of `SPINEL_CMD_PROP_VALUES_ARE`
+// notifications and of asynchronous source match requests in `RadioSpinel`.
+
+enum
+{
+    kMaxFrameSize  = 64,
+    kNumTids       = SPINEL_HEADER_GET_TID(SPINEL_HEADER_TID_MASK), ///< Transaction ids usable by requests.
+    kShortAddress  = 0x1000,
+    kRcpWaitTimeMs = 1000,
+};
+
+class TestRadioSpinel
+{
+public:
+    TestRadioSpinel(void)
+        : mRadioSpinel()
+    {
+    }
+
+    void ReceiveFrame(const uint8_t *aFrame, uint16_t aLength)
+    {
+        SuccessOrQuit(mRadioSpinel.mRxFrameBuffer.WriteBytes(aFrame, aLength), "WriteBytes() failed");
+        mRadioSpinel.HandleReceivedFrame();
+    }
+
+    void ProcessFrameQueue(void) { mRadioSpinel.ProcessFrameQueue(); }
+
+    bool HasSavedFrame(void) const { return mRadioSpinel.mRxFrameBuffer.HasSavedFrame(); }
+    bool HasFrame(void) const { return mRadioSpinel.mRxFrameBuffer.HasFrame(); }
+
+    bool IsReady(void) const { return mRadioSpinel.mIsReady; }
+    void SetReady(void) { mRadioSpinel.mIsReady = true; }
+    void ClearReady(void) { mRadioSpinel.mIsReady = false; }
+
+    void InitInterface(const char *aRadioFile)
+    {
+        otPlatformConfig config;
+
+        memset(&config, 0, sizeof(config));
+        config.mRadioFile = aRadioFile;
+        SuccessOrQuit(mRadioSpinel.mSpinelInterface.Init(config), "Init() failed");
+    }
+
+    otError AddSrcMatchShortEntry(uint16_t aShortAddress) { return mRadioSpinel.AddSrcMatchShortEntry(aShortAddress); }
+    otError ClearSrcMatchShortEntry(uint16_t aShortAddress)
+    {
+        return mRadioSpinel.ClearSrcMatchShortEntry(aShortAddress);
+    }
+
+    spinel_tid_t GetNextTid(void) const { return mRadioSpinel.mCmdNextTid; }
+    bool         IsTidInUse(spinel_tid_t aTid) const { return (mRadioSpinel.mCmdTidsInUse & (1 << aTid)) != 0; }
+    bool         HasSrcMatchFailed(void) const { return mRadioSpinel.mSrcMatchFailed; }
+
+    // Lets all asynchronous requests in flight time out.
+    void ExpireAsyncRequests(void)
+    {
+        for (spinel_tid_t tid = 0; tid < RadioSpinel::kMaxTids; tid++)
+        {
+            mRadioSpinel.mAsyncRequests[tid].mTimeout = 0;
+        }
+
+        mRadioSpinel.ExpireAsyncRequests();
+    }
+
+    void ProcessAsyncRequests(void) { mRadioSpinel.ProcessAsyncRequests(); }
+
+private:
+    RadioSpinel mRadioSpinel;
+};
+
+static TestRadioSpinel sRadio;
+static int             sRcpFd = -1; ///< The RCP end of the pseudo terminal `sRadio` talks to.
+static int             sRadioFd;    ///< The end `sRadio` opens, held so the terminal stays up.
+
+static uint16_t PackLastStatus(uint8_t *aBuffer, spinel_status_t aStatus)
+{
+    spinel_ssize_t length = spinel_datatype_pack(aBuffer, kMaxFrameSize, SPINEL_DATATYPE_UINT_PACKED_S, aStatus);
+
+    VerifyOrQuit(length > 0, "failed to pack LAST_STATUS");
+
+    return static_cast<uint16_t>(length);
+}
+
+// Packs a `VALUES_ARE` frame with two `t(iD)` structs.
+static uint16_t PackValuesAre(uint8_t *         aFrame,
+                              spinel_prop_key_t aKey1,
+                              const uint8_t *   aValue1,
+                              uint16_t          aValue1Length,
+                              spinel_prop_key_t aKey2,
+                              const uint8_t *   aValue2,
+                              uint16_t          aValue2Length)
+{
+    spinel_ssize_t length;
+
+    length = spinel_datatype_pack(aFrame, kMaxFrameSize, "Cit(iD)t(iD)", SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0,
+                                  SPINEL_CMD_PROP_VALUES_ARE, aKey1, aValue1, aValue1Length, aKey2, aValue2,
+                                  aValue2Length);
+    VerifyOrQuit(length > 0, "failed to pack VALUES_ARE frame");
+
+    return static_cast<uint16_t>(length);
+}
+
+static uint16_t PackResponse(uint8_t *         aFrame,
+                             spinel_tid_t      aTid,
+                             uint32_t          aCommand,
+                             spinel_prop_key_t aKey,
+                             const uint8_t *   aValue,
+                             uint16_t          aValueLength)
+{
+    spinel_ssize_t length;
+
+    length = spinel_datatype_pack(aFrame, kMaxFrameSize, "CiiD", SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | aTid,
+                                  aCommand, aKey, aValue, aValueLength);
+    VerifyOrQuit(length > 0, "failed to pack response frame");
+
+    return static_cast<uint16_t>(length);
+}
+
+static uint16_t PackValueIs(uint8_t *aFrame, spinel_prop_key_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    return PackResponse(aFrame, 0, SPINEL_CMD_PROP_VALUE_IS, aKey, aValue, aValueLength);
+}
+
+static void OpenRcp(void)
+{
+    char name[64];
+
+    VerifyOrExit(sRcpFd == -1);
+
+    VerifyOrQuit(openpty(&sRcpFd, &sRadioFd, name, NULL, NULL) == 0, "openpty() failed");
+    sRadio.InitInterface(name);
+    sRadio.SetReady();
+
+exit:
+    return;
+}
+
+static void HandleRcpFrame(void *aContext, otError aError)
+{
+    SuccessOrQuit(aError, "RCP received a malformed frame");
+    *static_cast<bool *>(aContext) = true;
+}
+
+// Reads the next frame `sRadio` sent to the RCP.
+static uint16_t ReadRcpFrame(uint8_t *aFrame)
+{
+    Hdlc::FrameBuffer<kMaxFrameSize> frameBuffer;
+    bool                             received = false;
+    Hdlc::Decoder                    decoder(frameBuffer, HandleRcpFrame, &received);
+    struct pollfd                    pollFd;
+    uint8_t                          byte;
+
+    pollFd.fd     = sRcpFd;
+    pollFd.events = POLLIN;
+
+    while (!received)
+    {
+        VerifyOrQuit(poll(&pollFd, 1, kRcpWaitTimeMs) == 1, "RCP received no frame");
+        VerifyOrQuit(read(sRcpFd, &byte, sizeof(byte)) == sizeof(byte), "read() failed");
+        decoder.Decode(&byte, sizeof(byte));
+    }
+
+    memcpy(aFrame, frameBuffer.GetFrame(), frameBuffer.GetLength());
+
+    return frameBuffer.GetLength();
+}
+
+// Reads the next frame `sRadio` sent to the RCP and checks its command and property.
+static spinel_tid_t ReadRcpRequest(uint32_t aCommand, spinel_prop_key_t aKey)
+{
+    uint8_t        frame[kMaxFrameSize];
+    uint16_t       length = ReadRcpFrame(frame);
+    uint8_t        header;
+    unsigned int   command;
+    unsigned int   key;
+    spinel_ssize_t unpacked;
+
+    unpacked = spinel_datatype_unpack(frame, length, "Cii", &header, &command, &key);
+    VerifyOrQuit(unpacked > 0, "RCP received a malformed request");
+    VerifyOrQuit(command == aCommand && key == aKey, "RCP received an unexpected request");
+
+    return SPINEL_HEADER_GET_TID(header);
+}
+
+// Queues a frame for `sRadio` to read from the RCP.
+static void WriteRcpFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    Hdlc::FrameBuffer<kMaxFrameSize * 2> frameBuffer;
+    Hdlc::Encoder                        encoder(frameBuffer);
+
+    SuccessOrQuit(encoder.BeginFrame(), "BeginFrame() failed");
+    SuccessOrQuit(encoder.Encode(aFrame, aLength), "Encode() failed");
+    SuccessOrQuit(encoder.EndFrame(), "EndFrame() failed");
+    VerifyOrQuit(write(sRcpFd, frameBuffer.GetFrame(), frameBuffer.GetLength()) == frameBuffer.GetLength(),
+                 "write() failed");
+}
+
+static uint16_t PackSrcMatchResponse(uint8_t *aFrame, spinel_tid_t aTid, uint32_t aCommand, uint16_t aShortAddress)
+{
+    uint8_t value[sizeof(uint16_t)];
+
+    value[0] = static_cast<uint8_t>(aShortAddress & 0xff);
+    value[1] = static_cast<uint8_t>(aShortAddress >> 8);
+
+    return PackResponse(aFrame, aTid, aCommand, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, value, sizeof(value));
+}
+
+// Checks that a failed source match table update makes `sRadio` disable source matching.
+static void VerifySrcMatchDisabled(void)
+{
+    uint8_t      frame[kMaxFrameSize];
+    uint8_t      status[kMaxFrameSize];
+    uint16_t     statusLength = PackLastStatus(status, SPINEL_STATUS_OK);
+    spinel_tid_t tid          = sRadio.GetNextTid();
+
+    VerifyOrQuit(sRadio.HasSrcMatchFailed(), "failed source match table update was not noted");
+
+    // The fallback waits for the response, so it is queued before.
+    WriteRcpFrame(frame, PackResponse(frame, tid, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, status,
+                                      statusLength));
+    sRadio.ProcessAsyncRequests();
+
+    VerifyOrQuit(ReadRcpRequest(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_SRC_MATCH_ENABLED) == tid,
+                 "source match was not disabled");
+    VerifyOrQuit(!sRadio.HasSrcMatchFailed(), "source match was disabled twice");
+    VerifyOrQuit(!sRadio.IsTidInUse(tid), "transaction id was not released");
+}
+
+void TestRadioSpinelValuesAre(void)
+{
+    uint8_t  frame[kMaxFrameSize];
+    uint8_t  okStatus[kMaxFrameSize];
+    uint8_t  resetStatus[kMaxFrameSize];
+    uint16_t okStatusLength;
+    uint16_t resetStatusLength;
+    uint16_t length;
+
+    printf("TestRadioSpinelValuesAre");
+
+    okStatusLength    = PackLastStatus(okStatus, SPINEL_STATUS_OK);
+    resetStatusLength = PackLastStatus(resetStatus, SPINEL_STATUS_RESET_POWER_ON);
+
+    // A batch of properties which are all safe to handle is handled right away.
+
+    length = PackValuesAre(frame, SPINEL_PROP_LAST_STATUS, okStatus, okStatusLength, SPINEL_PROP_LAST_STATUS,
+                           resetStatus, resetStatusLength);
+    sRadio.ReceiveFrame(frame, length);
+
+    VerifyOrQuit(sRadio.IsReady(), "RESET in VALUES_ARE frame was not handled");
+    VerifyOrQuit(!sRadio.HasSavedFrame(), "saved a VALUES_ARE frame which was safe to handle");
+    VerifyOrQuit(!sRadio.HasFrame(), "VALUES_ARE frame was not removed");
+
+    // A malformed batch is dropped.
+
+    sRadio.ClearReady();
+    sRadio.ReceiveFrame(frame, length - 1);
+
+    VerifyOrQuit(!sRadio.IsReady(), "handled a malformed VALUES_ARE frame");
+    VerifyOrQuit(!sRadio.HasSavedFrame(), "saved a malformed VALUES_ARE frame");
+    VerifyOrQuit(!sRadio.HasFrame(), "malformed VALUES_ARE frame was not removed");
+
+    printf(" -- PASS\n");
+}
+
+void TestRadioSpinelValuesAreSaveAndReplay(void)
+{
+    static const uint8_t kRawFrame[] = {0x00};
+
+    uint8_t  frame[kMaxFrameSize];
+    uint8_t  resetStatus[kMaxFrameSize];
+    uint16_t resetStatusLength;
+    uint16_t length;
+
+    printf("TestRadioSpinelValuesAreSaveAndReplay");
+
+    resetStatusLength = PackLastStatus(resetStatus, SPINEL_STATUS_RESET_POWER_ON);
+
+    // A batch with a property which cannot be handled during `WaitResponse()`
+    // is saved as a whole, including the properties which could be handled now.
+
+    sRadio.ClearReady();
+
+    length = PackValuesAre(frame, SPINEL_PROP_STREAM_RAW, kRawFrame, sizeof(kRawFrame), SPINEL_PROP_LAST_STATUS,
+                           resetStatus, resetStatusLength);
+    sRadio.ReceiveFrame(frame, length);
+
+    VerifyOrQuit(sRadio.HasSavedFrame(), "VALUES_ARE frame with STREAM_RAW was not saved");
+    VerifyOrQuit(!sRadio.IsReady(), "handled a property of a saved VALUES_ARE frame");
+
+    // The saved batch is handled in order with the other saved frames once the queue is processed.
+
+    length = PackValueIs(frame, SPINEL_PROP_STREAM_RAW, kRawFrame, sizeof(kRawFrame));
+    sRadio.ReceiveFrame(frame, length);
+
+    VerifyOrQuit(sRadio.HasSavedFrame(), "VALUE_IS frame with STREAM_RAW was not saved");
+    VerifyOrQuit(!sRadio.IsReady(), "handled a property of a saved VALUES_ARE frame");
+
+    sRadio.ProcessFrameQueue();
+
+    VerifyOrQuit(sRadio.IsReady(), "RESET in saved VALUES_ARE frame was not handled");
+    VerifyOrQuit(!sRadio.HasSavedFrame(), "saved frames were not cleared");
+
+    printf(" -- PASS\n");
+}
+
+void TestRadioSpinelAsyncTidExhaustion(void)
+{
+    uint8_t      frame[kMaxFrameSize];
+    spinel_tid_t tids[kNumTids];
+    spinel_tid_t oldest;
+
+    printf("TestRadioSpinelAsyncTidExhaustion");
+
+    OpenRcp();
+
+    // Asynchronous requests may use all transaction ids.
+    for (uint16_t i = 0; i < kNumTids; i++)
+    {
+        SuccessOrQuit(sRadio.AddSrcMatchShortEntry(kShortAddress + i), "AddSrcMatchShortEntry() failed");
+        tids[i] = ReadRcpRequest(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+        VerifyOrQuit(sRadio.IsTidInUse(tids[i]), "transaction id was not allocated");
+    }
+
+    // The next request waits for the response to the oldest request and reuses its transaction id.
+    oldest = sRadio.GetNextTid();
+    VerifyOrQuit(oldest == tids[0], "oldest request does not hold the next transaction id");
+
+    WriteRcpFrame(frame, PackSrcMatchResponse(frame, oldest, SPINEL_CMD_PROP_VALUE_INSERTED, kShortAddress));
+    SuccessOrQuit(sRadio.AddSrcMatchShortEntry(kShortAddress + kNumTids), "AddSrcMatchShortEntry() failed");
+    tids[0] = ReadRcpRequest(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+    VerifyOrQuit(tids[0] == oldest, "request did not reuse the transaction id of the oldest request");
+
+    for (uint16_t i = 0; i < kNumTids; i++)
+    {
+        sRadio.ReceiveFrame(frame, PackSrcMatchResponse(frame, tids[i], SPINEL_CMD_PROP_VALUE_INSERTED,
+                                                        static_cast<uint16_t>(kShortAddress + i)));
+        VerifyOrQuit(!sRadio.IsTidInUse(tids[i]), "transaction id was not released");
+    }
+
+    VerifyOrQuit(!sRadio.HasSrcMatchFailed(), "successful source match table update was noted as failed");
+
+    printf(" -- PASS\n");
+}
+
+void TestRadioSpinelAsyncTimeout(void)
+{
+    spinel_tid_t tid;
+
+    printf("TestRadioSpinelAsyncTimeout");
+
+    OpenRcp();
+
+    // A removal which times out leaves source matching enabled.
+    SuccessOrQuit(sRadio.ClearSrcMatchShortEntry(kShortAddress), "ClearSrcMatchShortEntry() failed");
+    tid = ReadRcpRequest(SPINEL_CMD_PROP_VALUE_REMOVE, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+
+    sRadio.ExpireAsyncRequests();
+    VerifyOrQuit(!sRadio.IsTidInUse(tid), "transaction id was not released");
+    VerifyOrQuit(!sRadio.HasSrcMatchFailed(), "failed removal was noted");
+
+    // An insertion which times out disables source matching.
+    SuccessOrQuit(sRadio.AddSrcMatchShortEntry(kShortAddress), "AddSrcMatchShortEntry() failed");
+    tid = ReadRcpRequest(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+
+    sRadio.ExpireAsyncRequests();
+    VerifyOrQuit(!sRadio.IsTidInUse(tid), "transaction id was not released");
+    VerifySrcMatchDisabled();
+
+    printf(" -- PASS\n");
+}
+
+void TestRadioSpinelAsyncErrorResponse(void)
+{
+    uint8_t      frame[kMaxFrameSize];
+    uint8_t      status[kMaxFrameSize];
+    uint16_t     statusLength;
+    spinel_tid_t tid;
+
+    printf("TestRadioSpinelAsyncErrorResponse");
+
+    OpenRcp();
+
+    // An insertion the RCP rejects disables source matching.
+    SuccessOrQuit(sRadio.AddSrcMatchShortEntry(kShortAddress), "AddSrcMatchShortEntry() failed");
+    tid = ReadRcpRequest(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+
+    statusLength = PackLastStatus(status, SPINEL_STATUS_NOMEM);
+    sRadio.ReceiveFrame(
+        frame, PackResponse(frame, tid, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, status, statusLength));
+    VerifyOrQuit(!sRadio.IsTidInUse(tid), "transaction id was not released");
+    VerifySrcMatchDisabled();
+
+    printf(" -- PASS\n");
+}
+
+} // namespace PosixApp
+} // namespace ot
+
+// The POSIX platform library leaves `otPlatReset()` to the application.
+extern "C" void otPlatReset(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+int main(void)
+{
+    ot::PosixApp::TestRadioSpinelValuesAre();
+    ot::PosixApp::TestRadioSpinelValuesAreSaveAndReplay();
+    ot::PosixApp::TestRadioSpinelAsyncTidExhaustion();
+    ot::PosixApp::TestRadioSpinelAsyncTimeout();
+    ot::PosixApp::TestRadioSpinelAsyncErrorResponse();
+    printf("\nAll tests passed\n");
+    return 0;
+}
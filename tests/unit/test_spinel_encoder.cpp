@@ -26,8 +26,12 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sys/time.h>
+
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "ncp/spinel_buffer_encoder.hpp"
+#include "ncp/spinel_decoder.hpp"
 #include "ncp/spinel_encoder.hpp"
 
 #include "test_util.hpp"
@@ -357,12 +361,224 @@ void TestSpinelEncoder(void)
     printf(" -- PASS\n");
 }
 
+void TestSpinelBufferEncoder(void)
+{
+    uint8_t        buffer[kTestBufferSize];
+    uint8_t        expected[kTestBufferSize];
+    spinel_ssize_t expectedLen;
+
+    const bool         kBool     = true;
+    const uint8_t      kUint8    = 0x42;
+    const int8_t       kInt8     = -73;
+    const uint16_t     kUint16   = 0xabcd;
+    const uint32_t     kUint32   = 0xdeadbeef;
+    const unsigned int kUint_1   = 9;
+    const unsigned int kUint_2   = 0x8765;
+    const otExtAddress kEui64    = {{0x4f, 0x5e, 0x6d, 0x7c, 0x8b, 0x9a, 0xa9, 0xb8}};
+    const uint8_t      kData[]   = {0x10, 0x20, 0x30, 0x40, 0x50};
+    const uint16_t     kDataSize = sizeof(kData);
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest 6: Encoding to a flat buffer");
+
+    {
+        SpinelBufferEncoder encoder(buffer, sizeof(buffer));
+
+        SuccessOrQuit(encoder.WriteBool(kBool), "WriteBool() failed.");
+        SuccessOrQuit(encoder.WriteUint8(kUint8), "WriteUint8() failed.");
+        SuccessOrQuit(encoder.WriteInt8(kInt8), "WriteInt8() failed.");
+        SuccessOrQuit(encoder.WriteUint16(kUint16), "WriteUint16() failed.");
+        SuccessOrQuit(encoder.WriteUint32(kUint32), "WriteUint32() failed.");
+        SuccessOrQuit(encoder.WriteUintPacked(kUint_1), "WriteUintPacked() failed.");
+        SuccessOrQuit(encoder.WriteUintPacked(kUint_2), "WriteUintPacked() failed.");
+        SuccessOrQuit(encoder.WriteEui64(kEui64), "WriteEui64() failed.");
+        SuccessOrQuit(encoder.WriteDataWithLen(kData, kDataSize), "WriteDataWithLen() failed.");
+        SuccessOrQuit(encoder.WriteData(kData, kDataSize), "WriteData() failed.");
+
+        expectedLen = spinel_datatype_pack(
+            expected, sizeof(expected),
+            (SPINEL_DATATYPE_BOOL_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_UINT16_S
+                 SPINEL_DATATYPE_UINT32_S SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S
+                     SPINEL_DATATYPE_EUI64_S SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_S),
+            kBool, kUint8, kInt8, kUint16, kUint32, kUint_1, kUint_2, kEui64.m8, kData, kDataSize, kData, kDataSize);
+
+        VerifyOrQuit(expectedLen == encoder.GetLength(), "SpinelBufferEncoder length mismatch");
+        VerifyOrQuit(memcmp(encoder.GetFrame(), expected, encoder.GetLength()) == 0, "SpinelBufferEncoder mismatch");
+    }
+
+    // Writes which do not fit fail and leave the frame unchanged.
+    {
+        SpinelBufferEncoder encoder(buffer, 3);
+
+        SuccessOrQuit(encoder.WriteUint16(kUint16), "WriteUint16() failed.");
+        VerifyOrQuit(encoder.WriteUint16(kUint16) == OT_ERROR_NO_BUFS, "WriteUint16() did not fail.");
+        VerifyOrQuit(encoder.WriteUintPacked(kUint_2) == OT_ERROR_NO_BUFS, "WriteUintPacked() did not fail.");
+        VerifyOrQuit(encoder.WriteDataWithLen(kData, 0) == OT_ERROR_NO_BUFS, "WriteDataWithLen() did not fail.");
+        VerifyOrQuit(encoder.GetLength() == sizeof(uint16_t), "failed write changed the frame");
+        SuccessOrQuit(encoder.WriteUint8(kUint8), "WriteUint8() failed.");
+        VerifyOrQuit(encoder.WriteUint8(kUint8) == OT_ERROR_NO_BUFS, "WriteUint8() did not fail.");
+    }
+
+    printf(" -- PASS\n");
+}
+
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+/**
+ * Compare encoding a radio transmit request and decoding a radio receive frame through the format string based
+ * `spinel_datatype_pack()`/`spinel_datatype_unpack_in_place()` against `SpinelBufferEncoder`/`SpinelDecoder`.
+ */
+void TestSpinelEncodeDecodeBenchmark(void)
+{
+    const uint32_t kIterations = 200000;
+
+    uint8_t        psdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t        frame[kTestBufferSize];
+    uint16_t       frameLen;
+    struct timeval start;
+    uint32_t       packUsec;
+    uint32_t       encoderUsec;
+    uint32_t       unpackUsec;
+    uint32_t       decoderUsec;
+    uint32_t       sum = 0;
+
+    for (uint16_t i = 0; i < sizeof(psdu); i++)
+    {
+        psdu[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kIterations; n++)
+    {
+        spinel_ssize_t packed = spinel_datatype_pack(
+            frame, sizeof(frame),
+            (SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S
+                 SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S
+                     SPINEL_DATATYPE_BOOL_S),
+            SPINEL_HEADER_FLAG | 1, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW, psdu, sizeof(psdu), 11, 4, 3,
+            true);
+
+        sum += static_cast<uint32_t>(packed) + frame[n % packed];
+    }
+
+    packUsec = BenchmarkElapsedUsec(start);
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kIterations; n++)
+    {
+        SpinelBufferEncoder encoder(frame, sizeof(frame));
+
+        SuccessOrQuit(encoder.WriteUint8(SPINEL_HEADER_FLAG | 1), "WriteUint8() failed.");
+        SuccessOrQuit(encoder.WriteUintPacked(SPINEL_CMD_PROP_VALUE_SET), "WriteUintPacked() failed.");
+        SuccessOrQuit(encoder.WriteUintPacked(SPINEL_PROP_STREAM_RAW), "WriteUintPacked() failed.");
+        SuccessOrQuit(encoder.WriteDataWithLen(psdu, sizeof(psdu)), "WriteDataWithLen() failed.");
+        SuccessOrQuit(encoder.WriteUint8(11), "WriteUint8() failed.");
+        SuccessOrQuit(encoder.WriteUint8(4), "WriteUint8() failed.");
+        SuccessOrQuit(encoder.WriteUint8(3), "WriteUint8() failed.");
+        SuccessOrQuit(encoder.WriteBool(true), "WriteBool() failed.");
+
+        sum += encoder.GetLength() + frame[n % encoder.GetLength()];
+    }
+
+    encoderUsec = BenchmarkElapsedUsec(start);
+
+    // A received frame, as reported by the RCP in `SPINEL_PROP_STREAM_RAW`.
+    frameLen = static_cast<uint16_t>(spinel_datatype_pack(
+        frame, sizeof(frame),
+        (SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_UINT16_S
+             SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT64_S)
+                 SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT_PACKED_S)),
+        psdu, sizeof(psdu), -40, -100, 0, 11, 200, 0x123456789aULL, 0));
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kIterations; n++)
+    {
+        uint8_t        buffer[OT_RADIO_FRAME_MAX_SIZE];
+        spinel_size_t  size = sizeof(buffer);
+        int8_t         rssi;
+        int8_t         noiseFloor;
+        uint16_t       flags;
+        uint8_t        channel;
+        uint8_t        lqi;
+        uint64_t       timestamp;
+        unsigned int   receiveError;
+        spinel_ssize_t unpacked;
+
+        unpacked = spinel_datatype_unpack_in_place(
+            frame, frameLen,
+            (SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_UINT16_S
+                 SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT64_S)
+                     SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT_PACKED_S)),
+            buffer, &size, &rssi, &noiseFloor, &flags, &channel, &lqi, &timestamp, &receiveError);
+
+        VerifyOrQuit(unpacked == frameLen, "spinel_datatype_unpack_in_place() failed");
+        sum += static_cast<uint32_t>(size) + buffer[n % size] + lqi;
+    }
+
+    unpackUsec = BenchmarkElapsedUsec(start);
+    gettimeofday(&start, NULL);
+
+    for (uint32_t n = 0; n < kIterations; n++)
+    {
+        uint8_t        buffer[OT_RADIO_FRAME_MAX_SIZE];
+        const uint8_t *data;
+        uint16_t       size;
+        int8_t         rssi;
+        int8_t         noiseFloor;
+        uint16_t       flags;
+        uint8_t        channel;
+        uint8_t        lqi;
+        uint64_t       timestamp;
+        unsigned int   receiveError;
+        SpinelDecoder  decoder;
+
+        decoder.Init(frame, frameLen);
+        SuccessOrQuit(decoder.ReadDataWithLen(data, size), "ReadDataWithLen() failed.");
+        SuccessOrQuit(decoder.ReadInt8(rssi), "ReadInt8() failed.");
+        SuccessOrQuit(decoder.ReadInt8(noiseFloor), "ReadInt8() failed.");
+        SuccessOrQuit(decoder.ReadUint16(flags), "ReadUint16() failed.");
+        SuccessOrQuit(decoder.OpenStruct(), "OpenStruct() failed.");
+        SuccessOrQuit(decoder.ReadUint8(channel), "ReadUint8() failed.");
+        SuccessOrQuit(decoder.ReadUint8(lqi), "ReadUint8() failed.");
+        SuccessOrQuit(decoder.ReadUint64(timestamp), "ReadUint64() failed.");
+        SuccessOrQuit(decoder.CloseStruct(), "CloseStruct() failed.");
+        SuccessOrQuit(decoder.OpenStruct(), "OpenStruct() failed.");
+        SuccessOrQuit(decoder.ReadUintPacked(receiveError), "ReadUintPacked() failed.");
+        SuccessOrQuit(decoder.CloseStruct(), "CloseStruct() failed.");
+        memcpy(buffer, data, size);
+
+        VerifyOrQuit(decoder.IsAllRead(), "SpinelDecoder failed");
+        sum += size + buffer[n % size] + lqi;
+    }
+
+    decoderUsec = BenchmarkElapsedUsec(start);
+
+    printf("\nTestSpinelEncodeDecodeBenchmark() (checksum %u)", static_cast<unsigned int>(sum));
+    printf("\n  encode: spinel_datatype_pack() %u ns, SpinelBufferEncoder %u ns per frame",
+           static_cast<unsigned int>((static_cast<uint64_t>(packUsec) * 1000) / kIterations),
+           static_cast<unsigned int>((static_cast<uint64_t>(encoderUsec) * 1000) / kIterations));
+    printf("\n  decode: spinel_datatype_unpack_in_place() %u ns, SpinelDecoder %u ns per frame\n",
+           static_cast<unsigned int>((static_cast<uint64_t>(unpackUsec) * 1000) / kIterations),
+           static_cast<unsigned int>((static_cast<uint64_t>(decoderUsec) * 1000) / kIterations));
+}
+
 } // namespace Ncp
 } // namespace ot
 
 int main(void)
 {
     ot::Ncp::TestSpinelEncoder();
+    ot::Ncp::TestSpinelBufferEncoder();
+    ot::Ncp::TestSpinelEncodeDecodeBenchmark();
     printf("\nAll tests passed.\n");
     return 0;
 }
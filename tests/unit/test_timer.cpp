@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sys/time.h>
+
 #include "test_platform.h"
 
 #include "common/code_utils.hpp"
@@ -650,6 +652,147 @@ int TestTimerTime(void)
     return 0;
 }
 
+/**
+ * `BenchmarkTimer` sub-classes `ot::TimerMilli` and verifies that timers are fired in the order of their fire times.
+ */
+class BenchmarkTimer : public ot::TimerMilli
+{
+public:
+    BenchmarkTimer(ot::Instance &aInstance)
+        : ot::TimerMilli(aInstance, BenchmarkTimer::HandleTimerFired, NULL)
+    {
+    }
+
+    static void HandleTimerFired(ot::Timer &aTimer)
+    {
+        VerifyOrQuit(!(aTimer.GetFireTime() < sLastFireTime), "TestTimerBenchmark: Timers fired out of order.");
+        sLastFireTime = aTimer.GetFireTime();
+        sCallCount[kCallCountIndexTimerHandler]++;
+    }
+
+    static ot::TimeMilli sLastFireTime;
+};
+
+ot::TimeMilli BenchmarkTimer::sLastFireTime;
+
+static uint32_t sBenchmarkRandom;
+
+static uint32_t BenchmarkRandom(void)
+{
+    // Simple linear congruential generator so that the benchmark is repeatable.
+    sBenchmarkRandom = sBenchmarkRandom * 1103515245U + 12345U;
+    return sBenchmarkRandom >> 8;
+}
+
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+/**
+ * Measure the TimerScheduler's insert, re-arm, remove and fire performance with thousands of timers.
+ */
+int TestTimerBenchmark(void)
+{
+    const uint32_t kNumTimers = 4000;
+    const uint32_t kMaxDelay  = 100000;
+    const uint32_t kStartTime = 0U - 50000U; // Exercise 32-bit wrap of the fire times.
+
+    ot::Instance *  instance = testInitInstance();
+    BenchmarkTimer *timers[kNumTimers];
+    struct timeval  start;
+    uint32_t        insertTime;
+    uint32_t        rearmTime;
+    uint32_t        removeTime;
+    uint32_t        fireTime;
+    uint32_t        numStopped = 0;
+
+    printf("TestTimerBenchmark() with %u timers ", kNumTimers);
+
+    InitTestTimer();
+    InitCounters();
+    sBenchmarkRandom = 1;
+    sNow             = kStartTime;
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i] = new BenchmarkTimer(*instance);
+    }
+
+    // Insert all timers with random delays.
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i]->Start(BenchmarkRandom() % kMaxDelay);
+    }
+
+    insertTime = BenchmarkElapsedUsec(start);
+
+    // Re-arm all running timers with new random delays (remove and insert).
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i]->Start(BenchmarkRandom() % kMaxDelay);
+    }
+
+    rearmTime = BenchmarkElapsedUsec(start);
+
+    // Stop every third timer.
+
+    gettimeofday(&start, NULL);
+
+    for (uint32_t i = 0; i < kNumTimers; i += 3)
+    {
+        timers[i]->Stop();
+        numStopped++;
+    }
+
+    removeTime = BenchmarkElapsedUsec(start);
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(timers[i]->IsRunning() == ((i % 3) != 0), "TestTimerBenchmark: Timer running Failed.");
+    }
+
+    // Fire all remaining timers.
+
+    BenchmarkTimer::sLastFireTime = ot::TimeMilli(kStartTime);
+    sNow                          = kStartTime + kMaxDelay;
+
+    gettimeofday(&start, NULL);
+
+    while (sTimerOn)
+    {
+        otPlatAlarmMilliFired(instance);
+    }
+
+    fireTime = BenchmarkElapsedUsec(start);
+
+    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == kNumTimers - numStopped,
+                 "TestTimerBenchmark: Handler CallCount Failed.");
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i]->IsRunning(), "TestTimerBenchmark: Timer running Failed.");
+        delete timers[i];
+    }
+
+    printf("--> PASSED (insert %uus, re-arm %uus, remove %uus, fire %uus)\n", insertTime, rearmTime, removeTime,
+           fireTime);
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
 void RunTimerTests(void)
 {
     TestOneTimer();
@@ -661,6 +804,7 @@ int main(void)
 {
     RunTimerTests();
     TestTimerTime();
+    TestTimerBenchmark();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,236 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sys/time.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "net/ip6.hpp"
+#include "net/udp6.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+static Ip6::UdpSocket *sReceivedSocket;
+static uint32_t        sReceivedCount;
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sReceivedSocket = static_cast<Ip6::UdpSocket *>(aContext);
+    sReceivedCount++;
+}
+
+static void OpenSocket(Ip6::UdpSocket &aSocket, const char *aAddress, uint16_t aPort)
+{
+    Ip6::SockAddr sockAddr;
+
+    SuccessOrQuit(aSocket.Open(HandleUdpReceive, &aSocket), "UdpSocket::Open() failed");
+
+    if (aAddress != NULL)
+    {
+        SuccessOrQuit(sockAddr.GetAddress().FromString(aAddress), "Address::FromString() failed");
+    }
+
+    sockAddr.mPort = aPort;
+    SuccessOrQuit(aSocket.Bind(sockAddr), "UdpSocket::Bind() failed");
+}
+
+static void ConnectSocket(Ip6::UdpSocket &aSocket, const char *aAddress, uint16_t aPort)
+{
+    Ip6::SockAddr sockAddr;
+
+    if (aAddress != NULL)
+    {
+        SuccessOrQuit(sockAddr.GetAddress().FromString(aAddress), "Address::FromString() failed");
+    }
+
+    sockAddr.mPort = aPort;
+    SuccessOrQuit(aSocket.Connect(sockAddr), "UdpSocket::Connect() failed");
+}
+
+static Ip6::UdpSocket *Deliver(Ip6::Udp &  aUdp,
+                               Message &   aMessage,
+                               const char *aSockAddress,
+                               uint16_t    aSockPort,
+                               const char *aPeerAddress,
+                               uint16_t    aPeerPort)
+{
+    Ip6::MessageInfo messageInfo;
+
+    SuccessOrQuit(messageInfo.GetSockAddr().FromString(aSockAddress), "Address::FromString() failed");
+    SuccessOrQuit(messageInfo.GetPeerAddr().FromString(aPeerAddress), "Address::FromString() failed");
+    messageInfo.SetSockPort(aSockPort);
+    messageInfo.SetPeerPort(aPeerPort);
+
+    sReceivedSocket = NULL;
+    aMessage.SetOffset(0);
+    aUdp.HandlePayload(aMessage, messageInfo);
+
+    return sReceivedSocket;
+}
+
+void TestUdpSocketDemux(void)
+{
+    Instance *     instance = testInitInstance();
+    Ip6::Udp &     udp      = instance->Get<Ip6::Udp>();
+    Message *      message;
+    Ip6::UdpSocket wildcard(udp);
+    Ip6::UdpSocket bound(udp);
+    Ip6::UdpSocket connected(udp);
+    Ip6::UdpSocket connectedPort(udp);
+    Ip6::UdpSocket other(udp);
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+    VerifyOrQuit((message = udp.NewMessage(0)) != NULL, "Udp::NewMessage() failed");
+
+    // `other` shares the port bucket of the sockets under test.
+    OpenSocket(wildcard, NULL, 1000);
+    OpenSocket(connected, NULL, 1000);
+    ConnectSocket(connected, "fd00::2", 2000);
+    OpenSocket(bound, "fd00::1", 1000);
+    OpenSocket(connectedPort, NULL, 1000);
+    ConnectSocket(connectedPort, NULL, 3000);
+    OpenSocket(other, NULL, 1000 + 16 * 257);
+
+    // The most specific socket wins regardless of the order the sockets were opened in.
+    VerifyOrQuit(Deliver(udp, *message, "fd00::1", 1000, "fd00::2", 2000) == &connected, "connected socket failed");
+    VerifyOrQuit(Deliver(udp, *message, "fd00::1", 1000, "fd00::3", 2000) == &bound, "bound socket failed");
+    VerifyOrQuit(Deliver(udp, *message, "fd00::9", 1000, "fd00::3", 2000) == &wildcard, "wildcard socket failed");
+    VerifyOrQuit(Deliver(udp, *message, "fd00::9", 1000, "fd00::3", 3000) == &connectedPort, "peer port failed");
+    VerifyOrQuit(Deliver(udp, *message, "fd00::9", 1000 + 16 * 257, "fd00::3", 3000) == &other, "bucket failed");
+    VerifyOrQuit(Deliver(udp, *message, "fd00::9", 1001, "fd00::3", 2000) == NULL, "unbound port failed");
+
+    // The bound address is not checked for multicast destinations.
+    SuccessOrQuit(wildcard.Close(), "UdpSocket::Close() failed");
+    VerifyOrQuit(Deliver(udp, *message, "ff03::1", 1000, "fd00::3", 2000) == &bound, "multicast failed");
+
+    // Re-binding moves the socket to its new port.
+    OpenSocket(bound, "fd00::1", 1001);
+    VerifyOrQuit(Deliver(udp, *message, "fd00::1", 1001, "fd00::3", 2000) == &bound, "rebind failed");
+    VerifyOrQuit(Deliver(udp, *message, "fd00::1", 1000, "fd00::3", 2000) == NULL, "rebind old port failed");
+
+    SuccessOrQuit(bound.Close(), "UdpSocket::Close() failed");
+    VerifyOrQuit(Deliver(udp, *message, "fd00::1", 1001, "fd00::3", 2000) == NULL, "close failed");
+
+    SuccessOrQuit(connected.Close(), "UdpSocket::Close() failed");
+    SuccessOrQuit(connectedPort.Close(), "UdpSocket::Close() failed");
+    SuccessOrQuit(other.Close(), "UdpSocket::Close() failed");
+
+    message->Free();
+    testFreeInstance(instance);
+
+    printf("TestUdpSocketDemux() passed\n");
+}
+
+static uint32_t BenchmarkElapsedUsec(const struct timeval &aStart)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return static_cast<uint32_t>((now.tv_sec - aStart.tv_sec) * 1000000 + (now.tv_usec - aStart.tv_usec));
+}
+
+/**
+ * Measure the per-datagram demultiplexing cost for a growing number of open sockets.
+ */
+void TestUdpDemuxBenchmark(void)
+{
+    const uint16_t kSocketCounts[] = {1, 8, 32, 128};
+    const uint16_t kBasePort       = 20000;
+    const uint32_t kNumDatagrams   = 100000;
+
+    Instance *       instance = testInitInstance();
+    Ip6::Udp &       udp      = instance->Get<Ip6::Udp>();
+    Message *        message;
+    Ip6::MessageInfo messageInfo;
+    Ip6::UdpSocket * sockets[128];
+
+    VerifyOrQuit((message = udp.NewMessage(0)) != NULL, "Udp::NewMessage() failed");
+    SuccessOrQuit(messageInfo.GetSockAddr().FromString("fd00::1"), "Address::FromString() failed");
+    SuccessOrQuit(messageInfo.GetPeerAddr().FromString("fd00::2"), "Address::FromString() failed");
+    messageInfo.SetPeerPort(kBasePort);
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kSocketCounts); i++)
+    {
+        uint16_t       numSockets = kSocketCounts[i];
+        struct timeval start;
+        uint32_t       elapsed;
+
+        for (uint16_t j = 0; j < numSockets; j++)
+        {
+            sockets[j] = new Ip6::UdpSocket(udp);
+            OpenSocket(*sockets[j], NULL, kBasePort + j);
+        }
+
+        sReceivedCount = 0;
+        gettimeofday(&start, NULL);
+
+        for (uint32_t n = 0; n < kNumDatagrams; n++)
+        {
+            // Address the socket opened first, which a linear scan of the socket list reaches last.
+            messageInfo.SetSockPort(kBasePort);
+            message->SetOffset(0);
+            udp.HandlePayload(*message, messageInfo);
+        }
+
+        elapsed = BenchmarkElapsedUsec(start);
+
+        VerifyOrQuit(sReceivedCount == kNumDatagrams, "TestUdpDemuxBenchmark: datagrams were not delivered");
+        printf("TestUdpDemuxBenchmark() with %u sockets: %u ns per datagram\n", numSockets,
+               static_cast<unsigned int>((static_cast<uint64_t>(elapsed) * 1000) / kNumDatagrams));
+
+        for (uint16_t j = 0; j < numSockets; j++)
+        {
+            SuccessOrQuit(sockets[j]->Close(), "UdpSocket::Close() failed");
+            delete sockets[j];
+        }
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestUdpSocketDemux();
+    ot::TestUdpDemuxBenchmark();
+    printf("All tests passed\n");
+    return 0;
+}